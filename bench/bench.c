@@ -0,0 +1,215 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench.c
+ ** @brief Mediciones de rendimiento en el host de las funciones que se ejecutan con mas frecuencia
+ **
+ ** Cada medicion informa el tiempo por operacion y, cuando el sistema permite utilizar perf_event_open, la cantidad
+ ** de instrucciones por operacion. Las instrucciones no dependen de la carga de la maquina, por lo que son la
+ ** referencia mas estable para detectar regresiones. Con la opcion --json los resultados se escriben en un formato
+ ** que puede compararse con una ejecucion anterior.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _GNU_SOURCE
+#include "bench.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* === Private macros definitions ================================================================================== */
+
+//! Fraccion de las operaciones de una medicion que se ejecutan antes de medir para cargar las memorias cache
+#define BENCH_WARMUP_DIVISOR 10
+
+/* === Private data type declarations ============================================================================== */
+
+//! Resultado de una repeticion de la medicion
+typedef struct bench_sample_s {
+    uint64_t nanoseconds;  // Duracion de todas las operaciones
+    uint64_t instructions; // Instrucciones ejecutadas en modo usuario por todas las operaciones
+} bench_sample_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Abre el contador de instrucciones del proceso, si el sistema lo permite.
+ * @return true si el contador esta disponible, false en caso contrario.
+ */
+static bool CounterOpen(void);
+
+/**
+ * @brief Lee el reloj monotonico del sistema.
+ * @return Tiempo actual en nanosegundos.
+ */
+static uint64_t Now(void);
+
+/**
+ * @brief Ejecuta una repeticion de la medicion.
+ * @param body Funcion que ejecuta la operacion.
+ * @param object Puntero que se envia como parametro a la funcion.
+ * @param iterations Cantidad de operaciones a ejecutar.
+ * @return Duracion e instrucciones de la repeticion.
+ */
+static bench_sample_t Measure(bench_body_t body, void * object, uint32_t iterations);
+
+/* === Private variable definitions ================================================================================ */
+
+static int counter = -1;    // Descriptor del contador de instrucciones o -1 si no esta disponible
+static bool json;           // Los resultados se escriben en formato JSON
+static const char * filter; // Solo se ejecutan las mediciones cuyo nombre contiene este texto
+static uint32_t reported;   // Cantidad de mediciones informadas
+
+/* === Public variable definitions ================================================================================= */
+
+volatile uint32_t bench_sink;
+
+/* === Private function definitions ================================================================================ */
+
+static bool CounterOpen(void) {
+#ifdef __linux__
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    counter = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    return (counter >= 0);
+}
+
+static uint64_t Now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+}
+
+static bench_sample_t Measure(bench_body_t body, void * object, uint32_t iterations) {
+    bench_sample_t sample = {0};
+    uint64_t start;
+
+#ifdef __linux__
+    if (counter >= 0) {
+        ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+    start = Now();
+    body(object, iterations);
+    sample.nanoseconds = Now() - start;
+#ifdef __linux__
+    if (counter >= 0) {
+        ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counter, &sample.instructions, sizeof(sample.instructions)) != sizeof(sample.instructions)) {
+            sample.instructions = 0;
+        }
+    }
+#endif
+    return sample;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void BenchRun(const char * name, bench_body_t body, void * object, uint32_t iterations) {
+    bench_sample_t best = {UINT64_MAX, UINT64_MAX};
+
+    if ((filter != NULL) && (strstr(name, filter) == NULL)) {
+        return;
+    }
+
+    body(object, iterations / BENCH_WARMUP_DIVISOR + 1);
+    // Las interrupciones del sistema solo pueden sumar tiempo, por lo que la repeticion mas rapida es la mas precisa
+    for (int repetition = 0; repetition < BENCH_REPETITIONS; repetition++) {
+        bench_sample_t sample = Measure(body, object, iterations);
+        if (sample.nanoseconds < best.nanoseconds) {
+            best.nanoseconds = sample.nanoseconds;
+        }
+        if (sample.instructions < best.instructions) {
+            best.instructions = sample.instructions;
+        }
+    }
+
+    double nanoseconds = (double)best.nanoseconds / iterations;
+    double instructions = (double)best.instructions / iterations;
+
+    if (json) {
+        printf("%s\n    {\"name\": \"%s\", \"iterations\": %u, \"ns_per_op\": %.3f, ", reported ? "," : "", name,
+               iterations, nanoseconds);
+        if (counter >= 0) {
+            printf("\"instructions_per_op\": %.2f}", instructions);
+        } else {
+            printf("\"instructions_per_op\": null}");
+        }
+    } else if (counter >= 0) {
+        printf("%-32s %10u %10.2f %12.1f\n", name, iterations, nanoseconds, instructions);
+    } else {
+        printf("%-32s %10u %10.2f %12s\n", name, iterations, nanoseconds, "-");
+    }
+    fflush(stdout);
+    reported++;
+}
+
+int main(int argc, char * argv[]) {
+    for (int index = 1; index < argc; index++) {
+        if (strcmp(argv[index], "--json") == 0) {
+            json = true;
+        } else if ((argv[index][0] == '-') || (filter != NULL)) {
+            fprintf(stderr, "Uso: %s [--json] [filtro]\n", argv[0]);
+            return 1;
+        } else {
+            filter = argv[index];
+        }
+    }
+
+    if (!CounterOpen()) {
+        fprintf(stderr, "El contador de instrucciones no esta disponible, solo se informan los tiempos\n");
+    }
+
+    if (json) {
+        printf("{\n  \"instructions\": %s,\n  \"results\": [", (counter >= 0) ? "true" : "false");
+    } else {
+        printf("%-32s %10s %10s %12s\n", "Medicion", "Operac.", "ns/op", "instr/op");
+    }
+
+    BenchClock();
+    BenchScreen();
+    BenchDigital();
+    BenchTelemetry();
+
+    if (json) {
+        printf("\n  ]\n}\n");
+    }
+    return 0;
+}
+
+/* === End of documentation ======================================================================================== */
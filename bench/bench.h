@@ -0,0 +1,86 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench.h
+ ** @brief Mediciones de rendimiento en el host de las funciones que se ejecutan con mas frecuencia
+ **/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de veces que se repite cada medicion, se informa la mas rapida para descartar interferencias del sistema
+#ifndef BENCH_REPETITIONS
+#define BENCH_REPETITIONS 5
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Funcion que ejecuta la operacion medida la cantidad de veces indicada con entradas fijas.
+ *
+ * El lazo se ejecuta dentro de la funcion para que el costo de la llamada indirecta no se sume a cada operacion.
+ */
+typedef void (*bench_body_t)(void * object, uint32_t iterations);
+
+/* === Public variable declarations ================================================================================ */
+
+//! Destino de los resultados de las operaciones medidas, evita que el compilador las elimine
+extern volatile uint32_t bench_sink;
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Mide una operacion e informa el tiempo y las instrucciones por operacion.
+ *
+ * @param name Nombre de la medicion en los informes, no debe contener comillas.
+ * @param body Funcion que ejecuta la operacion.
+ * @param object Puntero que se envia como parametro a la funcion.
+ * @param iterations Cantidad de operaciones de cada repeticion de la medicion.
+ */
+void BenchRun(const char * name, bench_body_t body, void * object, uint32_t iterations);
+
+//! Mide las funciones del reloj que se ejecutan en cada tick
+void BenchClock(void);
+
+//! Mide las funciones de la pantalla que se ejecutan en cada refresco del multiplexado
+void BenchScreen(void);
+
+//! Mide la deteccion de cambios de las entradas digitales que se ejecuta en cada exploracion de las teclas
+void BenchDigital(void);
+
+//! Mide la codificacion de los registros de eventos que se agregan desde las tareas de la interfaz
+void BenchTelemetry(void);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,103 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_clock.c
+ ** @brief Mediciones de las funciones del reloj que se ejecutan en cada tick
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "bench.h"
+#include "clock.h"
+#include <stddef.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Frecuencia del reloj medido, igual a la del tick del sistema en la placa
+#define BENCH_TICKS_PER_SECOND 1000
+
+//! Cantidad de operaciones de cada medicion
+#define BENCH_CLOCK_ITERATIONS 10000000
+
+/* === Private data type declarations ============================================================================== */
+
+//! Par de horas que se comparan en cada operacion
+typedef struct bench_times_s {
+    clock_time_t first;
+    clock_time_t second;
+} bench_times_t;
+
+/* === Private function declarations =============================================================================== */
+
+static void NewTick(void * object, uint32_t iterations);
+static void TimesMatch(void * object, uint32_t iterations);
+
+/* === Private variable definitions ================================================================================ */
+
+// La hora inicial y la alarma no coinciden en ninguna de las horas que recorre una medicion
+static const clock_time_t START = {.bcd = {0, 0, 0, 0, 2, 1}};
+static const clock_time_t ALARM = {.bcd = {0, 0, 0, 0, 5, 0}};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void NewTick(void * object, uint32_t iterations) {
+    clock_t clock = object;
+
+    // Cada repeticion comienza a la misma hora para que ejecute exactamente las mismas instrucciones
+    ClockSetTime(clock, &START);
+    for (uint32_t index = 0; index < iterations; index++) {
+        ClockNewTick(clock);
+    }
+    bench_sink += ClockIsAlarmTriggered(clock);
+}
+
+static void TimesMatch(void * object, uint32_t iterations) {
+    bench_times_t * times = object;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        bench_sink += ClockTimesMatch(&times->first, &times->second);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void BenchClock(void) {
+    clock_t clock = ClockCreate(BENCH_TICKS_PER_SECOND);
+    bench_times_t equal = {.first = START, .second = START};
+    bench_times_t different = {.first = START, .second = ALARM};
+
+    if (clock == NULL) {
+        return;
+    }
+
+    BenchRun("clock_new_tick", NewTick, clock, BENCH_CLOCK_ITERATIONS);
+
+    ClockSetAlarmTime(clock, &ALARM);
+    ClockSetTime(clock, &START);
+    ClockEnableAlarm(clock);
+    BenchRun("clock_new_tick_alarm", NewTick, clock, BENCH_CLOCK_ITERATIONS);
+
+    // Las horas iguales recorren todos los digitos, que es el peor caso de la comparacion
+    BenchRun("clock_times_match_equal", TimesMatch, &equal, BENCH_CLOCK_ITERATIONS);
+    BenchRun("clock_times_match_different", TimesMatch, &different, BENCH_CLOCK_ITERATIONS);
+}
+
+/* === End of documentation ======================================================================================== */
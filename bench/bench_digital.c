@@ -0,0 +1,83 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_digital.c
+ ** @brief Mediciones de la deteccion de cambios de las entradas digitales
+ **
+ ** Los terminales se leen de los registros simulados del sustituto de lpc_open que utilizan las pruebas.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "bench.h"
+#include "digital.h"
+#include "poncho.h"
+#include <stddef.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Cantidad de operaciones de cada medicion
+#define BENCH_DIGITAL_ITERATIONS 10000000
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void WasChanged(void * object, uint32_t iterations);
+static void WasChangedToggling(void * object, uint32_t iterations);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void WasChanged(void * object, uint32_t iterations) {
+    digital_input_t input = object;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        bench_sink += DigitalInputWasChanged(input);
+    }
+}
+
+static void WasChangedToggling(void * object, uint32_t iterations) {
+    digital_input_t input = object;
+
+    // El terminal cambia antes de cada lectura, por lo que se recorre la rama que informa un cambio
+    for (uint32_t index = 0; index < iterations; index++) {
+        Chip_GPIO_SetPinToggle(LPC_GPIO_PORT, KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT);
+        bench_sink += DigitalInputWasChanged(input);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void BenchDigital(void) {
+    FakeChipReset();
+    digital_input_t input = DigitalInputCreate(KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT, true);
+
+    if (input == NULL) {
+        return;
+    }
+
+    BenchRun("digital_was_changed", WasChanged, input, BENCH_DIGITAL_ITERATIONS);
+    BenchRun("digital_was_changed_toggling", WasChangedToggling, input, BENCH_DIGITAL_ITERATIONS);
+}
+
+/* === End of documentation ======================================================================================== */
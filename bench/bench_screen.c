@@ -0,0 +1,130 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_screen.c
+ ** @brief Mediciones de las funciones de la pantalla que se ejecutan en cada refresco del multiplexado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "bench.h"
+#include "screen.h"
+#include <stddef.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Cantidad de digitos y de puntos de la pantalla del poncho
+#define BENCH_SCREEN_DIGITS 4
+
+//! Cantidad de operaciones de cada medicion
+#define BENCH_SCREEN_ITERATIONS 10000000
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+static void SegmentsUpdate(uint8_t segments);
+static void DigitTurnOn(uint8_t digit);
+
+static void Refresh(void * object, uint32_t iterations);
+static void WriteBCD(void * object, uint32_t iterations);
+
+/* === Private variable definitions ================================================================================ */
+
+// Registros simulados del controlador, volatiles para que cada escritura tenga el costo de un acceso a memoria
+static volatile uint8_t digits_port;
+static volatile uint8_t segments_port;
+
+//! Controlador de pantalla que solo escribe los registros simulados
+static const struct screen_driver_s driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+static const uint8_t VALUE[BENCH_SCREEN_DIGITS] = {1, 2, 3, 4};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+    digits_port = 0;
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    segments_port = segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    digits_port = 1 << digit;
+}
+
+#ifdef SCREEN_STATIC_CONFIG
+// Con la configuracion fija la pantalla llama directamente a estas funciones en lugar de usar el controlador
+void ScreenDigitsTurnOff(void) {
+    DigitsTurnOff();
+}
+
+void ScreenSegmentsUpdate(uint8_t segments) {
+    SegmentsUpdate(segments);
+}
+
+void ScreenDigitTurnOn(uint8_t digit) {
+    DigitTurnOn(digit);
+}
+#endif
+
+static void Refresh(void * object, uint32_t iterations) {
+    screen_t screen = object;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        ScreenRefresh(screen);
+    }
+    bench_sink += segments_port;
+}
+
+static void WriteBCD(void * object, uint32_t iterations) {
+    screen_t screen = object;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        ScreenWriteBCD(screen, VALUE, BENCH_SCREEN_DIGITS);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void BenchScreen(void) {
+    screen_t screen = ScreenCreate(BENCH_SCREEN_DIGITS, BENCH_SCREEN_DIGITS, &driver);
+
+    if (screen == NULL) {
+        return;
+    }
+
+    ScreenWriteBCD(screen, VALUE, BENCH_SCREEN_DIGITS);
+    BenchRun("screen_write_bcd", WriteBCD, screen, BENCH_SCREEN_ITERATIONS);
+    BenchRun("screen_refresh", Refresh, screen, BENCH_SCREEN_ITERATIONS);
+
+    // Parpadeo de las horas como en la configuracion del reloj
+    DisplayFlashDigits(screen, 0, 1, 100);
+    BenchRun("screen_refresh_flashing", Refresh, screen, BENCH_SCREEN_ITERATIONS);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,97 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bench_telemetry.c
+ ** @brief Mediciones de la codificacion de los registros de eventos
+ **
+ ** Cuando el buffer se llena se vacia con una funcion de envio que acepta todos los bytes, por lo que cada medicion
+ ** incluye una parte proporcional del envio.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "bench.h"
+#include "telemetry.h"
+#include <stddef.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Cantidad de operaciones de cada medicion
+#define BENCH_TELEMETRY_ITERATIONS 10000000
+
+/* === Private data type declarations ============================================================================== */
+
+//! Parametros de los registros que se agregan en cada medicion
+typedef struct bench_records_s {
+    telemetry_t telemetry;
+    uint32_t step;  // Milisegundos que avanza el reloj simulado entre registros
+    uint32_t value; // Valor de cada registro
+} bench_records_t;
+
+/* === Private function declarations =============================================================================== */
+
+static uint32_t FakeClock(void);
+static uint16_t DiscardWriter(const void * data, uint16_t size);
+static void Log(void * object, uint32_t iterations);
+
+/* === Private variable definitions ================================================================================ */
+
+static uint32_t now; // Tiempo simulado en milisegundos
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t FakeClock(void) {
+    return now;
+}
+
+static uint16_t DiscardWriter(const void * data, uint16_t size) {
+    bench_sink += *(const uint8_t *)data;
+    return size;
+}
+
+static void Log(void * object, uint32_t iterations) {
+    bench_records_t * records = object;
+
+    for (uint32_t index = 0; index < iterations; index++) {
+        now += records->step;
+        if (!TelemetryLog(records->telemetry, TELEMETRY_KEY, records->value)) {
+            TelemetryDrain(records->telemetry, DiscardWriter);
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void BenchTelemetry(void) {
+    telemetry_t telemetry = TelemetryCreate(FakeClock);
+    // Una tecla cada pocos milisegundos es el caso habitual, los valores grandes ocupan la longitud maxima
+    bench_records_t small = {.telemetry = telemetry, .step = 10, .value = 4};
+    bench_records_t large = {.telemetry = telemetry, .step = UINT32_MAX / 2, .value = UINT32_MAX};
+
+    if (telemetry == NULL) {
+        return;
+    }
+
+    BenchRun("telemetry_log", Log, &small, BENCH_TELEMETRY_ITERATIONS);
+    BenchRun("telemetry_log_large", Log, &large, BENCH_TELEMETRY_ITERATIONS);
+}
+
+/* === End of documentation ======================================================================================== */
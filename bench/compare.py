@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+#####################################################################################################################
+# Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+# documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+# persons to whom the Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+# Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+# WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+# OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+#####################################################################################################################
+"""Compara los resultados de dos ejecuciones de las mediciones de rendimiento y termina con error si alguna empeora mas
+que la tolerancia.
+
+Las instrucciones por operacion se comparan cuando las dos ejecuciones las informan, porque no dependen de la carga de
+la maquina. El tiempo por operacion se compara cuando se indica --time o cuando no hay instrucciones disponibles.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    try:
+        with open(path, encoding="utf-8") as file:
+            data = json.load(file)
+    except (OSError, ValueError) as error:
+        sys.exit(f"{path}: {error}")
+    return data["instructions"], {result["name"]: result for result in data["results"]}
+
+
+def change(before, after):
+    """Variacion porcentual entre dos valores, positiva cuando el valor nuevo es mayor"""
+    return 100.0 * (after - before) / before if before else 0.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="resultados de referencia")
+    parser.add_argument("results", help="resultados a comparar")
+    parser.add_argument("--tolerance", type=float, default=5.0, help="empeoramiento admitido en porcentaje")
+    parser.add_argument("--time", action="store_true", help="compara tambien el tiempo por operacion")
+    arguments = parser.parse_args()
+
+    counted_before, baseline = load(arguments.baseline)
+    counted_after, results = load(arguments.results)
+    instructions = counted_before and counted_after
+    time = arguments.time or not instructions
+
+    metrics = []
+    if instructions:
+        metrics.append(("instructions_per_op", "instr/op"))
+    if time:
+        metrics.append(("ns_per_op", "ns/op"))
+
+    regressions = 0
+    print(f"{'Medicion':<32} {'Metrica':>9} {'Antes':>10} {'Despues':>10} {'Cambio':>8}")
+    for name, result in results.items():
+        if name not in baseline:
+            print(f"{name:<32} {'nueva':>9}")
+            continue
+        for key, label in metrics:
+            delta = change(baseline[name][key], result[key])
+            mark = ""
+            if delta > arguments.tolerance:
+                regressions += 1
+                mark = " <- regresion"
+            print(f"{name:<32} {label:>9} {baseline[name][key]:>10.2f} {result[key]:>10.2f} {delta:>+7.1f}%{mark}")
+
+    if regressions:
+        sys.exit(f"{regressions} mediciones empeoraron mas de {arguments.tolerance:g}%")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,554 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file fuzz_clock.c
+ ** @brief Pruebas basadas en propiedades y con fuzzing guiado por cobertura de la interfaz del reloj
+ **
+ ** Cada entrada es una secuencia de operaciones sobre el reloj: ajustar la hora o la alarma con valores validos o con
+ ** digitos BCD arbitrarios, avanzar ticks o segundos, posponer, cancelar, habilitar y deshabilitar la alarma. Las
+ ** operaciones se aplican al mismo tiempo al reloj real y a un modelo de referencia que representa las horas como
+ ** segundos desde la medianoche, y despues de cada una se compara todo el estado observable de ambos.
+ **
+ ** El primer byte elige la frecuencia del reloj y cada operacion ocupa FUZZ_OP_SIZE bytes, un codigo y tres
+ ** argumentos. El archivo exporta LLVMFuzzerTestOneInput para libFuzzer y, si no se define FUZZ_NO_MAIN, una funcion
+ ** principal que genera secuencias aleatorias o reproduce archivos de entrada, lo que permite usarlo tambien con AFL.
+ ** Cuando encuentra una diferencia minimiza la secuencia y escribe una prueba de Unity que la reproduce.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "clock.h"
+#include "host_time.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#define FUZZ_OP_SIZE              4  // Bytes de cada operacion: codigo y tres argumentos
+#define FUZZ_MAX_OPS              64 // Operaciones consideradas de cada entrada, el resto se ignora
+#define FUZZ_MAX_TICKS_PER_SECOND 8  // Frecuencia maxima del reloj bajo prueba
+#define FUZZ_MAX_SECONDS          64 // Segundos maximos que avanza una operacion
+#define FUZZ_MAX_SIZE             (1 + FUZZ_MAX_OPS * FUZZ_OP_SIZE)
+
+#define SECONDS_PER_DAY 86400
+#define MINUTES_PER_DAY 1440
+
+/* === Private data type declarations ============================================================================== */
+
+//! Operaciones sobre el reloj, el codigo de cada operacion se toma modulo OP_COUNT
+typedef enum {
+    OP_SET_TIME,      // Ajusta la hora con horas, minutos y segundos que pueden estar fuera de rango
+    OP_SET_TIME_RAW,  // Ajusta la hora con seis digitos BCD arbitrarios
+    OP_SET_ALARM,     // Ajusta la alarma con horas, minutos y segundos que pueden estar fuera de rango
+    OP_SET_ALARM_RAW, // Ajusta la alarma con seis digitos BCD arbitrarios
+    OP_TICKS,         // Avanza entre 1 y 256 ticks
+    OP_SECONDS,       // Avanza entre 1 y FUZZ_MAX_SECONDS segundos completos
+    OP_SNOOZE,        // Pospone la alarma entre 0 y 255 minutos
+    OP_CANCEL,        // Cancela la alarma hasta el dia siguiente
+    OP_ENABLE,        // Habilita la alarma
+    OP_DISABLE,       // Deshabilita la alarma
+    OP_COUNT,
+} fuzz_op_t;
+
+//! Modelo de referencia del reloj, las horas se representan en segundos desde la medianoche
+typedef struct fuzz_model_s {
+    uint16_t ticks_per_second;
+    uint16_t ticks;  // Ticks transcurridos del segundo actual
+    bool valid;      // Se ajusto una hora valida
+    uint32_t now;    // Hora actual
+    uint32_t alarm;  // Hora de la alarma
+    bool enabled;    // La alarma esta habilitada
+    bool triggered;  // La alarma esta sonando
+    bool snoozed;    // Hay una alarma pospuesta pendiente
+    uint32_t snooze; // Hora de la alarma pospuesta
+} fuzz_model_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Ejecuta una entrada sobre el reloj y el modelo y compara sus estados despues de cada operacion.
+ *
+ * @param data Entrada a ejecutar.
+ * @param size Cantidad de bytes de la entrada.
+ * @param output Archivo donde se escribe una prueba de Unity que reproduce la entrada, o NULL para no escribirla.
+ * @return Descripcion de la primera diferencia encontrada, o NULL si el reloj y el modelo coinciden.
+ */
+static const char * Run(const uint8_t * data, size_t size, FILE * output);
+
+/* === Private variable definitions ================================================================================ */
+
+static const char * const OP_NAMES[OP_COUNT] = {
+    "ClockSetTime", "ClockSetTime", "ClockSetAlarmTime", "ClockSetAlarmTime", "ClockNewTick",
+    "ClockNewTick", "ClockSnoozeAlarm", "ClockCancelAlarmUntilNextDay", "ClockEnableAlarm", "ClockDisableAlarm",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DecodeTime(uint8_t code, const uint8_t * args, clock_time_t * time) {
+    if ((code == OP_SET_TIME_RAW) || (code == OP_SET_ALARM_RAW)) {
+        for (int index = 0; index < 3; index++) {
+            time->bcd[2 * index] = args[index] & 0x0F;
+            time->bcd[2 * index + 1] = args[index] >> 4;
+        }
+    } else {
+        // Los rangos exceden por poco los validos para que se prueben los limites de la validacion
+        uint8_t values[3] = {args[2] % 62, args[1] % 62, args[0] % 26};
+        for (int index = 0; index < 3; index++) {
+            time->bcd[2 * index] = values[index] % 10;
+            time->bcd[2 * index + 1] = values[index] / 10;
+        }
+    }
+}
+
+//! Convierte digitos BCD a segundos desde la medianoche, o devuelve UINT32_MAX si no son una hora valida
+static uint32_t ModelSeconds(const clock_time_t * time) {
+    for (int index = 0; index < 6; index++) {
+        if (time->bcd[index] > 9) {
+            return UINT32_MAX;
+        }
+    }
+    uint32_t seconds = time->bcd[1] * 10 + time->bcd[0];
+    uint32_t minutes = time->bcd[3] * 10 + time->bcd[2];
+    uint32_t hours = time->bcd[5] * 10 + time->bcd[4];
+    if ((seconds >= 60) || (minutes >= 60) || (hours >= 24)) {
+        return UINT32_MAX;
+    }
+    return hours * 3600 + minutes * 60 + seconds;
+}
+
+static void ModelTime(uint32_t seconds, uint8_t bcd[6]) {
+    uint8_t values[3] = {seconds % 60, seconds / 60 % 60, seconds / 3600};
+    for (int index = 0; index < 3; index++) {
+        bcd[2 * index] = values[index] % 10;
+        bcd[2 * index + 1] = values[index] / 10;
+    }
+}
+
+static void ModelTick(fuzz_model_t * model) {
+    if (!model->valid) {
+        return;
+    }
+    if (++model->ticks < model->ticks_per_second) {
+        return;
+    }
+    model->ticks = 0;
+    model->now = (model->now + 1) % SECONDS_PER_DAY;
+    if (model->enabled && (model->now == (model->snoozed ? model->snooze : model->alarm))) {
+        model->triggered = true;
+        model->snoozed = false;
+    }
+}
+
+//! Aplica una operacion al modelo y devuelve el resultado que deberia devolver el reloj
+static bool ModelApply(fuzz_model_t * model, uint8_t code, const uint8_t * args, uint32_t count) {
+    clock_time_t time;
+    uint32_t seconds;
+
+    switch (code) {
+    case OP_SET_TIME:
+    case OP_SET_TIME_RAW:
+        DecodeTime(code, args, &time);
+        seconds = ModelSeconds(&time);
+        if (seconds == UINT32_MAX) {
+            return false;
+        }
+        model->now = seconds;
+        model->valid = true;
+        return true;
+    case OP_SET_ALARM:
+    case OP_SET_ALARM_RAW:
+        DecodeTime(code, args, &time);
+        seconds = ModelSeconds(&time);
+        if (seconds == UINT32_MAX) {
+            return false;
+        }
+        model->alarm = seconds;
+        return true;
+    case OP_TICKS:
+    case OP_SECONDS:
+        for (; count > 0; count--) {
+            ModelTick(model);
+        }
+        return true;
+    case OP_SNOOZE:
+        if (!model->valid || (args[0] == 0)) {
+            return false;
+        }
+        model->snooze = ((model->now / 60 + args[0]) % MINUTES_PER_DAY) * 60;
+        model->snoozed = true;
+        model->triggered = false;
+        return true;
+    case OP_CANCEL:
+        if (!model->valid) {
+            return false;
+        }
+        model->triggered = false;
+        model->snoozed = false;
+        return true;
+    default:
+        if (model->valid) {
+            model->enabled = (code == OP_ENABLE);
+        }
+        return true;
+    }
+}
+
+//! Aplica una operacion al reloj real y devuelve su resultado
+static bool ClockApply(clock_t clock, uint8_t code, const uint8_t * args, uint32_t count) {
+    clock_time_t time;
+
+    switch (code) {
+    case OP_SET_TIME:
+    case OP_SET_TIME_RAW:
+        DecodeTime(code, args, &time);
+        return ClockSetTime(clock, &time);
+    case OP_SET_ALARM:
+    case OP_SET_ALARM_RAW:
+        DecodeTime(code, args, &time);
+        return ClockSetAlarmTime(clock, &time);
+    case OP_TICKS:
+    case OP_SECONDS:
+        for (; count > 0; count--) {
+            ClockNewTick(clock);
+        }
+        return true;
+    case OP_SNOOZE:
+        return ClockSnoozeAlarm(clock, args[0]);
+    case OP_CANCEL:
+        return ClockCancelAlarmUntilNextDay(clock);
+    case OP_ENABLE:
+        ClockEnableAlarm(clock);
+        return true;
+    default:
+        ClockDisableAlarm(clock);
+        return true;
+    }
+}
+
+static const char * Compare(clock_t clock, const fuzz_model_t * model) {
+    clock_time_t time;
+    uint8_t expected[6];
+
+    if (ClockGetTime(clock, &time) != model->valid) {
+        return "la validez de la hora no coincide";
+    }
+    ModelTime(model->now, expected);
+    if (memcmp(time.bcd, expected, sizeof(expected)) != 0) {
+        return "la hora no coincide";
+    }
+    if (ClockIsAlarmEnabled(clock) != model->enabled) {
+        return "la habilitacion de la alarma no coincide";
+    }
+    if (ClockIsAlarmTriggered(clock) != model->triggered) {
+        return "el estado de la alarma sonando no coincide";
+    }
+    ClockGetAlarmTime(clock, &time);
+    ModelTime(model->alarm, expected);
+    if (memcmp(time.bcd, expected, sizeof(expected)) != 0) {
+        return "la hora de la alarma no coincide";
+    }
+    return NULL;
+}
+
+static void EmitTime(FILE * output, const char * prefix, const uint8_t bcd[6], const char * suffix) {
+    fprintf(output, "%s((clock_time_t){.bcd = {%u, %u, %u, %u, %u, %u}})%s", prefix, bcd[0], bcd[1], bcd[2], bcd[3],
+            bcd[4], bcd[5], suffix);
+}
+
+static const char * Assertion(bool expected) {
+    return expected ? "TEST_ASSERT_TRUE" : "TEST_ASSERT_FALSE";
+}
+
+static void EmitOperation(FILE * output, uint8_t code, const uint8_t * args, uint32_t count, bool result) {
+    const char * assertion = Assertion(result);
+    clock_time_t time;
+
+    switch (code) {
+    case OP_SET_TIME:
+    case OP_SET_TIME_RAW:
+    case OP_SET_ALARM:
+    case OP_SET_ALARM_RAW:
+        DecodeTime(code, args, &time);
+        fprintf(output, "    %s(%s(fuzzed, ", assertion, OP_NAMES[code]);
+        EmitTime(output, "&", time.bcd, "));\n");
+        break;
+    case OP_TICKS:
+    case OP_SECONDS:
+        fprintf(output, "    for (int tick = 0; tick < %u; tick++) {\n        ClockNewTick(fuzzed);\n    }\n", count);
+        break;
+    case OP_SNOOZE:
+        fprintf(output, "    %s(ClockSnoozeAlarm(fuzzed, %u));\n", assertion, args[0]);
+        break;
+    case OP_CANCEL:
+        fprintf(output, "    %s(ClockCancelAlarmUntilNextDay(fuzzed));\n", assertion);
+        break;
+    default:
+        fprintf(output, "    %s(fuzzed);\n", OP_NAMES[code]);
+        break;
+    }
+}
+
+static void EmitState(FILE * output, const fuzz_model_t * model) {
+    uint8_t bcd[6];
+
+    fprintf(output, "\n    %s(ClockGetTime(fuzzed, &time));\n", Assertion(model->valid));
+    ModelTime(model->now, bcd);
+    EmitTime(output, "    TEST_ASSERT_EQUAL_UINT8_ARRAY(", bcd, ".bcd, time.bcd, 6);\n");
+    fprintf(output, "    %s(ClockIsAlarmEnabled(fuzzed));\n", Assertion(model->enabled));
+    fprintf(output, "    %s(ClockIsAlarmTriggered(fuzzed));\n", Assertion(model->triggered));
+    fprintf(output, "    TEST_ASSERT_TRUE(ClockGetAlarmTime(fuzzed, &time));\n");
+    ModelTime(model->alarm, bcd);
+    EmitTime(output, "    TEST_ASSERT_EQUAL_UINT8_ARRAY(", bcd, ".bcd, time.bcd, 6);\n");
+}
+
+static const char * Run(const uint8_t * data, size_t size, FILE * output) {
+    fuzz_model_t model = {0};
+    const char * failure = NULL;
+
+    if (size == 0) {
+        return NULL;
+    }
+    if (size > FUZZ_MAX_SIZE) {
+        size = FUZZ_MAX_SIZE;
+    }
+
+    model.ticks_per_second = data[0] % FUZZ_MAX_TICKS_PER_SECOND + 1;
+    clock_t clock = ClockCreate(model.ticks_per_second);
+    if (clock == NULL) {
+        return "no se pudo crear el reloj";
+    }
+    if (output != NULL) {
+        fprintf(output, "    clock_t fuzzed = ClockCreate(%u);\n    clock_time_t time;\n\n", model.ticks_per_second);
+    }
+
+    for (size_t offset = 1; (failure == NULL) && (offset + FUZZ_OP_SIZE <= size); offset += FUZZ_OP_SIZE) {
+        uint8_t code = data[offset] % OP_COUNT;
+        const uint8_t * args = &data[offset + 1];
+        uint32_t count = 0;
+
+        if (code == OP_TICKS) {
+            count = args[0] + 1;
+        } else if (code == OP_SECONDS) {
+            count = (args[0] % FUZZ_MAX_SECONDS + 1) * model.ticks_per_second;
+        }
+
+        bool expected = ModelApply(&model, code, args, count);
+        if (output != NULL) {
+            EmitOperation(output, code, args, count, expected);
+        }
+        if (ClockApply(clock, code, args, count) != expected) {
+            failure = "el resultado de la operacion no coincide";
+        } else {
+            failure = Compare(clock, &model);
+        }
+    }
+    if (output != NULL) {
+        EmitState(output, &model);
+    }
+    free(clock);
+    return failure;
+}
+
+/* === Public function implementation ============================================================================== */
+
+int LLVMFuzzerTestOneInput(const uint8_t * data, size_t size) {
+    if (Run(data, size, NULL) != NULL) {
+        abort();
+    }
+    return 0;
+}
+
+#ifndef FUZZ_NO_MAIN
+
+/* === Standalone driver =========================================================================================== */
+
+static uint32_t random_state;
+
+static uint32_t Random(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+//! Elige la mitad de las veces un valor cercano a los limites de la hora para ejercitar los desbordes
+static uint8_t Interesting(const uint8_t * values, size_t count) {
+    return (Random() % 2) ? values[Random() % count] : (uint8_t)Random();
+}
+
+//! Genera una secuencia aleatoria de operaciones y devuelve su longitud en bytes
+static size_t Generate(uint8_t * data) {
+    static const uint8_t HOURS[] = {0, 9, 19, 23, 24, 25};
+    static const uint8_t MINUTES[] = {0, 9, 59, 60, 61};
+    size_t ops = 1 + Random() % (FUZZ_MAX_OPS / 2);
+
+    data[0] = (uint8_t)Random();
+    for (size_t index = 0; index < ops; index++) {
+        uint8_t * op = &data[1 + index * FUZZ_OP_SIZE];
+        op[0] = Random() % OP_COUNT;
+        op[1] = Interesting(HOURS, sizeof(HOURS));
+        op[2] = Interesting(MINUTES, sizeof(MINUTES));
+        op[3] = Interesting(MINUTES, sizeof(MINUTES));
+    }
+    return 1 + ops * FUZZ_OP_SIZE;
+}
+
+//! Reduce una entrada que falla quitando operaciones y simplificando argumentos mientras siga fallando
+static size_t Minimize(uint8_t * data, size_t size) {
+    bool changed = true;
+
+    if (size > FUZZ_MAX_SIZE) {
+        size = FUZZ_MAX_SIZE;
+    }
+    size = 1 + (size - 1) / FUZZ_OP_SIZE * FUZZ_OP_SIZE;
+
+    while (changed) {
+        changed = false;
+
+        // Quita bloques de operaciones, comenzando por los mas grandes
+        for (size_t chunk = (size - 1) / FUZZ_OP_SIZE; chunk > 0; chunk /= 2) {
+            for (size_t start = 1; start + chunk * FUZZ_OP_SIZE <= size;) {
+                uint8_t candidate[FUZZ_MAX_SIZE];
+                size_t length = chunk * FUZZ_OP_SIZE;
+
+                memcpy(candidate, data, start);
+                memcpy(&candidate[start], &data[start + length], size - start - length);
+                if (Run(candidate, size - length, NULL) != NULL) {
+                    memcpy(data, candidate, size - length);
+                    size -= length;
+                    changed = true;
+                } else {
+                    start += length;
+                }
+            }
+        }
+
+        // Lleva cada byte al menor valor que mantiene la falla, probando cero y luego la mitad sucesivamente
+        for (size_t index = 0; index < size; index++) {
+            uint8_t original = data[index];
+            uint8_t values[9] = {0};
+            for (int step = 1; step < 9; step++) {
+                values[step] = original >> (9 - step);
+            }
+            for (int step = 0; step < 9 && values[step] < original; step++) {
+                data[index] = values[step];
+                if (Run(data, size, NULL) != NULL) {
+                    changed = true;
+                    break;
+                }
+                data[index] = original;
+            }
+        }
+    }
+    return size;
+}
+
+//! Minimiza una entrada que falla y escribe la prueba de Unity que la reproduce
+static void Report(uint8_t * data, size_t size, const char * name, const char * path) {
+    FILE * output = stdout;
+
+    size = Minimize(data, size);
+    fprintf(stderr, "Diferencia en %s: %s\n", name, Run(data, size, NULL));
+    if (path != NULL) {
+        output = fopen(path, "w");
+        if (output == NULL) {
+            perror(path);
+            output = stdout;
+        }
+    }
+
+    fprintf(output, "// Secuencia minimizada por fuzz_clock a partir de %s\n", name);
+    fprintf(output, "void test_fuzz_clock_regression(void) {\n");
+    Run(data, size, output);
+    fprintf(output, "}\n");
+    if (output != stdout) {
+        fclose(output);
+        fprintf(stderr, "Prueba de regresion escrita en %s\n", path);
+    }
+}
+
+int main(int argc, char * argv[]) {
+    uint32_t sequences = 100000;
+    uint32_t seed = 1;
+    const char * path = NULL;
+    int index = 1;
+    uint8_t data[FUZZ_MAX_SIZE];
+
+    for (; index < argc && argv[index][0] == '-'; index += 2) {
+        bool valid = (index + 1 < argc);
+        if (valid && (strcmp(argv[index], "-n") == 0)) {
+            valid = (sscanf(argv[index + 1], "%u", &sequences) == 1);
+        } else if (valid && (strcmp(argv[index], "-s") == 0)) {
+            valid = (sscanf(argv[index + 1], "%u", &seed) == 1);
+        } else if (valid && (strcmp(argv[index], "-o") == 0)) {
+            path = argv[index + 1];
+        } else {
+            valid = false;
+        }
+        if (!valid) {
+            fprintf(stderr, "Uso: %s [-n secuencias] [-s semilla] [-o prueba.c] [entradas...]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Con archivos se reproducen entradas de libFuzzer o de AFL, y una diferencia se informa como una falla
+    if (index < argc) {
+        for (; index < argc; index++) {
+            FILE * input = fopen(argv[index], "rb");
+            if (input == NULL) {
+                perror(argv[index]);
+                return EXIT_FAILURE;
+            }
+            size_t size = fread(data, 1, sizeof(data), input);
+            fclose(input);
+            if (Run(data, size, NULL) != NULL) {
+                Report(data, size, argv[index], path);
+                abort();
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+
+    random_state = seed ? seed : 1;
+    uint64_t start = HostTimeNow();
+    for (uint32_t count = 0; count < sequences; count++) {
+        size_t size = Generate(data);
+        if (Run(data, size, NULL) != NULL) {
+            char name[32];
+            snprintf(name, sizeof(name), "la semilla %u", seed);
+            Report(data, size, name, path);
+            return EXIT_FAILURE;
+        }
+    }
+    double elapsed = (HostTimeNow() - start) / 1e9;
+
+    printf("%u secuencias sin diferencias en %.2f s: %.0f secuencias por segundo\n", sequences, elapsed,
+           elapsed > 0 ? sequences / elapsed : 0.0);
+    return EXIT_SUCCESS;
+}
+
+#endif
+
+/* === End of documentation ======================================================================================== */
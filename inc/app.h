@@ -0,0 +1,118 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app.h
+ ** @brief Tareas del reloj despertador que no dependen de la placa
+ **
+ ** La composicion de la pantalla, el avance del reloj, el muestreo de las teclas y la interfaz de usuario son las
+ ** mismas en el programa de la placa y en la simulacion de larga duracion. Cada programa crea los objetos, completa
+ ** una estructura app_s con ellos y registra las tareas en su planificador con un puntero a la estructura como
+ ** parametro. Las tareas que usan los puertos serie y la EEPROM quedan en el programa de la placa.
+ **/
+
+#ifndef APP_H_
+#define APP_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+#include "clock.h"
+#include "digital.h"
+#include "event_queue.h"
+#include "screen.h"
+#include "telemetry.h"
+#include "ui.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de teclas, en el mismo orden que los eventos de teclas de la interfaz
+#define APP_KEYS 6
+
+//! Region del modulo de perfilado en la que se mide el avance del reloj
+#ifndef APP_REGION_CLOCK
+#define APP_REGION_CLOCK 1
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Funcion que se llama con cada evento de segundo, antes de que lo procese la interfaz
+typedef void (*app_second_elapsed_t)(void);
+
+//! Funcion que impide o vuelve a permitir que el multiplexado de la pantalla interrumpa a las tareas
+typedef void (*app_refresh_lock_t)(void);
+
+//! Objetos que comparten las tareas, el programa los completa antes de que el planificador ejecute la primera tarea
+typedef struct app_s {
+    clock_t clock;                      // Reloj que hace avanzar la tarea del reloj
+    ui_t ui;                            // Interfaz de usuario que procesa los eventos
+    event_queue_t events;               // Eventos pendientes de procesar por la interfaz
+    screen_t screen;                    // Pantalla en la que se compone lo que muestra la interfaz
+    digital_input_t keys[APP_KEYS];     // Teclas en el orden de los eventos de la interfaz
+    telemetry_t telemetry;              // Registro de eventos, NULL si no se registran
+    app_second_elapsed_t SecondElapsed; // Funcion que se llama con cada segundo, NULL si no se utiliza
+    app_refresh_lock_t DisableRefresh;  // Detiene el multiplexado, NULL si no interrumpe a las tareas
+    app_refresh_lock_t EnableRefresh;   // Reanuda el multiplexado, NULL si no interrumpe a las tareas
+    uint16_t blink_period;              // Composiciones de la pantalla en cada parpadeo del punto de los segundos
+    uint16_t blink_count;               // Composiciones desde el ultimo parpadeo, lo actualiza la tarea
+    clock_time_t current_time;          // Ultima hora leida del reloj, la actualiza la tarea del reloj
+} * app_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Copia los digitos y puntos de la interfaz a la pantalla y hace parpadear el punto de los segundos.
+ *
+ * La imagen se arma en variables locales y se publica en la pantalla con el multiplexado detenido, asi un refresco
+ * nunca muestra un digito borrado ni pierde el punto de los segundos.
+ *
+ * @param object Puntero a la estructura app_s con los objetos de la aplicacion.
+ */
+void AppDisplayComposeTask(void * object);
+
+/**
+ * @brief Hace avanzar el reloj y envia un evento a la interfaz cada vez que cambia el segundo.
+ * @param object Puntero a la estructura app_s con los objetos de la aplicacion.
+ */
+void AppClockTask(void * object);
+
+/**
+ * @brief Muestrea las teclas y envia un evento a la interfaz por cada tecla liberada.
+ * @param object Puntero a la estructura app_s con los objetos de la aplicacion.
+ */
+void AppKeysScanTask(void * object);
+
+/**
+ * @brief Procesa en la interfaz los eventos pendientes y registra las teclas y los cambios de modo.
+ * @param object Puntero a la estructura app_s con los objetos de la aplicacion.
+ */
+void AppUiTask(void * object);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_H_ */
@@ -0,0 +1,118 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bcd.h
+ ** @brief Aritmetica de campos BCD empaquetados para la hora y la alarma
+ **
+ ** Un campo guarda dos digitos BCD en un byte, las decenas en el nibble alto y las unidades en el bajo, y cuenta de
+ ** cero a un limite menor a cien, como los minutos o las horas. Las operaciones no utilizan divisiones, que en los
+ ** nucleos Cortex-M0 se resuelven con una rutina de la biblioteca.
+ **/
+
+#ifndef BCD_H_
+#define BCD_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define BCD_MINUTES 60 //!< Limite de un campo de minutos o de segundos
+#define BCD_HOURS   24 //!< Limite de un campo de horas
+
+//! Arma un campo empaquetado con las decenas y las unidades
+#define BCD_PACK(tens, units) ((uint8_t)(((tens) << 4) | (units)))
+
+//! Decenas de un campo empaquetado
+#define BCD_TENS(field) ((uint8_t)((field) >> 4))
+
+//! Unidades de un campo empaquetado
+#define BCD_UNITS(field) ((uint8_t)((field) & 0x0F))
+
+/* === Public data type declarations =============================================================================== */
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Convierte un campo empaquetado en su valor binario.
+ *
+ * @param field Campo con dos digitos BCD validos.
+ * @return Valor del campo, entre 0 y 99.
+ */
+uint8_t BcdToBinary(uint8_t field);
+
+/**
+ * @brief Convierte un valor binario en un campo empaquetado.
+ *
+ * @param value Valor entre 0 y 99.
+ * @return Campo con las decenas y las unidades del valor.
+ */
+uint8_t BcdFromBinary(uint8_t value);
+
+/**
+ * @brief Suma un paso a un campo y da la vuelta al llegar al limite.
+ *
+ * @param field Puntero al campo, su valor debe ser menor que el limite.
+ * @param step Cantidad a sumar, puede ser mayor que el limite.
+ * @param limit Cantidad de valores del campo, entre 1 y 99.
+ * @return Cantidad de vueltas que dio el campo, para acarrear al campo siguiente.
+ */
+uint16_t BcdAddWrap(uint8_t * field, uint16_t step, uint8_t limit);
+
+/**
+ * @brief Resta un paso a un campo y da la vuelta al pasar por cero.
+ *
+ * @param field Puntero al campo, su valor debe ser menor que el limite.
+ * @param step Cantidad a restar, puede ser mayor que el limite.
+ * @param limit Cantidad de valores del campo, entre 1 y 99.
+ * @return Cantidad de vueltas que dio el campo, para pedir prestado al campo siguiente.
+ */
+uint16_t BcdSubtractWrap(uint8_t * field, uint16_t step, uint8_t limit);
+
+/**
+ * @brief Suma un paso a un campo sin superar el ultimo valor antes del limite.
+ *
+ * @param field Puntero al campo, su valor debe ser menor que el limite.
+ * @param step Cantidad a sumar.
+ * @param limit Cantidad de valores del campo, entre 1 y 99.
+ */
+void BcdAddSaturate(uint8_t * field, uint16_t step, uint8_t limit);
+
+/**
+ * @brief Resta un paso a un campo sin bajar de cero.
+ *
+ * @param field Puntero al campo.
+ * @param step Cantidad a restar.
+ */
+void BcdSubtractSaturate(uint8_t * field, uint16_t step);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BCD_H_ */
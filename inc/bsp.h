@@ -29,6 +29,7 @@ SPDX-License-Identifier: MIT
 #include "digital.h"
 #include "screen.h"
 #include "config.h"
+#include "hal_sci.h"
 
 /* === Header for C++ compatibility ================================================================================ */
 
@@ -57,18 +58,14 @@ typedef struct Board_s {
     digital_output_t led_blue;
 
     screen_t screen;
+    hal_sci_t console;  // Puerto serie del conector USB, transmite el registro de eventos
+    hal_sci_t commands; // Puerto serie del conector de expansion, recibe los comandos del anfitrion
+
 } const * Board_t;
 /* === Public variable declarations ================================================================================ */
 
 /* === Public function declarations ================================================================================ */
 
-/**
- * @brief Inicializa el temporizador del sistema.
- * @param ticks Cantidad de ticks por segundo.
- * @note Esta función configura el temporizador del sistema para generar interrupciones a intervalos regulares.
- */
-void SysTickInit(uint16_t ticks);
-
 /**
  * @brief Crea e instancia la estructura que representa la placa de desarrollo.
  * @return Un identificador para la placa de desarrollo.
@@ -76,6 +73,25 @@ void SysTickInit(uint16_t ticks);
  */
 Board_t BoardCreate(void);
 
+/**
+ * @brief Suspende el procesador hasta la proxima interrupcion y acumula el tiempo inactivo.
+ * @note Debe llamarse con las interrupciones deshabilitadas, la interrupcion que despierta al procesador se atiende
+ * recien cuando el llamador las vuelve a habilitar.
+ */
+void BoardSleep(void);
+
+/**
+ * @brief Calcula el porcentaje de tiempo que el procesador estuvo suspendido desde la llamada anterior.
+ * @return Porcentaje de tiempo inactivo, entre 0 y 100.
+ */
+uint8_t BoardGetIdlePercent(void);
+
+/**
+ * @brief Lee el contador de ciclos del nucleo.
+ * @return Cantidad de ciclos transcurridos desde la creacion de la placa, el contador desborda libremente.
+ */
+uint32_t BoardGetCycles(void);
+
 /* === End of conditional blocks =================================================================================== */
 
 #ifdef __cplusplus
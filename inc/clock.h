@@ -25,6 +25,7 @@ SPDX-License-Identifier: MIT
 #define CLOCK_H_
 
 /* === Headers files inclusions ==================================================================================== */
+#include "clock_source.h"
 #include <stdbool.h>
 #include <stdint.h>
 /* === Headers files inclusions ==================================================================================== */
@@ -45,23 +46,6 @@ extern "C" {
 
 /* === Public data type declarations =============================================================================== */
 
-/** @brief Modo del sistema para la configuración del reloj y la alarma.
- *
- * Este enum define los diferentes modos en los que el sistema puede operar,
- * permitiendo al usuario configurar la hora actual, la hora de la alarma,
- * o simplemente visualizar el tiempo.
- */
-
-typedef enum {
-    MODE_UNSET,
-    MODE_HOME, // Modo de visualización del tiempo actual
-    MODE_SET_TIME_MINUTES,
-    MODE_SET_TIME_HOURS,
-    MODE_SET_ALARM_MINUTES,
-    MODE_SET_ALARM_HOURS,
-    MODE_ALARM_TRIGGERED, // Modo alarma activada
-} system_mode_t;
-
 /**
  * @brief Estructura que representa el tiempo del reloj en formato BCD.
  *
@@ -91,6 +75,22 @@ typedef struct clock_s * clock_t;
  */
 clock_t ClockCreate(uint16_t ticks_per_second);
 
+/**
+ * @brief Crea un reloj que toma la hora de una fuente externa.
+ *
+ * Si la fuente tiene una hora valida el reloj comienza con esa hora. Mientras la fuente responde, los segundos
+ * avanzan cuando cambia la hora de la fuente y los ticks solo se usan para leerla cerca de cada cambio de segundo;
+ * si deja de responder, el reloj sigue contando los ticks. Ajustar la hora del reloj tambien ajusta la fuente.
+ *
+ * Si se define CLOCK_STATIC_TPS con la frecuencia del reloj, la comparacion de cada tick se hace contra esa constante
+ * y solo se pueden crear relojes con esa frecuencia.
+ *
+ * @param ticks_per_second Frecuencia del reloj en ticks por segundo.
+ * @param source Fuente de la hora, o NULL para un reloj que solo cuenta los ticks como el que crea ClockCreate.
+ * @return Un puntero al reloj creado o NULL si los parametros son invalidos o no hay memoria disponible.
+ */
+clock_t ClockCreateWithSource(uint16_t ticks_per_second, clock_source_t source);
+
 /**
  * @brief Obtiene la hora actual del reloj.
  *
@@ -125,6 +125,16 @@ bool ClockSetAlarmTime(clock_t clock, const clock_time_t * alarm_time);
  */
 void ClockNewTick(clock_t clock);
 
+/**
+ * @brief Obtiene los segundos que el reloj avanzo con los ticks porque la fuente externa fallo o dejo de cambiar.
+ *
+ * Una fuente que responde pero no cambia durante mas de dos segundos se considera detenida.
+ *
+ * @param clock Puntero al reloj.
+ * @return Cantidad de segundos contados sin la fuente, 0 si el reloj es NULL o no tiene fuente.
+ */
+uint32_t ClockGetSourceFaults(clock_t clock);
+
 /**
  * @brief Obtiene la hora de la alarma del reloj.
  *
@@ -0,0 +1,88 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clock_source.h
+ ** @brief Fuentes externas de la hora del dia para el reloj
+ **
+ ** Sin una fuente externa el reloj cuenta los ticks y la hora se pierde con cada reinicio. Con una fuente, como el
+ ** reloj de tiempo real con bateria del LPC43xx, la hora se recupera apenas se crea el reloj y la fuente pasa a
+ ** determinar el avance de los segundos.
+ **
+ ** ClockSourceRtc se implementa en clock_source_rtc.c para la placa y ClockSourcePosix en
+ ** src/posix/clock_source_posix.c, que solo se compila en la PC para las pruebas y para la edicion sobre FreeRTOS.
+ **/
+
+#ifndef CLOCK_SOURCE_H_
+#define CLOCK_SOURCE_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de segundos en un dia, las horas de las fuentes van de cero a este valor menos uno
+#define CLOCK_SOURCE_SECONDS_PER_DAY 86400
+
+/* === Public data type declarations =============================================================================== */
+
+//! Funciones de acceso a una fuente externa de la hora del dia
+typedef struct clock_source_s {
+    //! Lee la hora en segundos desde la medianoche, devuelve false si la fuente no tiene una hora valida
+    bool (*Read)(uint32_t * seconds);
+    //! Ajusta la hora de la fuente en segundos desde la medianoche, devuelve false si no se pudo ajustar
+    bool (*Write)(uint32_t seconds);
+} const * clock_source_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Prepara el reloj de tiempo real del LPC43xx como fuente de la hora.
+ *
+ * Si el reloj de tiempo real ya estaba funcionando con una hora ajustada se usa sin modificarlo, asi la hora se
+ * recupera en forma inmediata. Solo cuando la bateria se agoto se inicializa desde cero, lo que demora dos segundos.
+ *
+ * @return Un puntero a la fuente de la hora.
+ */
+clock_source_t ClockSourceRtc(void);
+
+/**
+ * @brief Prepara el reloj de tiempo real de la PC como fuente de la hora para las simulaciones.
+ *
+ * La hora comienza siendo la hora local de la PC. Como el reloj de la PC no se puede modificar, ajustar la hora
+ * solo guarda la diferencia con la hora local mientras el programa se ejecuta.
+ *
+ * @return Un puntero a la fuente de la hora.
+ */
+clock_source_t ClockSourcePosix(void);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CLOCK_SOURCE_H_ */
@@ -0,0 +1,104 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file command.h
+ ** @brief Interprete de los comandos que envia el anfitrion por el puerto serie
+ **/
+
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include "clock.h"
+#include "protocol.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+/* === Public data type declarations =============================================================================== */
+
+//! Contadores del sistema que se informan con el comando PROTOCOL_GET_STATUS
+typedef struct command_counters_s {
+    uint16_t missed_ticks;   //!< Ticks perdidos por el planificador
+    uint16_t overruns;       //!< Ejecuciones de las tareas que excedieron su presupuesto
+    uint32_t telemetry_lost; //!< Registros de eventos descartados
+    uint32_t serial_lost;    //!< Bytes recibidos descartados por el puerto serie
+} command_counters_t;
+
+/**
+ * @brief Funcion que envia los bytes de una respuesta sin bloquearse.
+ * @param data Puntero a los bytes que se deben enviar.
+ * @param size Cantidad de bytes que se deben enviar.
+ * @return Cantidad de bytes aceptados.
+ */
+typedef uint16_t (*command_write_t)(const void * data, uint16_t size);
+
+/**
+ * @brief Funcion que obtiene los contadores del sistema.
+ * @param counters Puntero donde se almacenan los contadores.
+ */
+typedef void (*command_counters_get_t)(command_counters_t * counters);
+
+//! Funciones que el interprete utiliza para responder y para informar el estado del sistema
+typedef struct command_driver_s {
+    command_write_t Write;              // Envia las respuestas, es obligatoria
+    command_counters_get_t GetCounters; // Obtiene los contadores, si es NULL se informan en cero
+} const * command_driver_t;
+
+typedef struct command_s * command_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un interprete de comandos que actua sobre un reloj.
+ *
+ * @param clock Reloj que los comandos consultan y configuran.
+ * @param driver Funciones para enviar las respuestas y obtener los contadores.
+ * @return Un puntero al interprete creado o NULL si los parametros son invalidos o no hay memoria disponible.
+ */
+command_t CommandCreate(clock_t clock, command_driver_t driver);
+
+/**
+ * @brief Procesa bytes recibidos del anfitrion.
+ *
+ * Los bytes se decodifican a medida que llegan, por lo que se pueden entregar en bloques de cualquier tamaño. Cada
+ * trama completa y valida se ejecuta y se responde antes de procesar el byte siguiente, y las tramas con errores se
+ * descartan sin respuesta para que el anfitrion repita el pedido.
+ *
+ * @param command Puntero al interprete.
+ * @param data Puntero a los bytes recibidos.
+ * @param size Cantidad de bytes recibidos.
+ */
+void CommandReceive(command_t command, const uint8_t * data, uint16_t size);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMMAND_H_ */
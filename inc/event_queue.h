@@ -0,0 +1,104 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file event_queue.h
+ ** @brief Cola de eventos entre las interrupciones y el lazo principal
+ **/
+
+#ifndef EVENT_QUEUE_H_
+#define EVENT_QUEUE_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de eventos que puede almacenar la cola, debe ser una potencia de dos
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 16
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Evento almacenado en la cola, su significado lo define la aplicacion
+typedef uint8_t event_t;
+
+typedef struct event_queue_s * event_queue_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea una cola de eventos vacia.
+ *
+ * La cola admite un unico productor, por ejemplo las rutinas del temporizador del sistema, y un unico consumidor,
+ * el lazo principal, sin necesidad de deshabilitar las interrupciones.
+ *
+ * @return Un puntero a la cola creada o NULL si no hay memoria disponible.
+ */
+event_queue_t EventQueueCreate(void);
+
+/**
+ * @brief Agrega un evento al final de la cola.
+ *
+ * @param queue Puntero a la cola de eventos.
+ * @param event Evento que se desea agregar.
+ * @return true si el evento se agrego, false si la cola esta llena o es NULL.
+ */
+bool EventQueuePost(event_queue_t queue, event_t event);
+
+/**
+ * @brief Retira el evento mas antiguo de la cola.
+ *
+ * @param queue Puntero a la cola de eventos.
+ * @param event Puntero donde se almacenara el evento retirado.
+ * @return true si se retiro un evento, false si la cola esta vacia o es NULL.
+ */
+bool EventQueueGet(event_queue_t queue, event_t * event);
+
+/**
+ * @brief Indica si la cola no tiene eventos pendientes.
+ *
+ * @param queue Puntero a la cola de eventos.
+ * @return true si la cola esta vacia o es NULL, false si tiene eventos pendientes.
+ */
+bool EventQueueIsEmpty(event_queue_t queue);
+
+/**
+ * @brief Indica la cantidad de eventos que se descartaron porque la cola estaba llena.
+ *
+ * @param queue Puntero a la cola de eventos.
+ * @return Cantidad de eventos descartados desde la creacion de la cola.
+ */
+uint16_t EventQueueGetLost(event_queue_t queue);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_QUEUE_H_ */
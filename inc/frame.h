@@ -0,0 +1,122 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file frame.h
+ ** @brief Tramas con relleno COBS y CRC-16 para los mensajes por el puerto serie
+ **/
+
+#ifndef FRAME_H_
+#define FRAME_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad maxima de bytes de datos de una trama, sin contar el CRC
+#ifndef FRAME_PAYLOAD_MAX
+#define FRAME_PAYLOAD_MAX 64
+#endif
+
+//! Byte que separa las tramas, nunca aparece dentro de una trama codificada
+#define FRAME_DELIMITER 0x00
+
+//! Cantidad de bytes del CRC que se agrega al final de los datos
+#define FRAME_CRC_SIZE 2
+
+//! Longitud maxima de una trama codificada: los datos y el CRC, un byte de COBS cada 254 y el separador
+#define FRAME_ENCODED_MAX (FRAME_PAYLOAD_MAX + FRAME_CRC_SIZE + (FRAME_PAYLOAD_MAX + FRAME_CRC_SIZE) / 254 + 2)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Resultado de entregar un byte recibido al decodificador
+typedef enum {
+    FRAME_INCOMPLETE, // La trama todavia no termino
+    FRAME_READY,      // Se completo una trama valida, sus datos se obtienen con FrameDecoderGetPayload
+    FRAME_ERROR,      // Se completo una trama demasiado larga, truncada o con un CRC incorrecto
+} frame_status_t;
+
+typedef struct frame_decoder_s * frame_decoder_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Calcula el CRC-16 CCITT, con polinomio 0x1021 y valor inicial 0xFFFF, de un bloque de datos.
+ *
+ * @param data Puntero a los datos.
+ * @param size Cantidad de bytes de datos.
+ * @return CRC de los datos.
+ */
+uint16_t FrameCrc(const uint8_t * data, uint16_t size);
+
+/**
+ * @brief Arma una trama con los datos, su CRC, el relleno COBS y el separador final.
+ *
+ * @param payload Puntero a los datos de la trama.
+ * @param size Cantidad de bytes de datos, como maximo FRAME_PAYLOAD_MAX.
+ * @param frame Puntero al buffer donde se escribe la trama, de al menos FRAME_ENCODED_MAX bytes.
+ * @return Cantidad de bytes de la trama, incluido el separador, o cero si los datos son demasiado largos.
+ */
+uint16_t FrameEncode(const uint8_t * payload, uint16_t size, uint8_t * frame);
+
+/**
+ * @brief Crea un decodificador que arma las tramas de a un byte por vez.
+ *
+ * @return Un puntero al decodificador creado o NULL si no hay memoria disponible.
+ */
+frame_decoder_t FrameDecoderCreate(void);
+
+/**
+ * @brief Entrega un byte recibido al decodificador.
+ *
+ * Cada byte se decodifica al recibirlo, por lo que el costo no depende de la longitud de la trama. Los separadores
+ * consecutivos no forman tramas vacias y se ignoran.
+ *
+ * @param decoder Puntero al decodificador.
+ * @param byte Byte recibido.
+ * @return Estado de la trama despues de procesar el byte.
+ */
+frame_status_t FrameDecoderPush(frame_decoder_t decoder, uint8_t byte);
+
+/**
+ * @brief Obtiene los datos de la ultima trama valida, sin el CRC.
+ *
+ * Los datos solo son validos hasta el proximo llamado a FrameDecoderPush.
+ *
+ * @param decoder Puntero al decodificador.
+ * @param size Puntero donde se almacena la cantidad de bytes de datos.
+ * @return Puntero a los datos de la trama, o NULL si el ultimo byte no completo una trama valida.
+ */
+const uint8_t * FrameDecoderGetPayload(frame_decoder_t decoder, uint16_t * size);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FRAME_H_ */
@@ -0,0 +1,98 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file protocol.h
+ ** @brief Codigos y formato de los mensajes del protocolo de comandos por el puerto serie
+ **
+ ** Cada mensaje viaja en una trama del modulo frame. El primer byte de un pedido es el codigo del comando, seguido de
+ ** sus argumentos. La respuesta repite el codigo con el bit PROTOCOL_RESPONSE, sigue con el resultado y, si el
+ ** resultado es PROTOCOL_OK, con los datos del comando. Las horas viajan en binario como horas, minutos y segundos y
+ ** los contadores con el byte mas significativo primero. Este archivo no depende del reloj para que lo puedan
+ ** incluir los programas del anfitrion.
+ **
+ ** Datos de la respuesta al comando PROTOCOL_GET_STATUS, a continuacion de la cabecera:
+ **
+ ** | Byte  | Contenido                                       |
+ ** |-------|-------------------------------------------------|
+ ** | 0     | Banderas PROTOCOL_FLAG_*                        |
+ ** | 1-2   | Tramas recibidas correctamente                  |
+ ** | 3-4   | Tramas descartadas por errores                  |
+ ** | 5-6   | Ticks perdidos por el planificador              |
+ ** | 7-8   | Ejecuciones que excedieron su presupuesto       |
+ ** | 9-12  | Registros de eventos descartados                |
+ ** | 13-16 | Bytes recibidos descartados por el puerto serie |
+ **/
+
+#ifndef PROTOCOL_H_
+#define PROTOCOL_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Bit que distingue una respuesta del pedido que la origino
+#define PROTOCOL_RESPONSE 0x80
+
+//! Bytes de la cabecera de una respuesta: el codigo y el resultado
+#define PROTOCOL_HEADER_SIZE 2
+
+//! Bits del primer byte de la respuesta al comando PROTOCOL_GET_STATUS
+#define PROTOCOL_FLAG_TIME_VALID      0x01 // El reloj tiene una hora valida
+#define PROTOCOL_FLAG_ALARM_ENABLED   0x02 // La alarma esta habilitada
+#define PROTOCOL_FLAG_ALARM_TRIGGERED 0x04 // La alarma esta sonando
+
+//! Bytes de datos de la respuesta al comando PROTOCOL_GET_STATUS
+#define PROTOCOL_STATUS_SIZE 17
+
+/* === Public data type declarations =============================================================================== */
+
+//! Comandos del protocolo, los valores no se pueden cambiar porque los usan los programas del anfitrion
+typedef enum {
+    PROTOCOL_GET_TIME = 0x01,   // Sin argumentos, responde si la hora es valida, horas, minutos y segundos
+    PROTOCOL_SET_TIME = 0x02,   // Recibe horas, minutos y segundos
+    PROTOCOL_GET_ALARM = 0x03,  // Sin argumentos, responde horas, minutos y si la alarma esta habilitada
+    PROTOCOL_SET_ALARM = 0x04,  // Recibe horas, minutos y si la alarma queda habilitada
+    PROTOCOL_PROVISION = 0x05,  // Recibe la hora y la alarma juntas, en el orden de SET_TIME y SET_ALARM
+    PROTOCOL_GET_STATUS = 0x06, // Sin argumentos, responde las banderas PROTOCOL_FLAG_* y los contadores
+} protocol_command_t;
+
+//! Resultados de un comando
+typedef enum {
+    PROTOCOL_OK = 0x00,       // El comando se ejecuto
+    PROTOCOL_UNKNOWN = 0x01,  // El codigo del comando no existe
+    PROTOCOL_INVALID = 0x02,  // La cantidad o los valores de los argumentos son incorrectos
+    PROTOCOL_REJECTED = 0x03, // El reloj rechazo el cambio, por ejemplo habilitar la alarma sin una hora valida
+} protocol_result_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PROTOCOL_H_ */
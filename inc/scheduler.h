@@ -0,0 +1,153 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file scheduler.h
+ ** @brief Planificador cooperativo disparado por tiempo
+ **/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad maxima de tareas que puede administrar un planificador
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 8
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+//! Funcion que ejecuta el trabajo de una tarea, debe terminar sin bloquearse
+typedef void (*scheduler_handler_t)(void * object);
+
+//! Funcion que devuelve el valor de un contador libre utilizado para medir los tiempos de ejecucion
+typedef uint32_t (*scheduler_clock_t)(void);
+
+/**
+ * @brief Descripcion estatica de una tarea del planificador.
+ *
+ * Las tareas se ejecutan hasta completarse en el orden en que aparecen en la tabla, por lo que las primeras tienen
+ * mayor prioridad cuando se activan en el mismo tick.
+ */
+typedef struct scheduler_task_s {
+    const char * name;           //!< Nombre de la tarea para los informes
+    scheduler_handler_t handler; //!< Funcion que se ejecuta en cada activacion
+    void * object;               //!< Puntero que se envia como parametro a la funcion
+    uint16_t period;             //!< Cantidad de ticks entre dos activaciones, debe ser mayor a cero
+    uint16_t offset;             //!< Cantidad de ticks hasta la primera activacion
+    uint32_t budget;             //!< Tiempo de ejecucion maximo permitido, en unidades del contador de tiempo
+} const * scheduler_task_t;
+
+//! Mediciones de una tarea del planificador, los tiempos estan en unidades del contador de tiempo
+typedef struct scheduler_stats_s {
+    uint32_t last;     //!< Duracion de la ultima ejecucion
+    uint32_t worst;    //!< Peor tiempo de ejecucion medido
+    uint32_t runs;     //!< Cantidad de ejecuciones completadas
+    uint16_t overruns; //!< Ejecuciones que excedieron el presupuesto declarado
+    uint16_t skipped;  //!< Activaciones perdidas porque la anterior todavia no se habia ejecutado
+} scheduler_stats_t;
+
+typedef struct scheduler_s * scheduler_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un planificador para una tabla estatica de tareas.
+ *
+ * @param tasks Tabla de tareas, debe permanecer valida mientras se utilice el planificador.
+ * @param count Cantidad de tareas en la tabla, como maximo SCHEDULER_MAX_TASKS.
+ * @param clock Funcion que devuelve el contador de tiempo utilizado para medir las ejecuciones.
+ * @return Un puntero al planificador creado o NULL si los parametros son invalidos o no hay memoria disponible.
+ */
+scheduler_t SchedulerCreate(const struct scheduler_task_s * tasks, uint8_t count, scheduler_clock_t clock);
+
+/**
+ * @brief Registra un nuevo tick del sistema.
+ *
+ * Solo incrementa un contador, por lo que puede llamarse desde la rutina de servicio del temporizador sin
+ * deshabilitar las interrupciones.
+ *
+ * @param scheduler Puntero al planificador.
+ */
+void SchedulerTick(scheduler_t scheduler);
+
+/**
+ * @brief Indica si hay ticks registrados que todavia no fueron atendidos.
+ *
+ * @param scheduler Puntero al planificador.
+ * @return true si el despachador tiene trabajo pendiente, false en caso contrario o si el planificador es NULL.
+ */
+bool SchedulerHasPending(scheduler_t scheduler);
+
+/**
+ * @brief Activa las tareas que corresponden a los ticks pendientes y ejecuta cada una hasta completarla.
+ *
+ * Se debe llamar desde el lazo principal. Si se acumulo mas de un tick desde la llamada anterior, los ticks
+ * adicionales se cuentan como perdidos porque las tareas del tick anterior no terminaron a tiempo.
+ *
+ * @param scheduler Puntero al planificador.
+ * @return true si se atendio al menos un tick, false si no habia ticks pendientes o el planificador es NULL.
+ */
+bool SchedulerDispatch(scheduler_t scheduler);
+
+/**
+ * @brief Obtiene las mediciones de una tarea.
+ *
+ * @param scheduler Puntero al planificador.
+ * @param index Posicion de la tarea en la tabla.
+ * @param stats Puntero donde se almacenaran las mediciones.
+ * @return true si la operacion fue exitosa, false si la tarea no existe o algun puntero es NULL.
+ */
+bool SchedulerGetStats(scheduler_t scheduler, uint8_t index, scheduler_stats_t * stats);
+
+/**
+ * @brief Indica la cantidad de ticks en los que el despachador no alcanzo a ejecutar las tareas a tiempo.
+ *
+ * @param scheduler Puntero al planificador.
+ * @return Cantidad de ticks perdidos desde la creacion del planificador.
+ */
+uint16_t SchedulerGetMissedTicks(scheduler_t scheduler);
+
+/**
+ * @brief Verifica que todas las tareas cumplieron con sus presupuestos y periodos.
+ *
+ * @param scheduler Puntero al planificador.
+ * @return true si ninguna tarea excedio su presupuesto ni perdio activaciones y no se perdieron ticks, false en
+ * caso contrario o si el planificador es NULL.
+ */
+bool SchedulerIsSchedulable(scheduler_t scheduler);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULER_H_ */
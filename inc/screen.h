@@ -46,6 +46,21 @@ extern "C" {
 #define SEGMENT_G (1 << 6)
 #define SEGMENT_P (1 << 7)
 
+/*
+ * Con SCREEN_STATIC_CONFIG definido la cantidad de digitos y la frecuencia de parpadeo se fijan al compilar y la
+ * pantalla llama directamente a las funciones ScreenDigitsTurnOff, ScreenSegmentsUpdate y ScreenDigitTurnOn que
+ * implementa la placa, en lugar de usar el controlador recibido al crearla. Sin definirlo todo se configura al crear la
+ * pantalla.
+ */
+#ifdef SCREEN_STATIC_CONFIG
+#ifndef SCREEN_STATIC_DIGITS
+#define SCREEN_STATIC_DIGITS 4 //!< Cantidad de digitos de la pantalla con la configuracion fija
+#endif
+#ifndef SCREEN_STATIC_FLASH_DIVISOR
+#define SCREEN_STATIC_FLASH_DIVISOR 100 //!< Unico divisor de parpadeo aceptado con la configuracion fija
+#endif
+#endif
+
 /* === Public data type declarations =============================================================================== */
 
 /*
@@ -92,12 +107,24 @@ typedef struct screen_driver_s {
 
 /* === Public function declarations ================================================================================ */
 
+#ifdef SCREEN_STATIC_CONFIG
+//! Apaga todos los digitos, la implementa la placa cuando la configuracion de la pantalla es fija
+void ScreenDigitsTurnOff(void);
+
+//! Actualiza los segmentos del digito encendido, la implementa la placa cuando la configuracion de la pantalla es fija
+void ScreenSegmentsUpdate(uint8_t segments);
+
+//! Enciende un digito, la implementa la placa cuando la configuracion de la pantalla es fija
+void ScreenDigitTurnOn(uint8_t digit);
+#endif
+
 /**
  * @brief Crea e instancia una pantalla de 7 segmentos.
  * @param digits Número de dígitos en la pantalla.
  * @param dots Número de puntos en la pantalla.
- * @param driver Controlador de pantalla.
- * @return Un identificador para la pantalla creada.
+ * @param driver Controlador de pantalla, no se utiliza con SCREEN_STATIC_CONFIG.
+ * @return Un identificador para la pantalla creada, o NULL si con SCREEN_STATIC_CONFIG la cantidad de digitos no
+ * coincide con SCREEN_STATIC_DIGITS.
  */
 screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver);
 
@@ -107,7 +134,7 @@ screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver);
  * @param value Valor a escribir en formato BCD.
  * @param size Número de dígitos a escribir.
  */
-void ScreenWriteBCD(screen_t screen, uint8_t * value, uint8_t size);
+void ScreenWriteBCD(screen_t screen, const uint8_t * value, uint8_t size);
 
 /**
  * @brief Escribe un punto decimal en la pantalla de 7 segmentos.
@@ -117,7 +144,7 @@ void ScreenWriteBCD(screen_t screen, uint8_t * value, uint8_t size);
  * @param value_dot Puntero al valor a escribir en formato decimal.
  * @param size Número de dígitos a escribir.
  */
-void ScreenWriteDOT(screen_t screen, uint8_t * value_dot, uint8_t size);
+void ScreenWriteDOT(screen_t screen, const uint8_t * value_dot, uint8_t size);
 
 /**
  * @brief refresca la pantalla de 7 segmentos.
@@ -128,6 +155,8 @@ void ScreenRefresh(screen_t screen); //
 /**
  * @brief Apaga todos los dígitos de la pantalla.
  * @param screen Identificador de la pantalla.
+ * @note Con SCREEN_STATIC_CONFIG el divisor solo puede ser cero, para detener el parpadeo, o
+ * SCREEN_STATIC_FLASH_DIVISOR.
  */
 int DisplayFlashDigits(screen_t screen, uint8_t from, uint8_t to, uint16_t divisor);
 
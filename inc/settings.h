@@ -0,0 +1,101 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file settings.h
+ ** @brief Almacenamiento no volatil de la configuracion del reloj despertador
+ **/
+
+#ifndef SETTINGS_H_
+#define SETTINGS_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include "clock.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de bytes que ocupa cada registro de la configuracion en la memoria no volatil
+#define SETTINGS_RECORD_SIZE 16
+
+/* === Public data type declarations =============================================================================== */
+
+//! Configuracion que se conserva cuando se corta la alimentacion
+typedef struct settings_s {
+    clock_time_t alarm;  //!< Hora de la alarma
+    bool alarm_enabled;  //!< La alarma esta habilitada
+    uint8_t brightness;  //!< Brillo de la pantalla, en porcentaje
+    int16_t calibration; //!< Correccion de la frecuencia del reloj, en partes por millon
+} settings_t;
+
+typedef struct settings_store_s * settings_store_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un almacen de configuracion en una region de la memoria no volatil y recupera el ultimo registro.
+ *
+ * La region se usa como un diario circular de registros de longitud fija con un numero de secuencia y un CRC. Cada
+ * nuevo registro se escribe en la posicion siguiente al anterior, por lo que el desgaste se reparte por igual entre
+ * todas las paginas de la region. Como la posicion de cada registro depende solo de su numero de secuencia, el
+ * ultimo se encuentra con una busqueda binaria que lee como maximo log2 de la cantidad de posiciones mas dos
+ * registros, sin importar cuantas veces se haya escrito la memoria. Un corte de alimentacion durante una escritura
+ * solo puede corromper el registro que se estaba escribiendo, que se descarta por su CRC.
+ *
+ * @param offset Posicion del comienzo de la region, debe ser multiplo de SETTINGS_RECORD_SIZE.
+ * @param size Cantidad de bytes de la region, debe alcanzar al menos para dos registros.
+ * @return Un puntero al almacen creado o NULL si la region es invalida, no se puede leer o no hay memoria disponible.
+ */
+settings_store_t SettingsStoreCreate(uint32_t offset, uint32_t size);
+
+/**
+ * @brief Obtiene la ultima configuracion guardada.
+ *
+ * @param store Puntero al almacen de configuracion.
+ * @param settings Puntero donde se almacenara la configuracion.
+ * @return true si habia una configuracion guardada, false si la region esta vacia o algun puntero es NULL.
+ */
+bool SettingsLoad(settings_store_t store, settings_t * settings);
+
+/**
+ * @brief Guarda una nueva configuracion agregando un registro al diario.
+ *
+ * Si la configuracion es igual a la ultima guardada no se escribe nada, para no desgastar la memoria.
+ *
+ * @param store Puntero al almacen de configuracion.
+ * @param settings Puntero a la configuracion que se desea guardar.
+ * @return true si la configuracion quedo guardada, false si la hora de la alarma es invalida, algun puntero es
+ * NULL, la memoria todavia esta programando una escritura anterior o la escritura fallo.
+ */
+bool SettingsSave(settings_store_t store, const settings_t * settings);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SETTINGS_H_ */
@@ -0,0 +1,138 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file telemetry.h
+ ** @brief Registro binario de eventos del reloj para su envio por el puerto serie
+ **/
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de bytes del buffer circular de registros, debe ser una potencia de dos
+#ifndef TELEMETRY_BUFFER_SIZE
+#define TELEMETRY_BUFFER_SIZE 512
+#endif
+
+//! Version del formato de los registros, se envia como valor del registro TELEMETRY_START
+#define TELEMETRY_VERSION 1
+
+//! Longitud maxima de un registro: el tipo y dos enteros de 32 bits codificados en base 128
+#define TELEMETRY_RECORD_MAX 11
+
+/* === Public data type declarations =============================================================================== */
+
+/**
+ * @brief Tipos de registro, el significado del valor de cada registro lo define la aplicacion.
+ *
+ * Cada registro se codifica como un byte con el tipo, seguido del tiempo transcurrido desde el registro anterior y
+ * del valor, ambos como enteros sin signo en base 128 con el bit mas significativo de cada byte indicando que el
+ * numero continua. Los tipos nuevos se agregan antes de TELEMETRY_TYPES para no cambiar los existentes.
+ */
+typedef enum {
+    TELEMETRY_START,        // Comienzo del registro despues de un reinicio, el valor es TELEMETRY_VERSION
+    TELEMETRY_LOST,         // Registros descartados porque el buffer estaba lleno, el valor es la cantidad
+    TELEMETRY_MODE,         // Cambio de modo de la interfaz, el valor es el nuevo modo
+    TELEMETRY_KEY,          // Tecla presionada, el valor es el evento de la interfaz
+    TELEMETRY_ALARM,        // La alarma comenzo a sonar, el valor es la hora en minutos desde la medianoche
+    TELEMETRY_SNOOZE,       // La alarma se pospuso, el valor son los minutos de la postergacion
+    TELEMETRY_CANCEL,       // La alarma se cancelo hasta el dia siguiente
+    TELEMETRY_MISSED_TICKS, // Se perdieron ticks del planificador, el valor es el total acumulado
+    TELEMETRY_OVERRUN,      // Una tarea excedio su presupuesto, el valor es su posicion en la tabla
+    TELEMETRY_TYPES,        // Cantidad de tipos, no es un tipo valido
+} telemetry_type_t;
+
+//! Funcion que devuelve el tiempo actual en milisegundos, el contador puede desbordar libremente
+typedef uint32_t (*telemetry_clock_t)(void);
+
+/**
+ * @brief Funcion que envia los bytes de los registros sin bloquearse.
+ * @param data Puntero a los bytes que se deben enviar.
+ * @param size Cantidad de bytes que se deben enviar.
+ * @return Cantidad de bytes aceptados, puede ser menor a size si el medio no tiene espacio disponible.
+ */
+typedef uint16_t (*telemetry_writer_t)(const void * data, uint16_t size);
+
+typedef struct telemetry_s * telemetry_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea un registro de eventos vacio y agrega el registro TELEMETRY_START.
+ *
+ * La memoria se reserva solo al crear el registro, agregar y enviar registros no reserva memoria. El registro
+ * admite un unico productor y un unico consumidor, ambos en el lazo principal.
+ *
+ * @param clock Funcion que devuelve el tiempo con el que se marcan los registros.
+ * @return Un puntero al registro creado o NULL si el reloj es NULL o no hay memoria disponible.
+ */
+telemetry_t TelemetryCreate(telemetry_clock_t clock);
+
+/**
+ * @brief Codifica un registro al final del buffer circular.
+ *
+ * Si el buffer no tiene espacio el registro se descarta y se cuenta, y la cantidad de descartados se informa con un
+ * registro TELEMETRY_LOST antes del siguiente registro que se pueda agregar.
+ *
+ * @param telemetry Puntero al registro de eventos.
+ * @param type Tipo del registro.
+ * @param value Valor del registro.
+ * @return true si el registro se agrego, false si se descarto, el tipo es invalido o el puntero es NULL.
+ */
+bool TelemetryLog(telemetry_t telemetry, telemetry_type_t type, uint32_t value);
+
+/**
+ * @brief Entrega los bytes pendientes a una funcion de envio, en hasta dos bloques contiguos.
+ *
+ * Los bytes que la funcion no acepta quedan pendientes para la proxima llamada, por lo que un registro puede
+ * enviarse en partes.
+ *
+ * @param telemetry Puntero al registro de eventos.
+ * @param writer Funcion que envia los bytes.
+ * @return Cantidad de bytes enviados.
+ */
+uint16_t TelemetryDrain(telemetry_t telemetry, telemetry_writer_t writer);
+
+/**
+ * @brief Indica la cantidad de registros descartados porque el buffer estaba lleno.
+ *
+ * @param telemetry Puntero al registro de eventos.
+ * @return Cantidad de registros descartados desde la creacion del registro de eventos.
+ */
+uint32_t TelemetryGetLost(telemetry_t telemetry);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H_ */
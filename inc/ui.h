@@ -0,0 +1,156 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file ui.h
+ ** @brief Maquina de estados de la interfaz de usuario del reloj despertador
+ **/
+
+#ifndef UI_H_
+#define UI_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+#include "clock.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de digitos que muestra la interfaz
+#define UI_DIGITS 4
+
+//! Minutos que se pospone la alarma al aceptarla
+#ifndef UI_SNOOZE_MINUTES
+#define UI_SNOOZE_MINUTES 5
+#endif
+
+/* === Public data type declarations =============================================================================== */
+
+/** @brief Modo del sistema para la configuración del reloj y la alarma.
+ *
+ * Cada modo es una fila de la tabla de transiciones de la interfaz, por lo que agregar un modo nuevo consiste en
+ * agregar su valor antes de MODE_COUNT y completar su fila en la tabla.
+ */
+typedef enum {
+    MODE_UNSET,             // El reloj todavia no tiene una hora valida
+    MODE_HOME,              // Modo de visualización del tiempo actual
+    MODE_SET_TIME_MINUTES,  // Ajuste de los minutos de la hora actual
+    MODE_SET_TIME_HOURS,    // Ajuste de las horas de la hora actual
+    MODE_SET_ALARM_MINUTES, // Ajuste de los minutos de la alarma
+    MODE_SET_ALARM_HOURS,   // Ajuste de las horas de la alarma
+    MODE_ALARM_TRIGGERED,   // Modo alarma activada
+    MODE_COUNT,             // Cantidad de modos, no es un modo valido
+} system_mode_t;
+
+//! Eventos que recibe la interfaz, cada uno es una columna de la tabla de transiciones
+typedef enum {
+    EVENT_KEY_SET_TIME,
+    EVENT_KEY_SET_ALARM,
+    EVENT_KEY_DECREMENT,
+    EVENT_KEY_INCREMENT,
+    EVENT_KEY_ACCEPT,
+    EVENT_KEY_CANCEL,
+    EVENT_CLOCK_SECOND, // La hora actual avanzo un segundo
+    EVENT_COUNT,        // Cantidad de eventos, no es un evento valido
+} ui_event_t;
+
+/**
+ * @brief Funcion que hace parpadear un rango de digitos de la pantalla.
+ * @param from Primer digito que parpadea.
+ * @param to Ultimo digito que parpadea.
+ * @param divisor Periodo del parpadeo, cero para dejar de parpadear.
+ */
+typedef void (*ui_flash_digits_t)(uint8_t from, uint8_t to, uint16_t divisor);
+
+/**
+ * @brief Funcion que enciende o apaga el indicador de alarma sonando.
+ * @param active true para encender el indicador, false para apagarlo.
+ */
+typedef void (*ui_alarm_indicator_t)(bool active);
+
+//! Funciones que la interfaz utiliza para actuar sobre el hardware
+typedef struct ui_driver_s {
+    ui_flash_digits_t FlashDigits;       // Configura el parpadeo de los digitos
+    ui_alarm_indicator_t AlarmIndicator; // Enciende o apaga el indicador de alarma
+} const * ui_driver_t;
+
+typedef struct ui_s * ui_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Crea la interfaz de usuario en el modo MODE_UNSET.
+ *
+ * Si el reloj ya tiene una hora valida, por ejemplo porque su fuente la conservo durante un corte de energia, la
+ * interfaz comienza directamente en el modo MODE_HOME.
+ *
+ * @param clock Reloj que la interfaz consulta y configura.
+ * @param driver Funciones para actuar sobre la pantalla y el indicador de alarma.
+ * @return Un puntero a la interfaz creada o NULL si los parametros son invalidos o no hay memoria disponible.
+ */
+ui_t UiCreate(clock_t clock, ui_driver_t driver);
+
+/**
+ * @brief Procesa un evento en el modo actual de la interfaz.
+ *
+ * El procesamiento consiste en una unica busqueda en la tabla de transiciones, seguida de la accion asociada y, si
+ * corresponde, de las acciones de salida y entrada de los modos involucrados.
+ *
+ * @param ui Puntero a la interfaz.
+ * @param event Evento que se desea procesar.
+ */
+void UiProcessEvent(ui_t ui, ui_event_t event);
+
+/**
+ * @brief Obtiene el modo actual de la interfaz.
+ *
+ * @param ui Puntero a la interfaz.
+ * @return El modo actual, o MODE_COUNT si la interfaz es NULL.
+ */
+system_mode_t UiGetMode(ui_t ui);
+
+/**
+ * @brief Obtiene los digitos que la interfaz desea mostrar, en BCD y de izquierda a derecha.
+ *
+ * @param ui Puntero a la interfaz.
+ * @return Arreglo de UI_DIGITS digitos, o NULL si la interfaz es NULL.
+ */
+const uint8_t * UiGetDigits(ui_t ui);
+
+/**
+ * @brief Obtiene los puntos que la interfaz desea mostrar, uno por digito.
+ *
+ * @param ui Puntero a la interfaz.
+ * @return Arreglo de UI_DIGITS puntos, o NULL si la interfaz es NULL.
+ */
+const uint8_t * UiGetDots(ui_t ui);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_H_ */
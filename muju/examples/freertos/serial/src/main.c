@@ -0,0 +1,128 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Sample of the buffered serial ports with a zero copy loopback
+ **
+ ** Every received byte is sent back. The received data is read directly into the transmission
+ ** buffer, so it is copied only by the interrupts. On POSIX the throughput can be measured from
+ ** the host with module/serial/tools/serial_throughput.py and the pseudo terminal printed at start.
+ **
+ ** @addtogroup sample-serial Serial Sample
+ ** @ingroup samples
+ ** @brief Samples applications with MUJU Framwork
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "board.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "serial.h"
+
+/* === Macros definitions ====================================================================== */
+
+#define CONSOLE_BITRATE 115200
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to send back the data received by a serial port
+ *
+ * @param  object   Pointer to the serial port descriptor, used as parameter when task created
+ */
+static void LoopbackTask(void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+static const struct hal_sci_line_s console_line = {
+    .baud_rate = CONSOLE_BITRATE,
+    .data_bits = 8,
+    .parity = HAL_SCI_NO_PARITY,
+};
+
+/* === Private function implementation ========================================================= */
+
+static void LoopbackTask(void * object) {
+    serial_t serial = object;
+    uint8_t * buffer;
+    uint16_t size;
+
+    while (true) {
+        size = SerialReserve(serial, &buffer, 256, portMAX_DELAY);
+        SerialCommit(serial, SerialRead(serial, buffer, size, portMAX_DELAY));
+    }
+}
+
+/* === Public function implementation ========================================================= */
+
+int main(void) {
+    struct serial_config_s config = {
+        .line = &console_line,
+        .output_size = 1024,
+        .input_size = 1024,
+    };
+#ifdef EDU_CIAA_NXP
+    struct hal_sci_pins_s console_pins = {
+        .txd_pin = HAL_PIN_P7_1,
+        .rxd_pin = HAL_PIN_P7_2,
+    };
+#endif
+    serial_t serial;
+
+    /* Inicializaciones y configuraciones de dispositivos */
+    BoardSetup();
+
+#ifdef EDU_CIAA_NXP
+    config.sci = HAL_SCI_USART2;
+    config.pins = &console_pins;
+#endif
+    serial = SerialCreate(&config);
+
+    /* Creación de las tareas */
+    if (serial != NULL) {
+        xTaskCreate(LoopbackTask, "Loopback", 256, serial, tskIDLE_PRIORITY + 1, NULL);
+    }
+
+    /* Arranque del sistema operativo */
+    vTaskStartScheduler();
+
+    /* vTaskStartScheduler solo retorna si se detiene el sistema operativo */
+    while (true) {
+    }
+
+    /* El valor de retorno es solo para evitar errores en el compilador*/
+    return 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
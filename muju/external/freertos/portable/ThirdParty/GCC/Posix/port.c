@@ -525,7 +525,7 @@ int iRet;
      * will be unblocked.
      */
     (void)pthread_sigmask( SIG_SETMASK, &xAllSignals,
-                           *&xSchedulerOriginalSignalMask );
+                           &xSchedulerOriginalSignalMask );
 
     /* SIG_RESUME is only used with sigwait() so doesn't need a
        handler. */
@@ -553,10 +553,10 @@ int iRet;
 
 unsigned long ulPortGetRunTime( void )
 {
-struct tms xTimes;
-
-    times( &xTimes );
-
-    return ( unsigned long ) xTimes.tms_utime;
+    /* Elapsed time in microseconds since the scheduler started. Only one task
+     * thread runs at a time, so the time between two context switches belongs
+     * to the running task. The process CPU time has a resolution too coarse
+     * to measure the tasks. */
+    return ( unsigned long ) ( ( prvGetTimeNs() - prvStartTimeNs ) / 1000ull );
 }
 /*-----------------------------------------------------------*/
@@ -0,0 +1,226 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef FREERTOS_TRACE_H
+#define FREERTOS_TRACE_H
+
+/** @file
+ ** @brief FreeRTOS run time counter and trace hooks declarations
+ **
+ ** This file must be included at the end of FreeRTOSConfig.h, with configUSE_TRACE_FACILITY and
+ ** configGENERATE_RUN_TIME_STATS set to 1. It defines the kernel trace macros that record the task
+ ** switches, the tasks made ready and the queue operations into a binary ring buffer, and on
+ ** hardware targets it provides the run time counter used by the kernel statistics.
+ **
+ ** The trace buffer is a memory image that can be saved with TraceSnapshot or dumped from the
+ ** debugger, and decoded in the host with tools/trace_decode.py.
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS add-ons
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/**
+ * @brief Macro to configure the number of records in the trace buffer, must be a power of two
+ */
+#ifndef TRACE_RECORDS
+#define TRACE_RECORDS 1024
+#endif
+
+/**
+ * @brief Macro to configure the number of task names kept in the trace buffer
+ */
+#ifndef TRACE_TASKS
+#define TRACE_TASKS 16
+#endif
+
+/**
+ * @brief Frequency of the run time counter and the trace timestamps, in Hertz
+ */
+#define TRACE_TIMER_FREQUENCY 1000000UL
+
+/**
+ * @brief Length of each task name in the trace buffer, rounded to keep the records aligned
+ */
+#define TRACE_NAME_LENGTH ((configMAX_TASK_NAME_LEN + 3) & ~3)
+
+/**
+ * @brief Magic number at the start of the trace buffer, the text FRTR in little endian
+ */
+#define TRACE_MAGIC 0x52545246UL
+
+/**
+ * @brief Version of the trace buffer layout expected by the host decoder
+ */
+#define TRACE_VERSION 1
+
+/* The POSIX port already provides a run time counter based on CLOCK_MONOTONIC */
+#ifndef POSIX
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() TraceTimerStart()
+#define portGET_RUN_TIME_COUNTER_VALUE()         TraceTimerRead()
+#endif
+
+/* Kernel trace hooks, expanded inside tasks.c and queue.c where the control blocks are visible */
+#define traceTASK_CREATE(pxNewTCB) TraceTaskCreated((pxNewTCB)->uxTCBNumber, (pxNewTCB)->pcTaskName)
+#define traceTASK_SWITCHED_IN()    TraceRecord(TRACE_TASK_SWITCHED_IN, pxCurrentTCB->uxTCBNumber)
+#define traceTASK_SWITCHED_OUT()   TraceRecord(TRACE_TASK_SWITCHED_OUT, pxCurrentTCB->uxTCBNumber)
+
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB) TraceRecord(TRACE_TASK_READY, (pxTCB)->uxTCBNumber)
+
+#define TRACE_QUEUE(event, pxQueue) TraceRecord((event), (pxQueue)->uxQueueNumber)
+
+#define traceQUEUE_SEND(pxQueue)                 TRACE_QUEUE(TRACE_QUEUE_SEND, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)        TRACE_QUEUE(TRACE_QUEUE_SEND, pxQueue)
+#define traceQUEUE_SEND_FAILED(pxQueue)          TRACE_QUEUE(TRACE_QUEUE_SEND_FAILED, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR_FAILED(pxQueue) TRACE_QUEUE(TRACE_QUEUE_SEND_FAILED, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)              TRACE_QUEUE(TRACE_QUEUE_RECEIVE, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)     TRACE_QUEUE(TRACE_QUEUE_RECEIVE, pxQueue)
+#define traceQUEUE_RECEIVE_FAILED(pxQueue)       TRACE_QUEUE(TRACE_QUEUE_RECEIVE_FAILED, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)     TRACE_QUEUE(TRACE_QUEUE_BLOCK_SEND, pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)  TRACE_QUEUE(TRACE_QUEUE_BLOCK_RECEIVE, pxQueue)
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Kernel events stored in the trace buffer
+ */
+typedef enum trace_event_e {
+    TRACE_TASK_SWITCHED_IN = 1, /**< The task starts running, the object is the task number */
+    TRACE_TASK_SWITCHED_OUT,    /**< The task stops running, the object is the task number */
+    TRACE_TASK_READY,           /**< The task is moved to the ready list */
+    TRACE_QUEUE_SEND,           /**< An item was sent to the queue, the object is its number */
+    TRACE_QUEUE_SEND_FAILED,    /**< The queue was full and the send timed out */
+    TRACE_QUEUE_RECEIVE,        /**< An item was received from the queue */
+    TRACE_QUEUE_RECEIVE_FAILED, /**< The queue was empty and the receive timed out */
+    TRACE_QUEUE_BLOCK_SEND,     /**< The running task blocks waiting for space in the queue */
+    TRACE_QUEUE_BLOCK_RECEIVE,  /**< The running task blocks waiting for an item in the queue */
+} trace_event_t;
+
+/**
+ * @brief Record of a kernel event in the trace buffer
+ */
+typedef struct trace_record_s {
+    uint32_t time;   /**< Value of the run time counter when the event occurred */
+    uint8_t event;   /**< Kind of the event, one of the trace_event_t values */
+    uint8_t unused;  /**< Padding to keep the layout of the record explicit */
+    uint16_t object; /**< Number of the task or the queue involved in the event */
+} trace_record_t;
+
+/**
+ * @brief Memory image with the trace ring buffer, its layout is read by the host decoder
+ */
+typedef struct trace_buffer_s {
+    uint32_t magic;                             /**< Always TRACE_MAGIC */
+    uint16_t version;                           /**< Always TRACE_VERSION */
+    uint16_t record_size;                       /**< Size in bytes of each record */
+    uint32_t capacity;                          /**< Number of records in the ring */
+    uint32_t frequency;                         /**< Frequency of the timestamps in Hertz */
+    uint32_t head;                              /**< Number of records written since start */
+    uint16_t tasks;                             /**< Number of task names kept */
+    uint16_t name_length;                       /**< Length of each task name */
+    uint32_t switches[TRACE_TASKS];             /**< Context switches into each task slot */
+    char names[TRACE_TASKS][TRACE_NAME_LENGTH]; /**< Task names by number modulo tasks */
+    trace_record_t records[TRACE_RECORDS];      /**< Ring, oldest record at head modulo capacity */
+} trace_buffer_t;
+
+/**
+ * @brief Callback function to write a block of the trace snapshot
+ *
+ * @param  object   Pointer to user data sended as parameter in the snapshot call
+ * @param  data     Pointer to the block of data to write
+ * @param  size     Number of bytes in the block
+ */
+typedef void (*trace_write_t)(void * object, const void * data, uint32_t size);
+
+/* === Public variable declarations ============================================================ */
+
+/**
+ * @brief Trace ring buffer, can be dumped from the debugger with its size as a snapshot
+ */
+extern trace_buffer_t trace_buffer;
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to record a kernel event, called from the trace hooks
+ *
+ * The kernel calls the hooks with the interrupts that can use its API masked, so the records
+ * are written without any additional locking.
+ *
+ * @param  event    Kind of the event, one of the trace_event_t values
+ * @param  object   Number of the task or the queue involved in the event
+ */
+void TraceRecord(uint8_t event, uint16_t object);
+
+/**
+ * @brief Function to keep the name of a new task, called from the task creation hook
+ *
+ * @param  number   Number assigned by the kernel to the task
+ * @param  name     Name of the task
+ */
+void TraceTaskCreated(uint32_t number, const char * name);
+
+/**
+ * @brief Function to write a consistent copy of the trace buffer
+ *
+ * The recording is paused while the buffer is written, the events in that period are lost.
+ *
+ * @param  write    Function to call with each block of the buffer
+ * @param  object   Pointer to user data sended as parameter in write calls
+ */
+void TraceSnapshot(trace_write_t write, void * object);
+
+/**
+ * @brief Function to start the hardware timer used as run time counter
+ */
+void TraceTimerStart(void);
+
+/**
+ * @brief Function to read the hardware timer used as run time counter
+ *
+ * @return uint32_t Current value of the counter, in TRACE_TIMER_FREQUENCY units
+ */
+uint32_t TraceTimerRead(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* FREERTOS_TRACE_H */
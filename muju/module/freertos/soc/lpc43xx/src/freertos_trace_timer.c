@@ -0,0 +1,73 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Run time counter of the FreeRTOS trace add-on for LPC43xx
+ **
+ ** The counter is the timer 3 running free at TRACE_TIMER_FREQUENCY, so the statistics and the
+ ** timestamps are in microseconds as in the POSIX port and the DWT cycle counter stays available
+ ** for other uses.
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS add-ons
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "FreeRTOS.h"
+#include "freertos_trace.h"
+#include "chip.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void TraceTimerStart(void) {
+    Chip_TIMER_Init(LPC_TIMER3);
+    Chip_TIMER_Reset(LPC_TIMER3);
+    Chip_TIMER_PrescaleSet(LPC_TIMER3,
+                           Chip_Clock_GetRate(CLK_MX_TIMER3) / TRACE_TIMER_FREQUENCY - 1);
+    Chip_TIMER_Enable(LPC_TIMER3);
+}
+
+uint32_t TraceTimerRead(void) {
+    return Chip_TIMER_ReadCount(LPC_TIMER3);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,129 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief FreeRTOS trace hooks implementation
+ **
+ ** @addtogroup freertos FreeRTOS
+ ** @brief FreeRTOS add-ons
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "freertos_trace.h"
+
+/* === Macros definitions ====================================================================== */
+
+#if (TRACE_RECORDS & (TRACE_RECORDS - 1)) != 0
+#error "TRACE_RECORDS must be a power of two"
+#endif
+
+#if (configUSE_TRACE_FACILITY != 1) || (configGENERATE_RUN_TIME_STATS != 1)
+#error "The trace add-on requires configUSE_TRACE_FACILITY and configGENERATE_RUN_TIME_STATS"
+#endif
+
+/**
+ * @brief Mask to convert the free running head counter into a position of the ring
+ */
+#define TRACE_MASK (TRACE_RECORDS - 1)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+trace_buffer_t trace_buffer = {
+    .magic = TRACE_MAGIC,
+    .version = TRACE_VERSION,
+    .record_size = sizeof(trace_record_t),
+    .capacity = TRACE_RECORDS,
+    .frequency = TRACE_TIMER_FREQUENCY,
+    .tasks = TRACE_TASKS,
+    .name_length = TRACE_NAME_LENGTH,
+};
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Flag to pause the recording while a snapshot is written
+ */
+static volatile uint8_t paused = 0;
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void TraceRecord(uint8_t event, uint16_t object) {
+    trace_record_t * record;
+
+    if (paused) {
+        return;
+    }
+    if (event == TRACE_TASK_SWITCHED_IN) {
+        trace_buffer.switches[object % TRACE_TASKS]++;
+    }
+
+    record = &trace_buffer.records[trace_buffer.head & TRACE_MASK];
+    record->time = portGET_RUN_TIME_COUNTER_VALUE();
+    record->event = event;
+    record->unused = 0;
+    record->object = object;
+    trace_buffer.head++;
+}
+
+void TraceTaskCreated(uint32_t number, const char * name) {
+    char * slot = trace_buffer.names[number % TRACE_TASKS];
+    uint8_t index;
+
+    for (index = 0; (index < TRACE_NAME_LENGTH - 1) && (name[index] != 0); index++) {
+        slot[index] = name[index];
+    }
+    for (; index < TRACE_NAME_LENGTH; index++) {
+        slot[index] = 0;
+    }
+}
+
+void TraceSnapshot(trace_write_t write, void * object) {
+    if (write == NULL) {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    paused = 1;
+    taskEXIT_CRITICAL();
+
+    write(object, &trace_buffer, sizeof(trace_buffer));
+
+    paused = 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
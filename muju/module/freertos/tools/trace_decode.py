@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+"""Decodes a snapshot of the FreeRTOS trace buffer and prints the task utilization, the context
+switches, the ready to running latency histograms and the queue activity.
+
+The snapshot is the memory image of trace_buffer, written by TraceSnapshot or dumped from the
+debugger with: dump binary value trace.bin trace_buffer
+"""
+
+import argparse
+import struct
+import sys
+
+TRACE_MAGIC = 0x52545246
+TRACE_VERSION = 1
+
+HEADER = struct.Struct("<IHHIIIHH")
+RECORD = struct.Struct("<IBBH")
+
+TASK_SWITCHED_IN = 1
+TASK_SWITCHED_OUT = 2
+TASK_READY = 3
+QUEUE_EVENTS = {
+    4: "send",
+    5: "send failed",
+    6: "receive",
+    7: "receive failed",
+    8: "block send",
+    9: "block receive",
+}
+
+HISTOGRAM_BUCKETS = 12
+
+
+def load(path):
+    """Reads the snapshot and returns the header fields, the task names and the records in
+    chronological order with their timestamps unwrapped to 64 bits"""
+    with open(path, "rb") as file:
+        data = file.read()
+
+    if len(data) < HEADER.size:
+        sys.exit(f"{path}: file too short for a trace snapshot")
+    magic, version, record_size, capacity, frequency, head, tasks, name_length = HEADER.unpack_from(
+        data, 0
+    )
+    if magic != TRACE_MAGIC or version != TRACE_VERSION or record_size != RECORD.size:
+        sys.exit(f"{path}: not a trace snapshot of version {TRACE_VERSION}")
+
+    offset = HEADER.size
+    switches = struct.unpack_from(f"<{tasks}I", data, offset)
+    offset += 4 * tasks
+    names = {}
+    for slot in range(tasks):
+        raw = data[offset + slot * name_length : offset + (slot + 1) * name_length]
+        name = raw.split(b"\0", 1)[0].decode("ascii", "replace")
+        if name:
+            names[slot] = name
+    offset += tasks * name_length
+
+    if len(data) < offset + capacity * RECORD.size:
+        sys.exit(f"{path}: file too short for {capacity} records")
+    ring = [RECORD.unpack_from(data, offset + index * RECORD.size) for index in range(capacity)]
+
+    # The oldest record is at head modulo capacity once the ring has wrapped
+    if head <= capacity:
+        ordered = ring[:head]
+    else:
+        start = head % capacity
+        ordered = ring[start:] + ring[:start]
+
+    records = []
+    time = 0
+    last = None
+    for stamp, event, _, target in ordered:
+        if last is not None:
+            time += (stamp - last) & 0xFFFFFFFF
+        last = stamp
+        records.append((time, event, target))
+
+    return frequency, head, capacity, tasks, switches, names, records
+
+
+def task_name(names, tasks, number):
+    return names.get(number % tasks, f"task {number}")
+
+
+def bucket_limit(bucket):
+    """Upper limit, in microseconds, of a latency histogram bucket"""
+    return 1 << bucket
+
+
+def analyze(records):
+    """Returns the running time and switches of each task, the ready to running latencies and
+    the count of each queue event"""
+    running = {}
+    switched = {}
+    latencies = {}
+    queues = {}
+    ready_since = {}
+    current = None
+    current_since = None
+
+    for time, event, target in records:
+        if event == TASK_SWITCHED_IN:
+            current, current_since = target, time
+            switched[target] = switched.get(target, 0) + 1
+            if target in ready_since:
+                latencies.setdefault(target, []).append(time - ready_since.pop(target))
+        elif event == TASK_SWITCHED_OUT:
+            if current == target and current_since is not None:
+                running[target] = running.get(target, 0) + time - current_since
+            current, current_since = None, None
+        elif event == TASK_READY:
+            # A task made ready again before running keeps its first ready time
+            ready_since.setdefault(target, time)
+        elif event in QUEUE_EVENTS:
+            counters = queues.setdefault(target, {})
+            counters[event] = counters.get(event, 0) + 1
+
+    return running, switched, latencies, queues
+
+
+def histogram(values, frequency):
+    counts = [0] * HISTOGRAM_BUCKETS
+    for value in values:
+        micros = value * 1000000 // frequency
+        bucket = 0
+        while bucket < HISTOGRAM_BUCKETS - 1 and micros >= bucket_limit(bucket):
+            bucket += 1
+        counts[bucket] += 1
+    return counts
+
+
+def report(path, show_histograms):
+    frequency, head, capacity, tasks, switches, names, records = load(path)
+    if len(records) < 2:
+        sys.exit(f"{path}: not enough records to analyze")
+
+    window = records[-1][0] - records[0][0]
+    running, switched, latencies, queues = analyze(records)
+    lost = max(head - capacity, 0)
+
+    print(f"Records: {len(records)} of {head} written, {lost} overwritten")
+    print(f"Window: {window * 1000 / frequency:.3f} ms at {frequency} Hz")
+    print()
+    print(f"{'Task':<16} {'CPU':>7} {'Switches':>9} {'Total':>9} {'Lat avg':>9} {'Lat max':>9}")
+
+    numbers = sorted(set(running) | set(switched) | set(latencies))
+    for number in numbers:
+        share = 100.0 * running.get(number, 0) / window if window else 0.0
+        values = latencies.get(number, [])
+        average = sum(values) * 1000000 / len(values) / frequency if values else 0.0
+        worst = max(values) * 1000000 / frequency if values else 0.0
+        print(
+            f"{task_name(names, tasks, number):<16} {share:6.2f}% {switched.get(number, 0):>9} "
+            f"{switches[number % tasks]:>9} {average:>7.1f}us {worst:>7.1f}us"
+        )
+
+    if show_histograms:
+        print()
+        print("Ready to running latency histograms, in microseconds")
+        for number in numbers:
+            values = latencies.get(number, [])
+            if not values:
+                continue
+            print(f"  {task_name(names, tasks, number)}")
+            counts = histogram(values, frequency)
+            peak = max(counts)
+            used = max(bucket for bucket, count in enumerate(counts) if count) + 1
+            lower = 0
+            for bucket, count in enumerate(counts[:used]):
+                if bucket < HISTOGRAM_BUCKETS - 1:
+                    label = f"{lower}-{bucket_limit(bucket)}"
+                else:
+                    label = f">={lower}"
+                bar = "#" * (count * 40 // peak)
+                print(f"    {label:>12} {count:>7} {bar}".rstrip())
+                lower = bucket_limit(bucket)
+
+    if queues:
+        print()
+        print(f"{'Queue':<8} " + " ".join(f"{name:>14}" for name in QUEUE_EVENTS.values()))
+        for number in sorted(queues):
+            counters = queues[number]
+            values = " ".join(f"{counters.get(event, 0):>14}" for event in QUEUE_EVENTS)
+            print(f"{number:<8} {values}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("snapshot", help="file with the memory image of trace_buffer")
+    parser.add_argument(
+        "--no-histograms", action="store_true", help="omit the latency histograms of each task"
+    )
+    arguments = parser.parse_args()
+    report(arguments.snapshot, not arguments.no_histograms)
+
+
+if __name__ == "__main__":
+    main()
@@ -35,10 +35,12 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ================================================================ */
 
+#include "hal_eeprom.h"
 #include "hal_pin.h"
 #include "hal_sci.h"
 #include "hal_gpio.h"
 #include "hal_tick.h"
+#include "soc_eeprom.h"
 #include "soc_pin.h"
 #include "soc_sci.h"
 #include "soc_gpio.h"
@@ -0,0 +1,124 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef HAL_EEPROM_H
+#define HAL_EEPROM_H
+
+/** @file
+ ** @brief Non-volatile memory declarations
+ **
+ ** The non-volatile memory is accessed as an array of bytes starting at offset zero. The data is
+ ** read and written in words of @ref HAL_EEPROM_WORD_SIZE bytes, and each write must stay inside a
+ ** single page of @c HAL_EEPROM_PAGE_SIZE bytes, defined by each SOC. A write only starts the
+ ** programming of the page, the memory remains busy until @ref EepromIsBusy returns false and no
+ ** other access is allowed in the meantime.
+ **
+ ** Only the words included in a write are programmed, a power failure while the page is being
+ ** programmed can leave those words with any value but does not change the rest of the memory.
+ **
+ ** @addtogroup hal HAL
+ ** @brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/**
+ * @brief Number of bytes in each word of the non-volatile memory, offsets and sizes must be
+ * multiples of this value
+ */
+#define HAL_EEPROM_WORD_SIZE 4
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to initialize the non-volatile memory
+ *
+ * @return true     The memory is ready to be used
+ * @return false    The memory is not available
+ */
+bool EepromInit(void);
+
+/**
+ * @brief Function to get the number of bytes of non-volatile memory available
+ *
+ * @return uint32_t Size of the memory, in bytes, zero if the memory is not available
+ */
+uint32_t EepromGetSize(void);
+
+/**
+ * @brief Function to read data from the non-volatile memory
+ *
+ * @param  offset   Offset of the first byte to read, must be a multiple of the word size
+ * @param  data     Pointer to the buffer to store the data read
+ * @param  size     Number of bytes to read, must be a multiple of the word size
+ * @return true     The data was read
+ * @return false    The parameters are invalid or the memory is busy
+ */
+bool EepromRead(uint32_t offset, void * data, uint32_t size);
+
+/**
+ * @brief Function to start the programming of data in the non-volatile memory
+ *
+ * @param  offset   Offset of the first byte to write, must be a multiple of the word size
+ * @param  data     Pointer to the data to write
+ * @param  size     Number of bytes to write, must be a multiple of the word size and all of them
+ *                  must be in the same page
+ * @return true     The programming was started
+ * @return false    The parameters are invalid, the memory is busy or the programming failed
+ */
+bool EepromWrite(uint32_t offset, const void * data, uint32_t size);
+
+/**
+ * @brief Function to check if the non-volatile memory is still programming a previous write
+ *
+ * @return true     The memory is programming and can not be accessed
+ * @return false    The memory is ready for a new access
+ */
+bool EepromIsBusy(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* HAL_EEPROM_H */
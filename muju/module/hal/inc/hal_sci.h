@@ -122,6 +122,9 @@ bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins);
 /**
  * @brief Function to put data into output fifo on hardware
  *
+ * Data is only accepted when the output fifo is empty, so a call made from the fifo empty event
+ * can write up to the full depth of the hardware fifo.
+ *
  * @param  sci      Pointer to the structure with the serial port descriptor
  * @param  data     Pointer to buffer with data to put in output fifo
  * @param  size     Length of data to put in output fifo
@@ -156,6 +159,62 @@ void SciReadStatus(hal_sci_t sci, sci_status_t result);
  */
 void SciSetEventHandler(hal_sci_t sci, hal_sci_event_t handler, void * object);
 
+/**
+ * @brief Function to request a serial port event from the application
+ *
+ * The installed handler is called from the interrupt as if the hardware had raised the event, so
+ * the fifos can be accessed only from the handler without disabling the interrupts.
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ */
+void SciRaiseEvent(hal_sci_t sci);
+
+/**
+ * @brief Function to attach transmission and reception ring buffers to a serial port
+ *
+ * The buffered serial port installs its own event handler, which fills the output fifo from the
+ * transmission buffer and drains the input fifo into the reception buffer. From then on the data
+ * is transferred with SciWrite and SciRead, and the event handler must not be replaced.
+ *
+ * @param  sci          Pointer to the structure with the serial port descriptor
+ * @param  output       Pointer to the memory used as transmission ring buffer
+ * @param  output_size  Size of the transmission buffer, a power of two up to 32768
+ * @param  input        Pointer to the memory used as reception ring buffer
+ * @param  input_size   Size of the reception buffer, a power of two up to 32768
+ * @return true         The buffers were attached to the serial port
+ * @return false        The sizes are invalid or there are no free buffered port descriptors
+ */
+bool SciSetBuffers(hal_sci_t sci, uint8_t * output, uint16_t output_size, uint8_t * input,
+                   uint16_t input_size);
+
+/**
+ * @brief Function to put data into the transmission buffer without waiting
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @param  data     Pointer to the data to transmit
+ * @param  size     Number of bytes to transmit
+ * @return uint16_t Number of bytes stored in the transmission buffer, limited by its free space
+ */
+uint16_t SciWrite(hal_sci_t sci, void const * data, uint16_t size);
+
+/**
+ * @brief Function to get data from the reception buffer without waiting
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @param  data     Pointer to the buffer to store the received data
+ * @param  size     Maximum number of bytes to get
+ * @return uint16_t Number of bytes stored in the buffer
+ */
+uint16_t SciRead(hal_sci_t sci, void * data, uint16_t size);
+
+/**
+ * @brief Function to get the number of received bytes discarded because the buffer was full
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @return uint32_t Number of received bytes lost since the buffers were attached
+ */
+uint32_t SciGetLost(hal_sci_t sci);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
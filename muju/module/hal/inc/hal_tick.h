@@ -55,6 +55,17 @@ extern "C" {
  */
 typedef void (*hal_tick_event_t)(void * object);
 
+/**
+ * @brief Structure with the descriptor of a system timer subscriber
+ */
+typedef struct hal_tick_subscriber_s {
+    hal_tick_event_t handler; /**< Function to call on the subscriber events */
+    void * object;            /**< Pointer to user data sended as parameter in handler calls */
+    uint16_t divider;         /**< Number of system timer events between two subscriber events */
+    uint16_t offset;          /**< Number of system timer events to delay the subscriber events */
+    uint8_t priority;         /**< Order of the call in the same event, lower values go first */
+} const * hal_tick_subscriber_t;
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
@@ -68,6 +79,30 @@ typedef void (*hal_tick_event_t)(void * object);
  */
 void TickStart(hal_tick_event_t handler, void * object, uint32_t period);
 
+/**
+ * @brief Function to register a subscriber in the system timer service
+ *
+ * The subscribers must be registered before the service is started with @ref TickServiceStart
+ *
+ * @param  subscriber   Pointer to the constant structure with the subscriber descriptor
+ * @return true         The subscriber was registered
+ * @return false        There is no space left or the service was already started
+ */
+bool TickSubscribe(hal_tick_subscriber_t subscriber);
+
+/**
+ * @brief Function to start the system timer service with all the registered subscribers
+ *
+ * The events of each subscriber are precomputed in a schedule that covers the least common
+ * multiple of all dividers, so the cost of each system timer event only depends on the number of
+ * subscribers that must be called on it.
+ *
+ * @param  period   Period, in microseconds, between each system timer event
+ * @return true     The service was started
+ * @return false    The schedule required by the dividers is bigger than HAL_TICK_SCHEDULE_SIZE
+ */
+bool TickServiceStart(uint32_t period);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
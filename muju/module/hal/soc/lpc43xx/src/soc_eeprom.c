@@ -0,0 +1,148 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Non-volatile memory on lpc43xx implementation
+ **
+ ** The words written are stored in the page register through the memory mapped window of the
+ ** EEPROM, and then the erase and program command transfers them to the page. The end of the
+ ** programming is detected by polling the interrupt status, so no interrupt handler is needed.
+ **
+ ** @addtogroup lpc43xx LPC43xx
+ ** @ingroup hal
+ ** @brief LPC43xx SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "soc_eeprom.h"
+#include "chip.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Number of bytes available, the last page of the EEPROM can not be written
+ */
+#define EEPROM_SIZE ((EEPROM_PAGE_NUM - 1) * EEPROM_PAGE_SIZE)
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to validate the range of an access to the memory
+ *
+ * @param  offset   Offset of the first byte of the access
+ * @param  size     Number of bytes of the access
+ * @return true     The access is aligned to words and inside the memory
+ * @return false    The access is invalid
+ */
+static bool IsValidRange(uint32_t offset, uint32_t size);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Flag to indicate that a page is being programmed
+ */
+static bool programming = false;
+
+/* === Private function implementation ========================================================= */
+
+static bool IsValidRange(uint32_t offset, uint32_t size) {
+    return (offset % HAL_EEPROM_WORD_SIZE == 0) && (size % HAL_EEPROM_WORD_SIZE == 0) &&
+           (offset <= EEPROM_SIZE) && (size <= EEPROM_SIZE - offset);
+}
+
+/* === Public function implementation ========================================================== */
+
+bool EepromInit(void) {
+    Chip_EEPROM_Init(LPC_EEPROM);
+    Chip_EEPROM_SetAutoProg(LPC_EEPROM, EEPROM_AUTOPROG_OFF);
+    Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    programming = false;
+    return true;
+}
+
+uint32_t EepromGetSize(void) {
+    return EEPROM_SIZE;
+}
+
+bool EepromRead(uint32_t offset, void * data, uint32_t size) {
+    volatile uint32_t * source = (volatile uint32_t *)EEPROM_ADDRESS(0, offset);
+    uint8_t * destination = data;
+    uint32_t word;
+
+    if ((data == NULL) || !IsValidRange(offset, size) || EepromIsBusy()) {
+        return false;
+    }
+
+    // The EEPROM only accepts word reads, the buffer may not be aligned
+    for (uint32_t index = 0; index < size / HAL_EEPROM_WORD_SIZE; index++) {
+        word = source[index];
+        memcpy(&destination[index * HAL_EEPROM_WORD_SIZE], &word, HAL_EEPROM_WORD_SIZE);
+    }
+    return true;
+}
+
+bool EepromWrite(uint32_t offset, const void * data, uint32_t size) {
+    volatile uint32_t * target = (volatile uint32_t *)EEPROM_ADDRESS(0, offset);
+    const uint8_t * source = data;
+    uint32_t word;
+
+    if ((data == NULL) || (size == 0) || !IsValidRange(offset, size) || EepromIsBusy()) {
+        return false;
+    }
+    if (offset / EEPROM_PAGE_SIZE != (offset + size - 1) / EEPROM_PAGE_SIZE) {
+        return false;
+    }
+
+    for (uint32_t index = 0; index < size / HAL_EEPROM_WORD_SIZE; index++) {
+        memcpy(&word, &source[index * HAL_EEPROM_WORD_SIZE], HAL_EEPROM_WORD_SIZE);
+        target[index] = word;
+    }
+    Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+    Chip_EEPROM_SetCmd(LPC_EEPROM, EEPROM_CMD_ERASE_PRG_PAGE);
+    programming = true;
+    return true;
+}
+
+bool EepromIsBusy(void) {
+    if (programming && (Chip_EEPROM_GetIntStatus(LPC_EEPROM) & EEPROM_INT_ENDOFPROG)) {
+        Chip_EEPROM_ClearIntStatus(LPC_EEPROM, EEPROM_INT_ENDOFPROG);
+        programming = false;
+    }
+    return programming;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
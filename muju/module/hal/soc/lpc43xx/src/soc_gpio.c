@@ -56,6 +56,21 @@ SPDX-License-Identifier: MIT
 #define HAL_GPIO_NVIC_PRIORITY 0
 #endif
 
+/**
+ * @brief Number of pin interrupt channels available on the PININT block
+ */
+#define GPIO_EVENT_CHANNELS 8
+
+/**
+ * @brief Mask with all the pin interrupt channels marked as free
+ */
+#define GPIO_EVENT_ALL_FREE ((1 << GPIO_EVENT_CHANNELS) - 1)
+
+/**
+ * @brief Macro to calculate the index of a gpio terminal in the channel lookup table
+ */
+#define GPIO_EVENT_KEY(GPIO) (((GPIO)->gpio << 5) | (GPIO)->bit)
+
 /**
  * @brief Macro to generate the name of an descriptor from the gpio port and bit
  */
@@ -87,8 +102,10 @@ struct hal_gpio_bit_s {
  */
 typedef struct event_handler_s {
     hal_gpio_bit_t gpio;      /**< Pointer to the structure with the gpio terminal descriptor */
-    hal_gpio_event_t handler; /**< Function to call on the serial port events */
+    hal_gpio_event_t handler; /**< Function to call on the gpio bit events */
     void * object;            /**< Pointer to user data sended as parameter in handler calls */
+    bool rising : 1;          /**< Flag to indicate if rising edge raises an event */
+    bool falling : 1;         /**< Flag to indicate if falling edge raises an event */
 } * event_handler_t;
 
 /* === Private variable declarations =========================================================== */
@@ -96,20 +113,26 @@ typedef struct event_handler_s {
 /* === Private function declarations =========================================================== */
 
 /**
- * @brief Function to find the handler used by an gpio or an empty if none was assigned before
+ * @brief Function to get the interrupt channel used by an gpio or allocate a free one
  *
- * @param  gpio         Pointer to the structure with the gpio terminal descriptor
- * @param  descriptor   Pointer to variable te return the selected descriptor
- * @return uint8_t      Index descriptor in array, used to assign the channel interrupt
+ * @param  gpio     Pointer to the structure with the gpio terminal descriptor
+ * @return uint8_t  Number of interrupt channel or GPIO_EVENT_CHANNELS if none is available
  */
-static uint8_t FindHandlerDescriptor(hal_gpio_bit_t gpio, event_handler_t * descriptor);
+static uint8_t AllocateChannel(hal_gpio_bit_t gpio);
+
+/**
+ * @brief Function to release the interrupt channel used by an gpio, if it has one assigned
+ *
+ * @param  gpio     Pointer to the structure with the gpio terminal descriptor
+ */
+static void ReleaseChannel(hal_gpio_bit_t gpio);
 
 /**
  * @brief Function to dispatch an gpio bit event when then raises an interrupt
  *
- * @param  index    Index of gpio interrupt channel that raises the event
+ * @param  channel  Number of gpio interrupt channel that raises the event
  */
-static void GpioHandleEvent(uint8_t index);
+static void GpioHandleEvent(uint8_t channel);
 
 /* === Public variable definitions ============================================================= */
 
@@ -181,37 +204,62 @@ const hal_gpio_bit_t GPIO_BIT(5, 18, 4, 9, 5);  /**< Constant to define Bit 18 o
 /* === Private variable definitions ============================================================ */
 
 /**
- * @brief Vector to store the event handlers of the serial ports
+ * @brief Vector to store the event handlers, indexed by the pin interrupt channel
  */
-static struct event_handler_s event_handlers[8] = {0};
+static struct event_handler_s event_handlers[GPIO_EVENT_CHANNELS] = {0};
+
+/**
+ * @brief Table to find the channel assigned to a gpio terminal, stored as channel number plus one
+ */
+static uint8_t event_channels[8 * 32] = {0};
+
+/**
+ * @brief Bitmap with the pin interrupt channels not assigned to any gpio terminal
+ */
+static uint8_t free_channels = GPIO_EVENT_ALL_FREE;
 
 /* === Private function implementation ========================================================= */
 
-static uint8_t FindHandlerDescriptor(hal_gpio_bit_t gpio, event_handler_t * descriptor) {
-    uint8_t index;
-    *descriptor = NULL;
+static uint8_t AllocateChannel(hal_gpio_bit_t gpio) {
+    uint8_t * entry = &event_channels[GPIO_EVENT_KEY(gpio)];
+    uint8_t channel = GPIO_EVENT_CHANNELS;
 
-    for (index = 0; index < 7; index++) {
-        if (event_handlers[index].gpio == gpio) {
-            *descriptor = &event_handlers[index];
-            break;
-        }
+    if (*entry) {
+        channel = *entry - 1;
+    } else if (free_channels) {
+        channel = __builtin_ctz(free_channels);
+        free_channels &= ~(1 << channel);
+        *entry = channel + 1;
     }
-    if (*descriptor == NULL) {
-        for (index = 0; index < 7; index++) {
-            if (event_handlers[index].gpio == NULL) {
-                *descriptor = &event_handlers[index];
-                break;
-            }
-        }
+    return channel;
+}
+
+static void ReleaseChannel(hal_gpio_bit_t gpio) {
+    uint8_t * entry = &event_channels[GPIO_EVENT_KEY(gpio)];
+
+    if (*entry) {
+        uint8_t channel = *entry - 1;
+
+        NVIC_DisableIRQ(PIN_INT0_IRQn + channel);
+        Chip_PININT_DisableIntHigh(LPC_GPIO_PIN_INT, 1 << channel);
+        Chip_PININT_DisableIntLow(LPC_GPIO_PIN_INT, 1 << channel);
+        Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << channel);
+
+        memset(&event_handlers[channel], 0, sizeof(event_handlers[channel]));
+        free_channels |= (1 << channel);
+        *entry = 0;
     }
-    return index;
 }
 
-static void GpioHandleEvent(uint8_t index) {
-    event_handler_t descriptor = &event_handlers[index];
-    bool rissing = (Chip_PININT_GetRiseStates(LPC_GPIO_PIN_INT) & (1 << index));
-    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << index);
+static void GpioHandleEvent(uint8_t channel) {
+    event_handler_t descriptor = &event_handlers[channel];
+    bool rissing = descriptor->rising;
+
+    /* The edge only needs to be read from hardware when both edges raise events */
+    if (descriptor->rising && descriptor->falling) {
+        rissing = (Chip_PININT_GetRiseStates(LPC_GPIO_PIN_INT) & (1 << channel)) != 0;
+    }
+    Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << channel);
 
     if (descriptor->handler != NULL) {
         descriptor->handler(descriptor->gpio, rissing, descriptor->object);
@@ -269,30 +317,42 @@ void GpioBitToggle(hal_gpio_bit_t gpio) {
 void GpioSetEventHandler(hal_gpio_bit_t gpio, hal_gpio_event_t handler, void * object, bool rising,
                          bool falling) {
 
-    event_handler_t descriptor;
-    uint8_t index = FindHandlerDescriptor(gpio, &descriptor);
+    if (gpio == NULL) {
+        return;
+    }
+
+    if (((rising) || (falling)) && (handler)) {
+        uint8_t channel = AllocateChannel(gpio);
 
-    if (descriptor != NULL) {
-        if (((rising) || (falling)) && (handler)) {
+        if (channel < GPIO_EVENT_CHANNELS) {
+            event_handler_t descriptor = &event_handlers[channel];
+
+            NVIC_DisableIRQ(PIN_INT0_IRQn + channel);
             descriptor->gpio = gpio;
             descriptor->handler = handler;
             descriptor->object = object;
+            descriptor->rising = rising;
+            descriptor->falling = falling;
 
-            Chip_SCU_GPIOIntPinSel(index, gpio->gpio, gpio->bit);
-            Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << index);
+            Chip_SCU_GPIOIntPinSel(channel, gpio->gpio, gpio->bit);
+            Chip_PININT_SetPinModeEdge(LPC_GPIO_PIN_INT, 1 << channel);
+            Chip_PININT_ClearIntStatus(LPC_GPIO_PIN_INT, 1 << channel);
             if (rising) {
-                Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, 1 << index);
+                Chip_PININT_EnableIntHigh(LPC_GPIO_PIN_INT, 1 << channel);
+            } else {
+                Chip_PININT_DisableIntHigh(LPC_GPIO_PIN_INT, 1 << channel);
             }
             if (falling) {
-                Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, 1 << index);
+                Chip_PININT_EnableIntLow(LPC_GPIO_PIN_INT, 1 << channel);
+            } else {
+                Chip_PININT_DisableIntLow(LPC_GPIO_PIN_INT, 1 << channel);
             }
-            NVIC_ClearPendingIRQ(PIN_INT0_IRQn + index);
-            NVIC_SetPriority(PIN_INT0_IRQn + index, HAL_GPIO_NVIC_PRIORITY);
-            NVIC_EnableIRQ(PIN_INT0_IRQn + index);
-        } else {
-            memset(descriptor, 0, sizeof(*descriptor));
-            NVIC_EnableIRQ(PIN_INT0_IRQn + index);
+            NVIC_ClearPendingIRQ(PIN_INT0_IRQn + channel);
+            NVIC_SetPriority(PIN_INT0_IRQn + channel, HAL_GPIO_NVIC_PRIORITY);
+            NVIC_EnableIRQ(PIN_INT0_IRQn + channel);
         }
+    } else {
+        ReleaseChannel(gpio);
     }
 }
 
@@ -380,9 +380,16 @@ bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins) {
 }
 
 uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
+    uint8_t const * bytes = data;
     uint16_t result = 0;
-    if (sci) {
-        result = Chip_UART_Send(sci->port, data, size);
+
+    // When the transmitter holding register is empty the whole output fifo is free, so it is
+    // filled at once instead of writing only one byte as Chip_UART_Send does
+    if (sci && (Chip_UART_ReadLineStatus(sci->port) & UART_LSR_THRE)) {
+        while ((result < size) && (result < UART_TX_FIFO_SIZE)) {
+            Chip_UART_SendByte(sci->port, bytes[result]);
+            result++;
+        }
     }
     return result;
 }
@@ -424,6 +431,12 @@ void SciSetEventHandler(hal_sci_t sci, hal_sci_event_t handler, void * data) {
     }
 }
 
+void SciRaiseEvent(hal_sci_t sci) {
+    if (sci) {
+        NVIC_SetPendingIRQ(sci->interupt);
+    }
+}
+
 void UART0_IRQHandler(void) {
     SciHandleEvent(HAL_SCI_USART0);
 }
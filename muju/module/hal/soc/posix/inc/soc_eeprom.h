@@ -0,0 +1,98 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SOC_EEPROM_H
+#define SOC_EEPROM_H
+
+/** @file
+ ** @brief Non-volatile memory on posix declarations
+ **
+ ** The contents of the memory are kept in a file of the host, so they survive the restart of the
+ ** program, and a power failure can be emulated in the middle of any write to test the recovery.
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "hal_eeprom.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/**
+ * @brief Number of bytes in each page of the emulated memory, the same as the lpc43xx EEPROM
+ */
+#define HAL_EEPROM_PAGE_SIZE 128
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to select the file used to store the contents of the emulated memory
+ *
+ * The default file is defined by @c HAL_EEPROM_FILE in the project config file, and can be
+ * overridden at run time with the environment variable of the same name. The change takes effect
+ * in the next call to @ref EepromInit.
+ *
+ * @param  path     Path of the file, it is created filled with 0xFF if it does not exist
+ */
+void EepromSetFile(const char * path);
+
+/**
+ * @brief Function to emulate a power failure during a future write
+ *
+ * After the number of words indicated have been programmed, the next word is left with a random
+ * mix of its old and new bits and the memory stops responding as if the power had been removed.
+ * Every following access fails until @ref EepromInit is called again, which emulates the restart.
+ *
+ * @param  words    Number of words that are programmed correctly before the failure
+ */
+void EepromSchedulePowerFailure(uint32_t words);
+
+/**
+ * @brief Function to cancel a power failure scheduled and not yet happened
+ */
+void EepromCancelPowerFailure(void);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SOC_EEPROM_H */
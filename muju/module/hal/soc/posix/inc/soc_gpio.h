@@ -90,6 +90,52 @@ extern const hal_gpio_bit_t HAL_GPIO3_7; /**< Constant to define Bit 7 on GPIO 3
 
 /* === Public function declarations ============================================================ */
 
+/**
+ * @brief Function to load a script with timestamped events to drive the emulated gpio terminals
+ *
+ * Each line of the script has the form @c "t=<time><unit> <action> <terminal>", where unit is one
+ * of @c us, @c ms or @c s, action is one of @c press, @c release, @c high, @c low, @c toggle or
+ * @c exit, and terminal is a name registered with @ref GpioScriptSetAlias, a @c GPIOp_b name or a
+ * @c KEYn name matching the keyboard emulation. Empty lines and lines starting with @c # are
+ * ignored. The script is read lazily, so a pipe can be used, and the events are applied in
+ * lock-step with the system timer. While a script is loaded the keyboard and the terminal status
+ * drawing are disabled. If the environment variable @c HAL_GPIO_SCRIPT is defined, the script
+ * with that path is loaded when the first gpio terminal is configured.
+ *
+ * @param  path     Path to the file with the script, or @c "-" to read it from standard input
+ * @return true     The script was opened and will be applied on next system timer events
+ * @return false    The script could not be opened
+ */
+bool GpioScriptLoad(const char * path);
+
+/**
+ * @brief Function to register a name that can be used in scripts to reference a gpio terminal
+ *
+ * @param  name     Name used in the script to reference the gpio terminal
+ * @param  gpio     Pointer to the structure with the gpio terminal descriptor
+ * @return true     The name was registered
+ * @return false    The name is too long or there is no space left to store it
+ */
+bool GpioScriptSetAlias(const char * name, hal_gpio_bit_t gpio);
+
+/**
+ * @brief Function to apply all script events scheduled up to the current emulated time
+ *
+ * @remark This function is called by the system timer emulation before each timer event, the
+ * emulated time is read with @ref TickGetTime
+ */
+void GpioScriptAdvance(void);
+
+/**
+ * @brief Function to apply all script events scheduled up to the time received as parameter
+ *
+ * @remark This function allows a program that does not use the system timer emulation, like an
+ * operating system with its own tick, to apply the script in lock-step with its own time base
+ *
+ * @param  time     Time, in microseconds, since the program started
+ */
+void GpioScriptAdvanceTo(uint64_t time);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
@@ -29,6 +29,15 @@ SPDX-License-Identifier: MIT
 /** @file
  ** @brief Serial ports on posix declarations
  **
+ ** Each serial port is the master side of a pseudo terminal, created when the port is configured.
+ ** The programs in the host use the slave side, whose name is printed on the standard error and
+ ** can be obtained with SciGetDevice. A thread for each port moves the data between the terminal
+ ** and two emulated hardware fifos of HAL_SCI_FIFO_SIZE bytes, and calls the event handler as the
+ ** interrupt does on the hardware.
+ **
+ ** When the input fifo is full the thread stops reading from the terminal, so the host is slowed
+ ** down instead of losing data.
+ **
  ** @addtogroup posix Posix
  ** @ingroup hal
  ** @brief Posix SOC Hardware abstraction layer
@@ -46,12 +55,45 @@ extern "C" {
 
 /* === Public macros definitions =============================================================== */
 
+/**
+ * @brief Depth of the emulated input and output fifos of each serial port
+ */
+#define HAL_SCI_FIFO_SIZE 16
+
 /* === Public data type declarations =========================================================== */
 
 /* === Public variable declarations ============================================================ */
 
+/** @cond !INTERNAL */
+extern const hal_sci_t HAL_SCI_USART0; /**< Constant to define serial port 0 */
+extern const hal_sci_t HAL_SCI_UART1;  /**< Constant to define serial port 1 */
+extern const hal_sci_t HAL_SCI_USART2; /**< Constant to define serial port 2 */
+extern const hal_sci_t HAL_SCI_USART3; /**< Constant to define serial port 3 */
+/** @endcond */
+
 /* === Public function declarations ============================================================ */
 
+/**
+ * @brief Function to get the name of the device used by the host to access a serial port
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @return const char* Path of the slave side of the pseudo terminal, NULL if the serial port has
+ *                  not been configured
+ */
+const char * SciGetDevice(hal_sci_t sci);
+
+/**
+ * @brief Function to transfer the data at the speed of the configured baud rate
+ *
+ * Without pacing the data moves as fast as the host allows. The default is defined by
+ * @c HAL_SCI_PACING in the project config file, and can be overridden at run time with the
+ * environment variable of the same name.
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @param  enabled  Flag to transfer each character in the time it takes on the line
+ */
+void SciSetPacing(hal_sci_t sci, bool enabled);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
@@ -48,10 +48,62 @@ extern "C" {
 
 /* === Public data type declarations =========================================================== */
 
+/**
+ * @brief Structure with the statistics of the system timer events generated on the host
+ *
+ * The lateness is the time elapsed between the deadline of a timer event and the moment when the
+ * timer thread was awakened to generate it. An overrun is counted when the lateness exceeds the
+ * interval between events, that is when at least one deadline was completely missed. The missed
+ * deadlines are skipped instead of generated in a burst, so the emulated time falls behind.
+ */
+typedef struct tick_statistics_s {
+    uint32_t events;       /**< Number of timer events generated with a deadline */
+    uint32_t overruns;     /**< Number of timer events that missed the next deadline */
+    uint32_t skipped;      /**< Number of deadlines skipped to resynchronize after an overrun */
+    uint32_t lateness_min; /**< Minimum lateness, in microseconds */
+    uint32_t lateness_avg; /**< Average lateness, in microseconds */
+    uint32_t lateness_max; /**< Maximum lateness, in microseconds */
+} * tick_statistics_t;
+
 /* === Public variable declarations ============================================================ */
 
 /* === Public function declarations ============================================================ */
 
+/**
+ * @brief Function to select the speed of the emulated time relative to the wall clock
+ *
+ * The default speed is defined by @c HAL_TICK_SPEED in the project config file, and can be
+ * overridden at run time with the environment variable of the same name.
+ *
+ * @param  speed    Multiplier applied to the emulated time, the value 1 runs in real time and the
+ *                  value 0 generates each timer event as soon as the previous handler completes
+ */
+void TickSetSpeed(uint32_t speed);
+
+/**
+ * @brief Function to get the emulated time elapsed since the system timer was started
+ *
+ * @remark The emulated time only advances with the system timer events, so it does not depend on
+ * the speed selected or on the load of the host
+ *
+ * @return uint64_t Emulated time, in microseconds
+ */
+uint64_t TickGetTime(void);
+
+/**
+ * @brief Function to get the statistics of the system timer events generated on the host
+ *
+ * @remark The timer events generated with speed 0 have no deadline and are not included
+ *
+ * @param  statistics   Pointer to the structure to return the current statistics
+ */
+void TickGetStatistics(tick_statistics_t statistics);
+
+/**
+ * @brief Function to clear the statistics of the system timer events generated on the host
+ */
+void TickResetStatistics(void);
+
 /* === End of documentation ==================================================================== */
 
 #ifdef __cplusplus
@@ -0,0 +1,238 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Non-volatile memory on posix implementation
+ **
+ ** @addtogroup posix Posix
+ ** @ingroup hal
+ ** @brief Posix SOC Hardware abstraction layer
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "soc_eeprom.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure the default file used to store the contents of the emulated memory
+ */
+#ifndef HAL_EEPROM_FILE
+#define HAL_EEPROM_FILE "eeprom.bin"
+#endif
+
+/**
+ * @brief Macro to configure the number of bytes of the emulated memory, the default is the same
+ * as the memory available in the lpc43xx
+ */
+#ifndef HAL_EEPROM_SIZE
+#define HAL_EEPROM_SIZE (127 * HAL_EEPROM_PAGE_SIZE)
+#endif
+
+/**
+ * @brief Maximum length of the path of the file
+ */
+#define PATH_LENGTH 256
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Structure with the state of the emulated memory
+ */
+typedef struct hal_eeprom_s {
+    char path[PATH_LENGTH]; /**< Path of the file with the contents of the memory */
+    int file;               /**< Descriptor of the open file, negative if it is not open */
+    bool failure;           /**< A power failure is scheduled */
+    bool powered;           /**< The memory responds to the accesses */
+    uint32_t remaining;     /**< Words to program before the scheduled power failure */
+} * hal_eeprom_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to validate the range of an access to the memory
+ *
+ * @param  offset   Offset of the first byte of the access
+ * @param  size     Number of bytes of the access
+ * @return true     The access is aligned to words and inside the memory
+ * @return false    The access is invalid
+ */
+static bool IsValidRange(uint32_t offset, uint32_t size);
+
+/**
+ * @brief Function to program a word in the file, emulating a power failure if it is scheduled
+ *
+ * @param  offset   Offset of the word in the memory
+ * @param  word     Pointer to the new value of the word
+ * @return true     The word was programmed
+ * @return false    The power failed before the word was completely programmed
+ */
+static bool ProgramWord(uint32_t offset, const uint8_t * word);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Variable with the instance of the emulated memory
+ */
+static struct hal_eeprom_s instance[1] = {{.path = HAL_EEPROM_FILE, .file = -1}};
+
+/* === Private function implementation ========================================================= */
+
+static bool IsValidRange(uint32_t offset, uint32_t size) {
+    return (offset % HAL_EEPROM_WORD_SIZE == 0) && (size % HAL_EEPROM_WORD_SIZE == 0) &&
+           (offset <= HAL_EEPROM_SIZE) && (size <= HAL_EEPROM_SIZE - offset);
+}
+
+static bool ProgramWord(uint32_t offset, const uint8_t * word) {
+    uint8_t value[HAL_EEPROM_WORD_SIZE];
+
+    memcpy(value, word, sizeof(value));
+    if (instance->failure && (instance->remaining-- == 0)) {
+        // The cells of the word interrupted keep some of the old bits and some of the new ones
+        uint8_t old[HAL_EEPROM_WORD_SIZE];
+        if (pread(instance->file, old, sizeof(old), offset) != sizeof(old)) {
+            memset(old, 0xFF, sizeof(old));
+        }
+        for (int index = 0; index < HAL_EEPROM_WORD_SIZE; index++) {
+            uint8_t mask = rand();
+            value[index] = (old[index] & mask) | (value[index] & ~mask);
+        }
+        instance->failure = false;
+        instance->powered = false;
+    }
+    if (pwrite(instance->file, value, sizeof(value), offset) != sizeof(value)) {
+        return false;
+    }
+    return instance->powered;
+}
+
+/* === Public function implementation ========================================================== */
+
+void EepromSetFile(const char * path) {
+    strncpy(instance->path, path, sizeof(instance->path) - 1);
+    instance->path[sizeof(instance->path) - 1] = 0;
+}
+
+void EepromSchedulePowerFailure(uint32_t words) {
+    instance->failure = true;
+    instance->remaining = words;
+}
+
+void EepromCancelPowerFailure(void) {
+    instance->failure = false;
+}
+
+bool EepromInit(void) {
+    const char * path = getenv("HAL_EEPROM_FILE");
+    uint8_t erased[HAL_EEPROM_PAGE_SIZE];
+    struct stat status;
+
+    if (instance->file >= 0) {
+        close(instance->file);
+    }
+    if (path != NULL) {
+        EepromSetFile(path);
+    }
+    instance->failure = false;
+    instance->powered = false;
+    instance->file = open(instance->path, O_RDWR | O_CREAT, 0644);
+    if ((instance->file < 0) || (fstat(instance->file, &status) != 0)) {
+        return false;
+    }
+
+    // A new file is filled with the value of the erased cells
+    memset(erased, 0xFF, sizeof(erased));
+    for (off_t offset = status.st_size; offset < HAL_EEPROM_SIZE; offset += sizeof(erased)) {
+        size_t size = sizeof(erased);
+        if (HAL_EEPROM_SIZE - offset < (off_t)size) {
+            size = HAL_EEPROM_SIZE - offset;
+        }
+        if (pwrite(instance->file, erased, size, offset) != (ssize_t)size) {
+            return false;
+        }
+    }
+    instance->powered = true;
+    return true;
+}
+
+uint32_t EepromGetSize(void) {
+    return HAL_EEPROM_SIZE;
+}
+
+bool EepromRead(uint32_t offset, void * data, uint32_t size) {
+    if ((data == NULL) || !IsValidRange(offset, size) || !instance->powered) {
+        return false;
+    }
+    return pread(instance->file, data, size, offset) == (ssize_t)size;
+}
+
+bool EepromWrite(uint32_t offset, const void * data, uint32_t size) {
+    const uint8_t * source = data;
+
+    if ((data == NULL) || (size == 0) || !IsValidRange(offset, size) || !instance->powered) {
+        return false;
+    }
+    if (offset / HAL_EEPROM_PAGE_SIZE != (offset + size - 1) / HAL_EEPROM_PAGE_SIZE) {
+        return false;
+    }
+
+    for (uint32_t index = 0; index < size; index += HAL_EEPROM_WORD_SIZE) {
+        if (!ProgramWord(offset + index, &source[index])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool EepromIsBusy(void) {
+    return false;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -35,13 +35,43 @@ SPDX-License-Identifier: MIT
 /* === Headers files inclusions =============================================================== */
 
 #include "soc_gpio.h"
+#include "soc_tick.h"
+#include <inttypes.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <pthread.h>
 #include <termios.h>
 #include <unistd.h>
 
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
 /* === Macros definitions ====================================================================== */
 
+/**
+ * @brief Macro to configure the maximum number of names that can be registered for scripts
+ */
+#ifndef HAL_GPIO_SCRIPT_ALIASES
+#define HAL_GPIO_SCRIPT_ALIASES 16
+#endif
+
+/**
+ * @brief Maximum length of the names used in scripts to reference a gpio terminal
+ */
+#define SCRIPT_NAME_LENGTH 16
+
+/**
+ * @brief Maximum length of a line in a script
+ */
+#define SCRIPT_LINE_LENGTH 128
+
 /**
  * @brief Macro to generate the name of an descriptor from the gpio port and bit
  */
@@ -67,12 +97,42 @@ struct hal_gpio_bit_s {
  * @brief Structure to store a gpio bit event handler
  */
 typedef struct event_handler_s {
+    hal_gpio_bit_t gpio;      /**< Pointer to the structure with the gpio terminal descriptor */
     hal_gpio_event_t handler; /**< Function to call on the gpio bits events */
     void * object;            /**< Pointer to user data sended as parameter in handler calls */
     bool rising : 1;          /**< Flag to indicate if rissig edge raises an event */
     bool falling : 1;         /**< Flag to indicate if falling edge raises an event */
 } * event_handler_t;
 
+/**
+ * @brief Actions that can be applied to a gpio terminal from a script
+ */
+typedef enum script_action_e {
+    SCRIPT_PRESS,   /**< Key pressed, the input is driven to low level */
+    SCRIPT_RELEASE, /**< Key released, the input returns to high level */
+    SCRIPT_HIGH,    /**< The input is driven to high level */
+    SCRIPT_LOW,     /**< The input is driven to low level */
+    SCRIPT_TOGGLE,  /**< The input level is inverted */
+    SCRIPT_EXIT,    /**< The emulation ends and the program exits */
+} script_action_t;
+
+/**
+ * @brief Structure to store an script event waiting to be applied
+ */
+typedef struct script_event_s {
+    uint64_t time;              /**< Time, in microseconds, when the event must be applied */
+    script_action_t action;     /**< Action to be applied to the gpio terminal */
+    struct hal_gpio_bit_s gpio; /**< Gpio terminal affected by the action */
+} * script_event_t;
+
+/**
+ * @brief Structure to store a name used in scripts to reference a gpio terminal
+ */
+typedef struct script_alias_s {
+    char name[SCRIPT_NAME_LENGTH]; /**< Name used in the script to reference the gpio terminal */
+    struct hal_gpio_bit_s gpio;    /**< Gpio terminal referenced by the name */
+} * script_alias_t;
+
 /* === Private variable declarations =========================================================== */
 
 /**
@@ -85,8 +145,66 @@ static uint8_t gpio_emulation[4];
  */
 static struct event_handler_s event_handlers[32] = {0};
 
+/**
+ * @brief Variable with the names registered to reference gpio terminals from scripts
+ */
+static struct script_alias_s script_aliases[HAL_GPIO_SCRIPT_ALIASES] = {0};
+
+/**
+ * @brief Variable with the script file, or NULL if there is no script loaded
+ */
+static FILE * script_file = NULL;
+
+/**
+ * @brief Variable with the next script event waiting to be applied
+ */
+static struct script_event_s script_event[1];
+
+/**
+ * @brief Flag to indicate if the variable with the next script event is valid
+ */
+static bool script_pending = false;
+
+/**
+ * @brief Number of the script line that is being processed, used in error messages
+ */
+static uint32_t script_line = 0;
+
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Function to change the level of an emulated gpio input and raise the configured events
+ *
+ * @param  gpio     Pointer to the structure with the gpio terminal descriptor
+ * @param  state    New level of the gpio input
+ */
+static void EmulateInput(hal_gpio_bit_t gpio, bool state);
+
+/**
+ * @brief Function to find the gpio terminal referenced by a name used in a script
+ *
+ * @param  name     Name of the gpio terminal
+ * @param  gpio     Pointer to the structure to return the gpio terminal descriptor
+ * @return true     The name references a valid gpio terminal
+ * @return false    The name is unknown
+ */
+static bool ScriptFindTerminal(const char * name, struct hal_gpio_bit_s * gpio);
+
+/**
+ * @brief Function to read the next event from the script file
+ *
+ * @return true     A new event was stored in the pending script event
+ * @return false    The end of the script was reached
+ */
+static bool ScriptReadEvent(void);
+
+/**
+ * @brief Function to apply an script event to the emulated gpio terminals
+ *
+ * @param  event    Pointer to the structure with the script event
+ */
+static void ScriptApplyEvent(script_event_t event);
+
 /**
  * @brief Function to implement a main loop of a thread to scan keyboard
  *
@@ -155,11 +273,27 @@ const hal_gpio_bit_t GPIO_BIT(3, 7); /**< Constant to define Bit 7 on GPIO 3 */
 
 /* === Private function implementation ========================================================= */
 
+static void EmulateInput(hal_gpio_bit_t gpio, bool state) {
+    event_handler_t descriptor = &event_handlers[8 * gpio->gpio + gpio->bit];
+
+    if (GpioGetState(gpio) == state) {
+        return;
+    }
+    GpioSetState(gpio, state);
+
+    if (descriptor->handler != NULL) {
+        if ((state && descriptor->rising) || (!state && descriptor->falling)) {
+            descriptor->handler(descriptor->gpio, state, descriptor->object);
+        }
+    }
+}
+
 static void * KeyboardThread(void * _) {
     struct termios ttystate;
     struct hal_gpio_bit_s gpio = {.gpio = 0, .bit = 0};
     char key;
 
+    (void)_;
     tcgetattr(STDIN_FILENO, &ttystate);
     ttystate.c_lflag &= (~ICANON & ~ECHO);
     ttystate.c_cc[VMIN] = 1;
@@ -167,28 +301,120 @@ static void * KeyboardThread(void * _) {
 
     while (true) {
         key = getchar();
-        if ((key >= '1') && (key <= '8')) {
+        if ((script_file == NULL) && (key >= '1') && (key <= '8')) {
             gpio.gpio = 0;
             gpio.bit = key - '1';
-            GpioBitToggle(&gpio);
-
-            event_handler_t descriptor = &event_handlers[8 * gpio.gpio + gpio.bit];
-            if (descriptor->handler != NULL) {
-                if (GpioGetState(&gpio)) {
-                    if (descriptor->rising) {
-                        descriptor->handler(&gpio, true, descriptor->object);
-                    }
-                } else {
-                    if (descriptor->falling) {
-                        descriptor->handler(&gpio, false, descriptor->object);
-                    }
-                }
-            }
+            EmulateInput(&gpio, !GpioGetState(&gpio));
         }
     }
     return 0;
 }
 
+static bool ScriptFindTerminal(const char * name, struct hal_gpio_bit_s * gpio) {
+    unsigned int port, bit;
+    char tail;
+    int index;
+
+    for (index = 0; index < HAL_GPIO_SCRIPT_ALIASES; index++) {
+        if (strcmp(script_aliases[index].name, name) == 0) {
+            *gpio = script_aliases[index].gpio;
+            return true;
+        }
+    }
+    if ((sscanf(name, "GPIO%u_%u%c", &port, &bit, &tail) == 2) && (port < 4) && (bit < 8)) {
+        gpio->gpio = port;
+        gpio->bit = bit;
+        return true;
+    }
+    if ((sscanf(name, "KEY%u%c", &bit, &tail) == 1) && (bit >= 1) && (bit <= 8)) {
+        gpio->gpio = 0;
+        gpio->bit = bit - 1;
+        return true;
+    }
+    return false;
+}
+
+static bool ScriptReadEvent(void) {
+    static const struct {
+        const char * name;
+        script_action_t action;
+    } ACTIONS[] = {
+        {"press", SCRIPT_PRESS}, {"release", SCRIPT_RELEASE}, {"high", SCRIPT_HIGH},
+        {"low", SCRIPT_LOW},     {"toggle", SCRIPT_TOGGLE},   {"exit", SCRIPT_EXIT},
+    };
+
+    char line[SCRIPT_LINE_LENGTH];
+    char unit[4], action[SCRIPT_NAME_LENGTH], name[SCRIPT_NAME_LENGTH];
+    uint64_t value;
+    int fields;
+    unsigned int index;
+
+    while (fgets(line, sizeof(line), script_file) != NULL) {
+        script_line++;
+        if ((line[strspn(line, " \t\r\n")] == '\0') || (line[strspn(line, " \t")] == '#')) {
+            continue;
+        }
+
+        fields = sscanf(line, " t=%" SCNu64 "%3[a-z] %15s %15s", &value, unit, action, name);
+        if (fields < 3) {
+            fprintf(stderr, "gpio script:%" PRIu32 ": invalid line\n", script_line);
+            continue;
+        }
+
+        if (strcmp(unit, "s") == 0) {
+            script_event->time = value * 1000000;
+        } else if (strcmp(unit, "ms") == 0) {
+            script_event->time = value * 1000;
+        } else if (strcmp(unit, "us") == 0) {
+            script_event->time = value;
+        } else {
+            fprintf(stderr, "gpio script:%" PRIu32 ": unknown time unit %s\n", script_line, unit);
+            continue;
+        }
+
+        for (index = 0; index < sizeof(ACTIONS) / sizeof(ACTIONS[0]); index++) {
+            if (strcmp(ACTIONS[index].name, action) == 0) {
+                break;
+            }
+        }
+        if (index == sizeof(ACTIONS) / sizeof(ACTIONS[0])) {
+            fprintf(stderr, "gpio script:%" PRIu32 ": unknown action %s\n", script_line, action);
+            continue;
+        }
+        script_event->action = ACTIONS[index].action;
+
+        if (script_event->action != SCRIPT_EXIT) {
+            if ((fields < 4) || !ScriptFindTerminal(name, &script_event->gpio)) {
+                fprintf(stderr, "gpio script:%" PRIu32 ": unknown terminal\n", script_line);
+                continue;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+static void ScriptApplyEvent(script_event_t event) {
+    hal_gpio_bit_t gpio = &event->gpio;
+
+    switch (event->action) {
+    case SCRIPT_PRESS:
+    case SCRIPT_LOW:
+        EmulateInput(gpio, false);
+        break;
+    case SCRIPT_RELEASE:
+    case SCRIPT_HIGH:
+        EmulateInput(gpio, true);
+        break;
+    case SCRIPT_TOGGLE:
+        EmulateInput(gpio, !GpioGetState(gpio));
+        break;
+    case SCRIPT_EXIT:
+        exit(EXIT_SUCCESS);
+        break;
+    }
+}
+
 void DrawStatus(void) {
     static const char DRAW_INIT[] = "\033[2J\033[1;1H";
     static const char DRAW_BIT[] = "%d=\033[1;31m%d\033[0m";
@@ -213,6 +439,10 @@ void DrawStatus(void) {
 void RefreshStatus(hal_gpio_bit_t gpio) {
     static const char DRAW_BIT[] = "\033[%d;%dH\033[1;%dm%d\033[0m";
 
+    if (script_file != NULL) {
+        return;
+    }
+
     uint8_t value = (gpio_emulation[gpio->gpio] >> (gpio->bit)) & 0x01;
 
     printf(DRAW_BIT, gpio->gpio + 1, 46 - 5 * gpio->bit, value ? 32 : 31, value);
@@ -227,8 +457,13 @@ void GpioSetDirection(hal_gpio_bit_t gpio, bool output) {
 
     if (!initied_status) {
         initied_status = true;
-        DrawStatus();
-        pthread_create(&thread, NULL, KeyboardThread, NULL);
+        if ((script_file == NULL) && (getenv("HAL_GPIO_SCRIPT") != NULL)) {
+            GpioScriptLoad(getenv("HAL_GPIO_SCRIPT"));
+        }
+        if (script_file == NULL) {
+            DrawStatus();
+            pthread_create(&thread, NULL, KeyboardThread, NULL);
+        }
     }
     if (!output) {
         GpioBitSet(gpio);
@@ -278,12 +513,63 @@ void GpioSetEventHandler(hal_gpio_bit_t gpio, hal_gpio_event_t handler, void * o
     uint8_t index = 8 * gpio->gpio + gpio->bit;
     event_handler_t descriptor = &event_handlers[index];
 
+    descriptor->gpio = gpio;
     descriptor->handler = handler;
     descriptor->object = object;
     descriptor->rising = rising;
     descriptor->falling = falling;
 }
 
+bool GpioScriptLoad(const char * path) {
+    FILE * file;
+
+    if (strcmp(path, "-") == 0) {
+        file = stdin;
+    } else {
+        file = fopen(path, "r");
+    }
+    if (file == NULL) {
+        fprintf(stderr, "gpio script: unable to open %s\n", path);
+        return false;
+    }
+
+    if ((script_file != NULL) && (script_file != stdin)) {
+        fclose(script_file);
+    }
+    script_file = file;
+    script_line = 0;
+    script_pending = ScriptReadEvent();
+    return true;
+}
+
+bool GpioScriptSetAlias(const char * name, hal_gpio_bit_t gpio) {
+    int index;
+
+    if ((gpio == NULL) || (strlen(name) >= SCRIPT_NAME_LENGTH)) {
+        return false;
+    }
+    for (index = 0; index < HAL_GPIO_SCRIPT_ALIASES; index++) {
+        script_alias_t alias = &script_aliases[index];
+        if ((alias->name[0] == '\0') || (strcmp(alias->name, name) == 0)) {
+            strcpy(alias->name, name);
+            alias->gpio = *gpio;
+            return true;
+        }
+    }
+    return false;
+}
+
+void GpioScriptAdvance(void) {
+    GpioScriptAdvanceTo(TickGetTime());
+}
+
+void GpioScriptAdvanceTo(uint64_t time) {
+    while (script_pending && (script_event->time <= time)) {
+        ScriptApplyEvent(script_event);
+        script_pending = ScriptReadEvent();
+    }
+}
+
 /* === End of documentation ==================================================================== */
 
 /** @} End of module definition for doxygen
@@ -34,42 +34,487 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 
+#define _GNU_SOURCE
+
 #include "soc_sci.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
 
 /* === Macros definitions ====================================================================== */
 
+/**
+ * @brief Macro to configure the default pacing of the serial ports, 0 transfers without delays
+ */
+#ifndef HAL_SCI_PACING
+#define HAL_SCI_PACING 0
+#endif
+
+/**
+ * @brief Number of serial ports emulated
+ */
+#define HAL_SCI_PORTS 4
+
+/**
+ * @brief Number of nanoseconds in a second
+ */
+#define NANOSECONDS 1000000000L
+
 /* === Private data type declarations ========================================================== */
 
+/**
+ * @brief Strcuture to store a serial port descriptor
+ */
+struct hal_sci_s {
+    uint8_t index; /**< Numeric index of serial port */
+};
+
+/**
+ * @brief Structure to store the state of an emulated serial port
+ *
+ * The fifos and the line times are shared between the application and the port thread, so they
+ * are only accessed with the lock taken.
+ */
+typedef struct sci_port_s {
+    pthread_mutex_t lock;              /**< Mutex to protect the state of the serial port */
+    pthread_t thread;                  /**< Thread that emulates the serial port hardware */
+    hal_sci_t sci;                     /**< Serial port descriptor sended to the handler */
+    bool opened;                       /**< The pseudo terminal and the thread were created */
+    bool pacing;                       /**< The data is transferred at the baud rate */
+    bool notify;                       /**< An event must be raised even without new data */
+    int master;                        /**< Master side of the pseudo terminal */
+    int slave;                         /**< Slave side, kept open while the host is not */
+    int wake[2];                       /**< Pipe used to wake up the port thread */
+    char device[32];                   /**< Name of the slave side of the pseudo terminal */
+    uint8_t output[HAL_SCI_FIFO_SIZE]; /**< Emulated output fifo */
+    uint8_t output_first;              /**< Position of the next byte to transmit */
+    uint8_t output_count;              /**< Number of bytes in the output fifo */
+    uint8_t input[HAL_SCI_FIFO_SIZE];  /**< Emulated input fifo, used as a ring buffer */
+    uint8_t input_first;               /**< Position of the oldest byte received */
+    uint8_t input_count;               /**< Number of bytes in the input fifo */
+    int64_t character;                 /**< Time, in nanoseconds, of a character on the line */
+    int64_t output_ready;              /**< Time when the line finishes the last byte sent */
+    int64_t input_ready;               /**< Time when the next byte can be received */
+    hal_sci_event_t handler;           /**< Function to call on the serial port events */
+    void * object;                     /**< Pointer to user data sended in handler calls */
+} * sci_port_t;
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
+/**
+ * @brief Function to get the current time of the host
+ *
+ * @return int64_t  Monotonic time, in nanoseconds
+ */
+static int64_t Now(void);
+
+/**
+ * @brief Function to wake up the thread of a serial port
+ *
+ * @param  port     Pointer to the serial port state
+ */
+static void WakeUp(sci_port_t port);
+
+/**
+ * @brief Function to create the pseudo terminal and the thread of a serial port
+ *
+ * @param  port     Pointer to the serial port state
+ * @return true     The serial port is ready to operate
+ * @return false    The pseudo terminal or the thread could not be created
+ */
+static bool PortOpen(sci_port_t port);
+
+/**
+ * @brief Function to move the data between the pseudo terminal and the emulated fifos
+ *
+ * @param  port     Pointer to the serial port state
+ * @return true     A fifo changed its state and an event must be raised
+ * @return false    There is no event to raise
+ */
+static bool PortTransfer(sci_port_t port);
+
+/**
+ * @brief Function to implement the main loop of a thread that emulates a serial port
+ *
+ * @param  object   Pointer to the serial port state
+ * @return void*    Pointer to result data, required by function prototype, unused
+ */
+static void * PortThread(void * object);
+
 /* === Public variable definitions ============================================================= */
 
+/** Constant to define serial port 0 */
+const hal_sci_t HAL_SCI_USART0 = &(struct hal_sci_s){.index = 0};
+
+/** Constant to define serial port 1 */
+const hal_sci_t HAL_SCI_UART1 = &(struct hal_sci_s){.index = 1};
+
+/** Constant to define serial port 2 */
+const hal_sci_t HAL_SCI_USART2 = &(struct hal_sci_s){.index = 2};
+
+/** Constant to define serial port 3 */
+const hal_sci_t HAL_SCI_USART3 = &(struct hal_sci_s){.index = 3};
+
 /* === Private variable definitions ============================================================ */
 
+/**
+ * @brief Vector to store the state of the serial ports
+ */
+static struct sci_port_s ports[HAL_SCI_PORTS] = {
+    {.lock = PTHREAD_MUTEX_INITIALIZER},
+    {.lock = PTHREAD_MUTEX_INITIALIZER},
+    {.lock = PTHREAD_MUTEX_INITIALIZER},
+    {.lock = PTHREAD_MUTEX_INITIALIZER},
+};
+
 /* === Private function implementation ========================================================= */
 
+static int64_t Now(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * NANOSECONDS + now.tv_nsec;
+}
+
+static void WakeUp(sci_port_t port) {
+    uint8_t signal = 0;
+
+    (void)write(port->wake[1], &signal, sizeof(signal));
+}
+
+static bool PortOpen(sci_port_t port) {
+    const char * pacing = getenv("HAL_SCI_PACING");
+    struct termios settings;
+    const char * name = NULL;
+
+    port->pacing = (pacing != NULL) ? (strtoul(pacing, NULL, 10) != 0) : HAL_SCI_PACING;
+    port->notify = true;
+    port->slave = -1;
+    port->wake[0] = -1;
+    port->wake[1] = -1;
+    port->master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if ((port->master >= 0) && (grantpt(port->master) == 0) && (unlockpt(port->master) == 0)) {
+        name = ptsname(port->master);
+    }
+    if (name != NULL) {
+        strncpy(port->device, name, sizeof(port->device) - 1);
+        port->slave = open(port->device, O_RDWR | O_NOCTTY);
+    }
+    if ((port->slave >= 0) && (tcgetattr(port->slave, &settings) == 0)) {
+        cfmakeraw(&settings);
+        tcsetattr(port->slave, TCSANOW, &settings);
+    }
+
+    if ((port->slave < 0) || (pipe2(port->wake, O_NONBLOCK) != 0) ||
+        (pthread_create(&port->thread, NULL, PortThread, port) != 0)) {
+        if (port->wake[0] >= 0) {
+            close(port->wake[0]);
+            close(port->wake[1]);
+        }
+        if (port->slave >= 0) {
+            close(port->slave);
+        }
+        if (port->master >= 0) {
+            close(port->master);
+        }
+        return false;
+    }
+
+    fprintf(stderr, "Serial port %d on %s\n", (int)(port - ports), port->device);
+    return true;
+}
+
+static bool PortTransfer(sci_port_t port) {
+    int64_t now = Now();
+    bool result = false;
+    uint8_t * data;
+    ssize_t count;
+    size_t size;
+    uint8_t last;
+
+    pthread_mutex_lock(&port->lock);
+
+    // With pacing only one character is transferred in each direction per character time
+    while ((port->output_count > 0) && (!port->pacing || (port->output_ready <= now))) {
+        data = &port->output[port->output_first];
+        count = write(port->master, data, port->pacing ? 1 : port->output_count);
+        if (count <= 0) {
+            break;
+        }
+        port->output_first += count;
+        port->output_count -= count;
+        if (port->output_ready < now) {
+            port->output_ready = now;
+        }
+        port->output_ready += count * port->character;
+        result = result || (port->output_count == 0);
+    }
+
+    while ((port->input_count < HAL_SCI_FIFO_SIZE) &&
+           (!port->pacing || (port->input_ready <= now))) {
+        last = (port->input_first + port->input_count) % HAL_SCI_FIFO_SIZE;
+        if (last >= port->input_first) {
+            size = HAL_SCI_FIFO_SIZE - last;
+        } else {
+            size = port->input_first - last;
+        }
+        count = read(port->master, &port->input[last], port->pacing ? 1 : size);
+        if (count <= 0) {
+            break;
+        }
+        port->input_count += count;
+        if (port->input_ready < now) {
+            port->input_ready = now;
+        }
+        port->input_ready += count * port->character;
+        result = true;
+    }
+
+    result = result || port->notify;
+    port->notify = false;
+
+    pthread_mutex_unlock(&port->lock);
+    return result;
+}
+
+static void * PortThread(void * object) {
+    sci_port_t port = object;
+    struct pollfd events[2];
+    struct timespec wait;
+    int64_t deadline;
+    uint8_t signals[16];
+    sigset_t mask;
+    struct sci_status_s status;
+    hal_sci_event_t handler;
+    void * data;
+
+    // The emulation threads must not take the signals used by the ports of the operating systems
+    sigfillset(&mask);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+
+    events[0].fd = port->wake[0];
+    events[0].events = POLLIN;
+    events[1].fd = port->master;
+
+    while (true) {
+        int64_t now = Now();
+
+        pthread_mutex_lock(&port->lock);
+        deadline = 0;
+        events[1].events = 0;
+        if (port->input_count < HAL_SCI_FIFO_SIZE) {
+            if (port->pacing && (port->input_ready > now)) {
+                deadline = port->input_ready;
+            } else {
+                events[1].events |= POLLIN;
+            }
+        }
+        if (port->output_count > 0) {
+            if (port->pacing && (port->output_ready > now)) {
+                deadline = ((deadline == 0) || (port->output_ready < deadline)) ? port->output_ready
+                                                                                 : deadline;
+            } else {
+                events[1].events |= POLLOUT;
+            }
+        }
+        pthread_mutex_unlock(&port->lock);
+
+        if (deadline != 0) {
+            wait.tv_sec = (deadline - now) / NANOSECONDS;
+            wait.tv_nsec = (deadline - now) % NANOSECONDS;
+        }
+        ppoll(events, 2, (deadline != 0) ? &wait : NULL, NULL);
+        if (events[0].revents & POLLIN) {
+            while (read(port->wake[0], signals, sizeof(signals)) > 0) {
+            }
+        }
+
+        if (PortTransfer(port)) {
+            pthread_mutex_lock(&port->lock);
+            handler = port->handler;
+            data = port->object;
+            pthread_mutex_unlock(&port->lock);
+
+            if (handler) {
+                SciReadStatus(port->sci, &status);
+                handler(port->sci, &status, data);
+            }
+        }
+    }
+    return NULL;
+}
+
 /* === Public function implementation ========================================================== */
 
 bool SciSetConfig(hal_sci_t sci, hal_sci_line_t line, hal_sci_pins_t pins) {
-    return false;
+    uint32_t bits;
+    sci_port_t port;
+    bool result = true;
+
+    // The chip pins have no meaning on the host
+    (void)pins;
+
+    if ((sci == NULL) || (line == NULL) || (line->baud_rate == 0)) {
+        return false;
+    }
+    port = &ports[sci->index];
+
+    // Start bit, data bits, optional parity bit and stop bit
+    bits = 1 + ((line->data_bits != 0) ? line->data_bits : 8) + 1;
+    if (line->parity != HAL_SCI_NO_PARITY) {
+        bits++;
+    }
+
+    pthread_mutex_lock(&port->lock);
+    port->sci = sci;
+    port->character = (int64_t)bits * NANOSECONDS / line->baud_rate;
+    if (!port->opened) {
+        port->opened = PortOpen(port);
+        result = port->opened;
+    }
+    pthread_mutex_unlock(&port->lock);
+    return result;
 }
 
 uint16_t SciSendData(hal_sci_t sci, void const * const data, uint16_t size) {
-    return size;
+    sci_port_t port;
+    uint16_t result = 0;
+
+    if (sci == NULL) {
+        return 0;
+    }
+    port = &ports[sci->index];
+
+    // As the transmitter holding register, the data is only accepted when the fifo is empty
+    pthread_mutex_lock(&port->lock);
+    if (port->opened && (port->output_count == 0)) {
+        result = (size < HAL_SCI_FIFO_SIZE) ? size : HAL_SCI_FIFO_SIZE;
+        memcpy(port->output, data, result);
+        port->output_first = 0;
+        port->output_count = result;
+    }
+    pthread_mutex_unlock(&port->lock);
+
+    if (result > 0) {
+        WakeUp(port);
+    }
+    return result;
 }
 
 uint16_t SciReceiveData(hal_sci_t sci, void * data, uint16_t size) {
-    return size;
+    uint8_t * bytes = data;
+    sci_port_t port;
+    bool was_full;
+    uint16_t result = 0;
+
+    if (sci == NULL) {
+        return 0;
+    }
+    port = &ports[sci->index];
+
+    pthread_mutex_lock(&port->lock);
+    was_full = (port->input_count == HAL_SCI_FIFO_SIZE);
+    while ((result < size) && (port->input_count > 0)) {
+        bytes[result++] = port->input[port->input_first];
+        port->input_first = (port->input_first + 1) % HAL_SCI_FIFO_SIZE;
+        port->input_count--;
+    }
+    pthread_mutex_unlock(&port->lock);
+
+    // The thread stopped reading the terminal when the fifo was full
+    if (was_full && (result > 0)) {
+        WakeUp(port);
+    }
+    return result;
 }
 
 void SciReadStatus(hal_sci_t sci, sci_status_t result) {
+    sci_port_t port;
+
     memset(result, 0, sizeof(*result));
+    if (sci == NULL) {
+        return;
+    }
+    port = &ports[sci->index];
+
+    pthread_mutex_lock(&port->lock);
+    result->data_ready = (port->input_count > 0);
+    result->fifo_empty = (port->output_count == 0);
+    result->tramition_completed = result->fifo_empty;
+    if (port->pacing && (port->output_ready > Now())) {
+        result->tramition_completed = false;
+    }
+    pthread_mutex_unlock(&port->lock);
 }
 
 void SciSetEventHandler(hal_sci_t sci, hal_sci_event_t handler, void * data) {
+    sci_port_t port;
+
+    if (sci == NULL) {
+        return;
+    }
+    port = &ports[sci->index];
+
+    // As the hardware, enabling the interrupts with an empty output fifo raises an event
+    pthread_mutex_lock(&port->lock);
+    port->handler = handler;
+    port->object = data;
+    port->notify = true;
+    pthread_mutex_unlock(&port->lock);
+
+    if (port->opened) {
+        WakeUp(port);
+    }
+}
+
+void SciRaiseEvent(hal_sci_t sci) {
+    sci_port_t port;
+
+    if (sci == NULL) {
+        return;
+    }
+    port = &ports[sci->index];
+
+    pthread_mutex_lock(&port->lock);
+    port->notify = true;
+    pthread_mutex_unlock(&port->lock);
+
+    if (port->opened) {
+        WakeUp(port);
+    }
+}
+
+const char * SciGetDevice(hal_sci_t sci) {
+    if ((sci == NULL) || !ports[sci->index].opened) {
+        return NULL;
+    }
+    return ports[sci->index].device;
+}
+
+void SciSetPacing(hal_sci_t sci, bool enabled) {
+    if (sci != NULL) {
+        pthread_mutex_lock(&ports[sci->index].lock);
+        ports[sci->index].pacing = enabled;
+        pthread_mutex_unlock(&ports[sci->index].lock);
+    }
 }
 
 /* === End of documentation ==================================================================== */
@@ -34,13 +34,40 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions =============================================================== */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "soc_tick.h"
+#include "soc_gpio.h"
+#include <errno.h>
 #include <pthread.h>
-#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include <stdio.h>
 
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
 /* === Macros definitions ====================================================================== */
 
+/**
+ * @brief Macro to configure the default speed of the emulated time, 0 runs as fast as possible
+ */
+#ifndef HAL_TICK_SPEED
+#define HAL_TICK_SPEED 1
+#endif
+
+/**
+ * @brief Number of nanoseconds in a second
+ */
+#define NANOSECONDS 1000000000L
+
 /* === Private data type declarations ========================================================== */
 
 /**
@@ -51,6 +78,8 @@ typedef struct hal_tick_s {
     hal_tick_event_t handler; /**< Function to call on the system timer events */
     void * object;            /**< Pointer to user data sended as parameter in handler calls */
     uint32_t period;          /**< Period, in microseconds, between each system timer event */
+    uint32_t speed;           /**< Multiplier of emulated time, 0 to run as fast as possible */
+    volatile uint64_t time;   /**< Emulated time, in microseconds, since the timer started */
 } * hal_tick_t;
 
 /* === Private variable declarations =========================================================== */
@@ -65,6 +94,23 @@ typedef struct hal_tick_s {
  */
 static void * TimerThread(void * _);
 
+/**
+ * @brief Function to move forward an absolute time
+ *
+ * @param  time     Pointer to the time to update
+ * @param  delay    Time, in nanoseconds, to add
+ */
+static void AddNanoseconds(struct timespec * time, int64_t delay);
+
+/**
+ * @brief Function to update the statistics with the lateness of a timer event
+ *
+ * @param  lateness Time, in nanoseconds, elapsed since the event deadline
+ * @param  interval Time, in nanoseconds, between the deadlines of two events
+ * @param  skipped  Number of deadlines skipped to resynchronize after the event
+ */
+static void UpdateStatistics(int64_t lateness, int64_t interval, uint32_t skipped);
+
 /* === Public variable definitions ============================================================= */
 
 /* === Private variable definitions ============================================================ */
@@ -72,13 +118,95 @@ static void * TimerThread(void * _);
 /**
  * @brief Variable with the instance of system timer descriptor
  */
-static struct hal_tick_s instance[1] = {0};
+static struct hal_tick_s instance[1] = {{.speed = HAL_TICK_SPEED}};
+
+/**
+ * @brief Variable with the statistics of the timer events generated with a deadline
+ */
+static struct tick_statistics_s statistics[1] = {{.lateness_min = UINT32_MAX}};
+
+/**
+ * @brief Sum of the lateness of all timer events, used to calculate the average
+ */
+static uint64_t lateness_sum = 0;
+
+/**
+ * @brief Mutex to protect the access to the statistics from the application
+ */
+static pthread_mutex_t statistics_lock = PTHREAD_MUTEX_INITIALIZER;
 
 /* === Private function implementation ========================================================= */
 
+static void AddNanoseconds(struct timespec * time, int64_t delay) {
+    delay += time->tv_nsec;
+    time->tv_sec += delay / NANOSECONDS;
+    time->tv_nsec = delay % NANOSECONDS;
+}
+
+static void UpdateStatistics(int64_t lateness, int64_t interval, uint32_t skipped) {
+    uint32_t value = lateness / 1000;
+
+    pthread_mutex_lock(&statistics_lock);
+    statistics->events++;
+    if (lateness > interval) {
+        statistics->overruns++;
+    }
+    statistics->skipped += skipped;
+    if (value < statistics->lateness_min) {
+        statistics->lateness_min = value;
+    }
+    if (value > statistics->lateness_max) {
+        statistics->lateness_max = value;
+    }
+    lateness_sum += value;
+    statistics->lateness_avg = lateness_sum / statistics->events;
+    pthread_mutex_unlock(&statistics_lock);
+}
+
 static void * TimerThread(void * _) {
+    struct timespec deadline, now;
+    int64_t interval, lateness;
+    uint32_t skipped;
+    bool scheduled = false;
+    int result;
+
+    (void)_;
     while (true) {
-        usleep(instance->period);
+        if (instance->speed) {
+            interval = (int64_t)instance->period * 1000 / instance->speed;
+            if (!scheduled) {
+                clock_gettime(CLOCK_MONOTONIC, &deadline);
+                scheduled = true;
+            }
+
+            /* Deadlines are absolute so the handler execution time does not accumulate as drift */
+            AddNanoseconds(&deadline, interval);
+            do {
+                result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+            } while (result == EINTR);
+
+            if (result == 0) {
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                lateness = (int64_t)(now.tv_sec - deadline.tv_sec) * NANOSECONDS;
+                lateness += now.tv_nsec - deadline.tv_nsec;
+
+                /* After an overrun the missed deadlines are dropped, not generated in a burst */
+                skipped = 0;
+                if (lateness > interval) {
+                    skipped = lateness / interval;
+                    AddNanoseconds(&deadline, skipped * interval);
+                }
+                UpdateStatistics(lateness, interval, skipped);
+            } else {
+                /* The deadline can not be waited, it is restarted from the current time */
+                scheduled = false;
+            }
+        } else {
+            scheduled = false;
+        }
+
+        instance->time += instance->period;
+        GpioScriptAdvance();
         if (instance->handler) {
             instance->handler(instance->object);
         }
@@ -89,12 +217,42 @@ static void * TimerThread(void * _) {
 /* === Public function implementation ========================================================== */
 
 void TickStart(hal_tick_event_t handler, void * object, uint32_t period) {
+    const char * speed = getenv("HAL_TICK_SPEED");
+
+    if (speed != NULL) {
+        TickSetSpeed(strtoul(speed, NULL, 10));
+    }
     instance->handler = handler;
     instance->object = object;
     instance->period = period;
     pthread_create(&instance->thread, NULL, TimerThread, NULL);
 }
 
+void TickSetSpeed(uint32_t speed) {
+    instance->speed = speed;
+}
+
+uint64_t TickGetTime(void) {
+    return instance->time;
+}
+
+void TickGetStatistics(tick_statistics_t result) {
+    pthread_mutex_lock(&statistics_lock);
+    *result = *statistics;
+    pthread_mutex_unlock(&statistics_lock);
+    if (result->events == 0) {
+        result->lateness_min = 0;
+    }
+}
+
+void TickResetStatistics(void) {
+    pthread_mutex_lock(&statistics_lock);
+    memset(statistics, 0, sizeof(statistics));
+    statistics->lateness_min = UINT32_MAX;
+    lateness_sum = 0;
+    pthread_mutex_unlock(&statistics_lock);
+}
+
 void SysTick_Handler(void) {
     if (instance->handler) {
         instance->handler(instance->object);
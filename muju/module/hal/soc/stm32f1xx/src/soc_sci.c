@@ -405,6 +405,12 @@ void SciSetEventHandler(hal_sci_t sci, hal_sci_event_t handler, void * data) {
     }
 }
 
+void SciRaiseEvent(hal_sci_t sci) {
+    if (sci) {
+        NVIC_SetPendingIRQ(sci->interupt);
+    }
+}
+
 void USART1_IRQHandler(void) {
     SciHandleEvent(HAL_SCI_USART1);
 }
@@ -0,0 +1,309 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Buffered serial ports implementation
+ **
+ ** The ring buffers follow the algorithm of the lpc_open ring_buffer.c, with free running head
+ ** and tail positions and power of two sizes, so each buffer has a single writer and a single
+ ** reader and is shared with the interrupt without disabling it. The application only moves the
+ ** head of the transmission buffer and the tail of the reception buffer, and the fifos are only
+ ** accessed from the event handler.
+ **
+ ** @addtogroup hal HAL
+ ** @brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "hal_sci.h"
+#include <stddef.h>
+#include <string.h>
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure the maximum number of serial ports with buffers attached
+ */
+#ifndef HAL_SCI_BUFFERED_PORTS
+#define HAL_SCI_BUFFERED_PORTS 4
+#endif
+
+/**
+ * @brief Number of bytes moved from the input fifo to the reception buffer on each step
+ */
+#define SCI_BLOCK_SIZE 16
+
+/**
+ * @brief Maximum size of a ring buffer, the positions are 16 bits free running counters
+ */
+#define SCI_RING_LIMIT 32768
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Structure to store a ring buffer of bytes
+ */
+typedef struct sci_ring_s {
+    uint8_t * data;         /**< Memory used to store the data */
+    uint16_t mask;          /**< Size of the buffer minus one */
+    volatile uint16_t head; /**< Free running position where the next byte is stored */
+    volatile uint16_t tail; /**< Free running position of the oldest byte stored */
+} * sci_ring_t;
+
+/**
+ * @brief Structure to store the buffers attached to a serial port
+ */
+typedef struct sci_buffers_s {
+    hal_sci_t sci;            /**< Serial port that uses the buffers, NULL if the entry is free */
+    struct sci_ring_s output; /**< Transmission buffer, read by the event handler */
+    struct sci_ring_s input;  /**< Reception buffer, written by the event handler */
+    volatile uint32_t lost;   /**< Received bytes discarded because the buffer was full */
+} * sci_buffers_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to find the buffers attached to a serial port
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @return sci_buffers_t Pointer to the buffers of the serial port, NULL if it has none
+ */
+static sci_buffers_t FindBuffers(hal_sci_t sci);
+
+/**
+ * @brief Function to initialize a ring buffer
+ *
+ * @param  ring     Pointer to the ring buffer
+ * @param  data     Pointer to the memory used to store the data
+ * @param  size     Size of the memory, must be a power of two
+ * @return true     The ring buffer was initialized
+ * @return false    The memory or its size are invalid
+ */
+static bool RingInit(sci_ring_t ring, uint8_t * data, uint16_t size);
+
+/**
+ * @brief Function to copy data into a ring buffer, in at most two blocks
+ *
+ * @param  ring     Pointer to the ring buffer
+ * @param  data     Pointer to the data to store
+ * @param  size     Number of bytes to store
+ * @return uint16_t Number of bytes stored, limited by the free space
+ */
+static uint16_t RingInsert(sci_ring_t ring, uint8_t const * data, uint16_t size);
+
+/**
+ * @brief Function to copy data out of a ring buffer, in at most two blocks
+ *
+ * @param  ring     Pointer to the ring buffer
+ * @param  data     Pointer to the buffer to store the data
+ * @param  size     Maximum number of bytes to get
+ * @return uint16_t Number of bytes copied
+ */
+static uint16_t RingPop(sci_ring_t ring, uint8_t * data, uint16_t size);
+
+/**
+ * @brief Function to handle the events of a serial port with buffers attached
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @param  status   Pointer to structure with flags that raises the event
+ * @param  object   Pointer to the buffers of the serial port
+ */
+static void BuffersEvent(hal_sci_t sci, sci_status_t status, void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Vector to store the buffers attached to the serial ports
+ */
+static struct sci_buffers_s buffers[HAL_SCI_BUFFERED_PORTS] = {0};
+
+/* === Private function implementation ========================================================= */
+
+static sci_buffers_t FindBuffers(hal_sci_t sci) {
+    for (int index = 0; index < HAL_SCI_BUFFERED_PORTS; index++) {
+        if (buffers[index].sci == sci) {
+            return &buffers[index];
+        }
+    }
+    return NULL;
+}
+
+static bool RingInit(sci_ring_t ring, uint8_t * data, uint16_t size) {
+    if ((data == NULL) || (size == 0) || (size > SCI_RING_LIMIT) || ((size & (size - 1)) != 0)) {
+        return false;
+    }
+    ring->data = data;
+    ring->mask = size - 1;
+    ring->head = 0;
+    ring->tail = 0;
+    return true;
+}
+
+static uint16_t RingInsert(sci_ring_t ring, uint8_t const * data, uint16_t size) {
+    uint16_t head = ring->head;
+    uint16_t free = ring->mask + 1 - (uint16_t)(head - ring->tail);
+    uint16_t offset = head & ring->mask;
+    uint16_t first;
+
+    if (size > free) {
+        size = free;
+    }
+    first = ring->mask + 1 - offset;
+    if (first > size) {
+        first = size;
+    }
+    memcpy(&ring->data[offset], data, first);
+    memcpy(ring->data, &data[first], size - first);
+
+    // The data must be stored before the reader can see the new head
+    __sync_synchronize();
+    ring->head = head + size;
+    return size;
+}
+
+static uint16_t RingPop(sci_ring_t ring, uint8_t * data, uint16_t size) {
+    uint16_t tail = ring->tail;
+    uint16_t count = (uint16_t)(ring->head - tail);
+    uint16_t offset = tail & ring->mask;
+    uint16_t first;
+
+    if (size > count) {
+        size = count;
+    }
+    first = ring->mask + 1 - offset;
+    if (first > size) {
+        first = size;
+    }
+    memcpy(data, &ring->data[offset], first);
+    memcpy(&data[first], ring->data, size - first);
+
+    // The data must be read before the writer can reuse its space
+    __sync_synchronize();
+    ring->tail = tail + size;
+    return size;
+}
+
+static void BuffersEvent(hal_sci_t sci, sci_status_t status, void * object) {
+    sci_buffers_t self = object;
+    sci_ring_t output = &self->output;
+    uint8_t data[SCI_BLOCK_SIZE];
+    uint16_t count;
+    uint16_t offset;
+
+    // The fifos are checked directly, so the flags that raised the event are not needed
+    (void)status;
+
+    // The input fifo is always emptied, the bytes that do not fit in the buffer are discarded
+    while ((count = SciReceiveData(sci, data, sizeof(data))) > 0) {
+        self->lost += count - RingInsert(&self->input, data, count);
+    }
+
+    // The output fifo is filled with contiguous blocks straight from the transmission buffer
+    do {
+        count = (uint16_t)(output->head - output->tail);
+        offset = output->tail & output->mask;
+        if (count > output->mask + 1 - offset) {
+            count = output->mask + 1 - offset;
+        }
+        if (count > 0) {
+            count = SciSendData(sci, &output->data[offset], count);
+            output->tail += count;
+        }
+    } while (count > 0);
+}
+
+/* === Public function implementation ========================================================== */
+
+bool SciSetBuffers(hal_sci_t sci, uint8_t * output, uint16_t output_size, uint8_t * input,
+                   uint16_t input_size) {
+    sci_buffers_t self;
+    struct sci_buffers_s attached = {.sci = sci};
+
+    if (sci == NULL) {
+        return false;
+    }
+    self = FindBuffers(sci);
+    if (self == NULL) {
+        self = FindBuffers(NULL);
+    }
+    if ((self == NULL) || !RingInit(&attached.output, output, output_size) ||
+        !RingInit(&attached.input, input, input_size)) {
+        return false;
+    }
+
+    // The previous handler is removed before the buffers change under it
+    SciSetEventHandler(sci, NULL, NULL);
+    *self = attached;
+    SciSetEventHandler(sci, BuffersEvent, self);
+    return true;
+}
+
+uint16_t SciWrite(hal_sci_t sci, void const * data, uint16_t size) {
+    sci_buffers_t self = (sci != NULL) ? FindBuffers(sci) : NULL;
+    uint16_t result = 0;
+
+    if ((self != NULL) && (data != NULL)) {
+        result = RingInsert(&self->output, data, size);
+    }
+
+    // The fifo is only accessed by the event handler, so the transmission is started with an event
+    if (result > 0) {
+        SciRaiseEvent(sci);
+    }
+    return result;
+}
+
+uint16_t SciRead(hal_sci_t sci, void * data, uint16_t size) {
+    sci_buffers_t self = (sci != NULL) ? FindBuffers(sci) : NULL;
+
+    if ((self == NULL) || (data == NULL)) {
+        return 0;
+    }
+    return RingPop(&self->input, data, size);
+}
+
+uint32_t SciGetLost(hal_sci_t sci) {
+    sci_buffers_t self = (sci != NULL) ? FindBuffers(sci) : NULL;
+
+    return (self != NULL) ? self->lost : 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
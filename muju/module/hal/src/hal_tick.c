@@ -0,0 +1,216 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief System timer service implementation
+ **
+ ** @addtogroup hal HAL
+ ** @brief Hardware abstraction layer
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "hal_tick.h"
+#include <stddef.h>
+
+/**
+ *  @brief Include global project config file if it's defined
+ */
+#ifdef HAL_CONFIG_FILE
+#define STR(x)    #x     /**< Macro to convert the argument string to a constant string */
+#define TO_STR(x) STR(x) /**< Macro to convert the argument value to a constant string */
+#include TO_STR(HAL_CONFIG_FILE)
+#endif
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure the maximum number of subscribers of the system timer service
+ */
+#ifndef HAL_TICK_SUBSCRIBERS
+#define HAL_TICK_SUBSCRIBERS 8
+#endif
+
+/**
+ * @brief Macro to configure the maximum number of system timer events in the schedule
+ */
+#ifndef HAL_TICK_SCHEDULE_SIZE
+#define HAL_TICK_SCHEDULE_SIZE 120
+#endif
+
+#if HAL_TICK_SUBSCRIBERS > 16
+#error "HAL_TICK_SUBSCRIBERS can not be greater than 16"
+#endif
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Bit mask with the subscribers to call on a system timer event, ordered by priority
+ */
+typedef uint16_t tick_mask_t;
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to calculate the greatest common divisor of two values
+ *
+ * @param  a        First value
+ * @param  b        Second value
+ * @return uint32_t Greatest common divisor of both values
+ */
+static uint32_t GreatestCommonDivisor(uint32_t a, uint32_t b);
+
+/**
+ * @brief Function to call the subscribers scheduled on the current system timer event
+ *
+ * @param  object   Pointer to user data, required by function prototype, unused
+ */
+static void TickDispatch(void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/**
+ * @brief Vector with the registered subscribers, sorted by priority when the service starts
+ */
+static hal_tick_subscriber_t subscribers[HAL_TICK_SUBSCRIBERS] = {0};
+
+/**
+ * @brief Number of registered subscribers
+ */
+static uint8_t subscribers_count = 0;
+
+/**
+ * @brief Vector with the subscribers to call on each system timer event of the schedule
+ */
+static tick_mask_t schedule[HAL_TICK_SCHEDULE_SIZE] = {0};
+
+/**
+ * @brief Number of system timer events in the schedule before it repeats
+ */
+static uint16_t schedule_length = 0;
+
+/**
+ * @brief Position in the schedule of the next system timer event
+ */
+static uint16_t schedule_slot = 0;
+
+/* === Private function implementation ========================================================= */
+
+static uint32_t GreatestCommonDivisor(uint32_t a, uint32_t b) {
+    uint32_t rest;
+
+    while (b != 0) {
+        rest = a % b;
+        a = b;
+        b = rest;
+    }
+    return a;
+}
+
+static void TickDispatch(void * object) {
+    tick_mask_t pending = schedule[schedule_slot];
+    uint8_t index;
+
+    (void)object;
+    schedule_slot++;
+    if (schedule_slot >= schedule_length) {
+        schedule_slot = 0;
+    }
+
+    while (pending) {
+        index = __builtin_ctz(pending);
+        pending &= pending - 1;
+        subscribers[index]->handler(subscribers[index]->object);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+bool TickSubscribe(hal_tick_subscriber_t subscriber) {
+    if ((subscriber == NULL) || (subscriber->handler == NULL)) {
+        return false;
+    }
+    if ((schedule_length != 0) || (subscribers_count >= HAL_TICK_SUBSCRIBERS)) {
+        return false;
+    }
+    subscribers[subscribers_count] = subscriber;
+    subscribers_count++;
+    return true;
+}
+
+bool TickServiceStart(uint32_t period) {
+    hal_tick_subscriber_t current;
+    uint32_t length = 1;
+    uint16_t divider;
+    uint8_t index, position;
+    uint16_t slot;
+
+    if (schedule_length != 0) {
+        return false;
+    }
+
+    /* Insertion sort keeps the registration order between subscribers with the same priority */
+    for (index = 1; index < subscribers_count; index++) {
+        current = subscribers[index];
+        for (position = index; position > 0; position--) {
+            if (subscribers[position - 1]->priority <= current->priority) {
+                break;
+            }
+            subscribers[position] = subscribers[position - 1];
+        }
+        subscribers[position] = current;
+    }
+
+    for (index = 0; index < subscribers_count; index++) {
+        divider = subscribers[index]->divider ? subscribers[index]->divider : 1;
+        length = length / GreatestCommonDivisor(length, divider) * divider;
+        if (length > HAL_TICK_SCHEDULE_SIZE) {
+            return false;
+        }
+    }
+
+    for (slot = 0; slot < length; slot++) {
+        schedule[slot] = 0;
+        for (index = 0; index < subscribers_count; index++) {
+            divider = subscribers[index]->divider ? subscribers[index]->divider : 1;
+            if ((slot % divider) == (subscribers[index]->offset % divider)) {
+                schedule[slot] |= (1 << index);
+            }
+        }
+    }
+    schedule_length = length;
+    schedule_slot = 0;
+
+    TickStart(TickDispatch, NULL, period);
+    return true;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
@@ -0,0 +1,113 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef PROFILE_ARCH_H
+#define PROFILE_ARCH_H
+
+/** @file
+ ** @brief Cortex-M counter used by the code region profiling
+ **
+ ** The DWT cycle counter is available on Cortex-M3 and Cortex-M4 cores. Its registers are
+ ** accessed at their architectural addresses, the same used by the DWT and CoreDebug structures of
+ ** the CMSIS core headers, so the module does not depend on the device header of each SOC.
+ **
+ ** @addtogroup profile Profile
+ ** @brief Code region profiling
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/**
+ * @brief Name of the units of the profile measurements
+ */
+#define PROFILE_UNITS "cycles"
+
+/**
+ * @brief Debug Exception and Monitor Control Register, CoreDebug->DEMCR in CMSIS
+ */
+#define PROFILE_DEMCR (*(volatile uint32_t *)0xE000EDFCUL)
+
+/**
+ * @brief Trace enable bit of the DEMCR register, CoreDebug_DEMCR_TRCENA_Msk in CMSIS
+ */
+#define PROFILE_DEMCR_TRCENA (1UL << 24)
+
+/**
+ * @brief DWT Control Register, DWT->CTRL in CMSIS
+ */
+#define PROFILE_DWT_CTRL (*(volatile uint32_t *)0xE0001000UL)
+
+/**
+ * @brief Counter enable bit of the DWT control register, DWT_CTRL_CYCCNTENA_Msk in CMSIS
+ */
+#define PROFILE_DWT_CTRL_CYCCNTENA (1UL << 0)
+
+/**
+ * @brief DWT Cycle Count Register, DWT->CYCCNT in CMSIS
+ */
+#define PROFILE_DWT_CYCCNT (*(volatile uint32_t *)0xE0001004UL)
+
+/* === Public data type declarations =========================================================== */
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to start the cycle counter without clearing its current value
+ */
+static inline void ProfileArchInit(void) {
+    PROFILE_DEMCR |= PROFILE_DEMCR_TRCENA;
+    PROFILE_DWT_CTRL |= PROFILE_DWT_CTRL_CYCCNTENA;
+}
+
+/**
+ * @brief Function to read the free running cycle counter, a single load instruction
+ *
+ * @return uint32_t Current value of the counter
+ */
+static inline uint32_t ProfileArchRead(void) {
+    return PROFILE_DWT_CYCCNT;
+}
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* PROFILE_ARCH_H */
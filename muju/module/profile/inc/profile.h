@@ -0,0 +1,190 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/** @file
+ ** @brief Code region profiling declarations
+ **
+ ** Each region is identified by a small number chosen by the application and wrapped with the
+ ** PROFILE_BEGIN and PROFILE_END markers. The markers read a free running counter, the DWT cycle
+ ** counter on Cortex-M and a monotonic clock in nanoseconds on POSIX, and accumulate the count,
+ ** minimum, maximum and total time of the region in a static table.
+ **
+ ** @addtogroup profile Profile
+ ** @brief Code region profiling
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "profile_arch.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/**
+ * @brief Macro to configure the maximum number of regions in the profile table
+ */
+#ifndef PROFILE_REGIONS
+#define PROFILE_REGIONS 16
+#endif
+
+#ifndef PROFILE_DISABLE
+/**
+ * @brief Marks the start of a profiled region, must be used as a statement in the same block as
+ * the matching PROFILE_END
+ *
+ * @param  region   Number of the region in the profile table, an integer constant
+ */
+#define PROFILE_BEGIN(region) uint32_t profile_start_##region = ProfileArchRead()
+
+/**
+ * @brief Marks the end of a profiled region and records its duration
+ *
+ * @param  region   Number of the region in the profile table, an integer constant
+ */
+#define PROFILE_END(region)   ProfileRecord((region), profile_start_##region)
+#else
+#define PROFILE_BEGIN(region) (void)0
+#define PROFILE_END(region)   (void)0
+#endif
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Measurements of a profiled region, in counter units
+ */
+typedef struct profile_stats_s {
+    const char * name; /**< Name of the region, used when the table is dumped */
+    uint32_t count;    /**< Number of times the region was completed */
+    uint32_t min;      /**< Shortest duration of the region */
+    uint32_t max;      /**< Longest duration of the region */
+    uint64_t total;    /**< Sum of all the durations, used to calculate the mean */
+} profile_stats_t;
+
+/**
+ * @brief Callback function to write a line of text of the profile dump
+ *
+ * @param  object   Pointer to user data sended as parameter in the dump call
+ * @param  text     Null terminated line of text, including the line terminator
+ */
+typedef void (*profile_write_t)(void * object, const char * text);
+
+/* === Public variable declarations ============================================================ */
+
+/**
+ * @brief Table with the measurements of each region, updated inline by the markers
+ */
+extern profile_stats_t profile_table[PROFILE_REGIONS];
+
+/**
+ * @brief Counter units consumed by an empty pair of markers, discounted from every measurement
+ */
+extern uint32_t profile_overhead;
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to start the counter, measure the markers overhead and clear the table
+ */
+void ProfileInit(void);
+
+/**
+ * @brief Function to assign the name of a region
+ *
+ * @param  region   Number of the region in the profile table
+ * @param  name     Name of the region, must remain valid while the table is used
+ * @return true     The name was assigned
+ * @return false    The region number is out of the table
+ */
+bool ProfileSetName(uint8_t region, const char * name);
+
+/**
+ * @brief Function to clear the measurements of all the regions, keeping their names
+ */
+void ProfileReset(void);
+
+/**
+ * @brief Function to get a copy of the measurements of a region
+ *
+ * @param  region   Number of the region in the profile table
+ * @param  stats    Pointer to the structure where the measurements are copied
+ * @return true     The measurements were copied
+ * @return false    The region number is out of the table or the pointer is null
+ */
+bool ProfileGetStats(uint8_t region, profile_stats_t * stats);
+
+/**
+ * @brief Function to write the count, minimum, maximum and mean of the used regions as text
+ *
+ * @param  write    Function to call with each line of text
+ * @param  object   Pointer to user data sended as parameter in write calls
+ */
+void ProfileDump(profile_write_t write, void * object);
+
+/**
+ * @brief Function to record the duration of a region, called by the PROFILE_END marker
+ *
+ * The region must be lower than PROFILE_REGIONS, the value is not checked to keep the marker
+ * overhead low. A region must not be profiled from contexts that can preempt each other.
+ *
+ * @param  region   Number of the region in the profile table
+ * @param  start    Value of the counter read by the matching PROFILE_BEGIN marker
+ */
+static inline void ProfileRecord(uint8_t region, uint32_t start) {
+    uint32_t elapsed = ProfileArchRead() - start - profile_overhead;
+    profile_stats_t * stats = &profile_table[region];
+
+    /* The subtraction of the overhead can wrap on a region shorter than the calibration */
+    if (elapsed > UINT32_MAX / 2) {
+        elapsed = 0;
+    }
+    if (elapsed < stats->min) {
+        stats->min = elapsed;
+    }
+    if (elapsed > stats->max) {
+        stats->max = elapsed;
+    }
+    stats->total += elapsed;
+    stats->count++;
+}
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* PROFILE_H */
@@ -0,0 +1,150 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Code region profiling implementation
+ **
+ ** @addtogroup profile Profile
+ ** @brief Code region profiling
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "profile.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Macro to configure the maximum length of a line of the profile dump
+ */
+#ifndef PROFILE_LINE_SIZE
+#define PROFILE_LINE_SIZE 80
+#endif
+
+/**
+ * @brief Number of empty marker pairs measured to calibrate the overhead
+ */
+#define PROFILE_CALIBRATION_ROUNDS 8
+
+/* === Private data type declarations ========================================================== */
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/* === Public variable definitions ============================================================= */
+
+profile_stats_t profile_table[PROFILE_REGIONS];
+
+uint32_t profile_overhead = 0;
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+/* === Public function implementation ========================================================== */
+
+void ProfileInit(void) {
+    uint32_t start, elapsed;
+    uint32_t minimum = UINT32_MAX;
+    uint8_t round;
+
+    ProfileArchInit();
+
+    /* The shortest of several rounds discards the interrupts served during the calibration */
+    for (round = 0; round < PROFILE_CALIBRATION_ROUNDS; round++) {
+        start = ProfileArchRead();
+        elapsed = ProfileArchRead() - start;
+        if (elapsed < minimum) {
+            minimum = elapsed;
+        }
+    }
+    profile_overhead = minimum;
+
+    for (round = 0; round < PROFILE_REGIONS; round++) {
+        profile_table[round].name = NULL;
+    }
+    ProfileReset();
+}
+
+bool ProfileSetName(uint8_t region, const char * name) {
+    if (region >= PROFILE_REGIONS) {
+        return false;
+    }
+    profile_table[region].name = name;
+    return true;
+}
+
+void ProfileReset(void) {
+    uint8_t region;
+
+    for (region = 0; region < PROFILE_REGIONS; region++) {
+        profile_table[region].count = 0;
+        profile_table[region].min = UINT32_MAX;
+        profile_table[region].max = 0;
+        profile_table[region].total = 0;
+    }
+}
+
+bool ProfileGetStats(uint8_t region, profile_stats_t * stats) {
+    if ((region >= PROFILE_REGIONS) || (stats == NULL)) {
+        return false;
+    }
+    *stats = profile_table[region];
+    return true;
+}
+
+void ProfileDump(profile_write_t write, void * object) {
+    char line[PROFILE_LINE_SIZE];
+    profile_stats_t stats;
+    uint8_t region;
+
+    if (write == NULL) {
+        return;
+    }
+
+    snprintf(line, sizeof(line), "%-16s %10s %10s %10s %10s (%s)\r\n", "Region", "Count", "Min",
+             "Max", "Mean", PROFILE_UNITS);
+    write(object, line);
+
+    for (region = 0; region < PROFILE_REGIONS; region++) {
+        /* The copy is not atomic, a region updated meanwhile is only off by the last measurement */
+        stats = profile_table[region];
+        if (stats.count == 0) {
+            continue;
+        }
+        snprintf(line, sizeof(line), "%-16s %10lu %10lu %10lu %10lu\r\n",
+                 stats.name ? stats.name : "-", (unsigned long)stats.count,
+                 (unsigned long)stats.min, (unsigned long)stats.max,
+                 (unsigned long)(stats.total / stats.count));
+        write(object, line);
+    }
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
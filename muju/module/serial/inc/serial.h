@@ -0,0 +1,149 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SERIAL_H
+#define SERIAL_H
+
+/** @file
+ ** @brief Buffered serial ports declarations
+ **
+ ** The received data is stored by the interrupt in a FreeRTOS stream buffer. The data to transmit
+ ** is written by the sender directly in a ring buffer, reserving a block with SerialReserve and
+ ** releasing it with SerialCommit, and the interrupt copies it to the hardware output fifo filling
+ ** the whole fifo on each fifo empty event.
+ **
+ ** Each port supports one sending task and one receiving task. On POSIX the port is a pseudo
+ ** terminal, whose name is printed on the standard error when the port is created.
+ **
+ ** @addtogroup serial Serial
+ ** @brief Buffered serial ports
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "FreeRTOS.h"
+#include "hal_sci.h"
+#include <stdint.h>
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Structure with the settings of a buffered serial port
+ */
+typedef struct serial_config_s {
+    hal_sci_t sci;        /**< Serial port to use, ignored on POSIX */
+    hal_sci_line_t line;  /**< Line configuration of the serial port */
+    hal_sci_pins_t pins;  /**< Chip pins used by the serial port */
+    uint16_t output_size; /**< Size of the transmission buffer, a power of two up to 32768 */
+    uint16_t input_size;  /**< Size of the reception buffer */
+} const * serial_config_t;
+
+/**
+ * @brief Pointer to the structure with the buffered serial port descriptor
+ */
+typedef struct serial_s * serial_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to create a buffered serial port and start its interrupts
+ *
+ * @param  config   Pointer to the structure with the settings of the serial port
+ * @return serial_t Pointer to the serial port descriptor, NULL if the settings are invalid or
+ *                  there is not enough memory
+ */
+serial_t SerialCreate(serial_config_t config);
+
+/**
+ * @brief Function to reserve a contiguous block of the transmission buffer
+ *
+ * The block can be shorter than requested when the free space wraps around the end of the ring
+ * buffer, in which case the rest must be reserved with another call after the commit.
+ *
+ * @param  serial   Pointer to the serial port descriptor
+ * @param  buffer   Pointer to the variable where the address of the reserved block is stored
+ * @param  size     Number of bytes requested
+ * @param  timeout  Maximum number of ticks to wait for free space
+ * @return uint16_t Number of bytes reserved, zero if the timeout expired without free space
+ */
+uint16_t SerialReserve(serial_t serial, uint8_t ** buffer, uint16_t size, TickType_t timeout);
+
+/**
+ * @brief Function to release for transmission the data written in a reserved block
+ *
+ * @param  serial   Pointer to the serial port descriptor
+ * @param  count    Number of bytes written at the start of the last reserved block
+ */
+void SerialCommit(serial_t serial, uint16_t count);
+
+/**
+ * @brief Function to copy data into the transmission buffer
+ *
+ * @param  serial   Pointer to the serial port descriptor
+ * @param  data     Pointer to the data to transmit
+ * @param  size     Number of bytes to transmit
+ * @param  timeout  Maximum number of ticks to wait each time the transmission buffer is full
+ * @return uint16_t Number of bytes copied into the transmission buffer
+ */
+uint16_t SerialWrite(serial_t serial, void const * data, uint16_t size, TickType_t timeout);
+
+/**
+ * @brief Function to get the received data
+ *
+ * @param  serial   Pointer to the serial port descriptor
+ * @param  data     Pointer to the buffer to store the received data
+ * @param  size     Maximum number of bytes to get
+ * @param  timeout  Maximum number of ticks to wait for the first byte
+ * @return uint16_t Number of bytes stored in the buffer
+ */
+uint16_t SerialRead(serial_t serial, void * data, uint16_t size, TickType_t timeout);
+
+/**
+ * @brief Function to get the number of received bytes discarded because the buffer was full
+ *
+ * @param  serial   Pointer to the serial port descriptor
+ * @return uint32_t Number of received bytes lost since the port was created
+ */
+uint32_t SerialGetLost(serial_t serial);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen */
+
+#endif /* SERIAL_H */
@@ -0,0 +1,110 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+#ifndef SERIAL_DRIVER_H
+#define SERIAL_DRIVER_H
+
+/** @file
+ ** @brief Interface between the buffered serial ports and the hardware of each SOC
+ **
+ ** @addtogroup serial Serial
+ ** @brief Buffered serial ports
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions ================================================================ */
+
+#include "serial.h"
+
+/* === Cabecera C++ ============================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =============================================================== */
+
+/* === Public data type declarations =========================================================== */
+
+/**
+ * @brief Pointer to the structure with the hardware descriptor of a serial port
+ */
+typedef struct serial_driver_s * serial_driver_t;
+
+/* === Public variable declarations ============================================================ */
+
+/* === Public function declarations ============================================================ */
+
+/**
+ * @brief Function to configure the hardware of a serial port and start its events
+ *
+ * From this point the driver calls SerialHandleEvent, with the interrupts masked, every time the
+ * hardware can accept or deliver data.
+ *
+ * @param  config   Pointer to the structure with the settings of the serial port
+ * @param  serial   Pointer to the serial port descriptor sended to SerialHandleEvent
+ * @return serial_driver_t Pointer to the hardware descriptor, NULL if it can not be configured
+ */
+serial_driver_t SerialDriverOpen(serial_config_t config, serial_t serial);
+
+/**
+ * @brief Function to put data into the output fifo without waiting
+ *
+ * @param  driver   Pointer to the hardware descriptor
+ * @param  data     Pointer to the data to put in the output fifo
+ * @param  size     Number of bytes to put in the output fifo
+ * @return uint16_t Number of bytes accepted by the output fifo
+ */
+uint16_t SerialDriverSend(serial_driver_t driver, uint8_t const * data, uint16_t size);
+
+/**
+ * @brief Function to get data from the input fifo without waiting
+ *
+ * @param  driver   Pointer to the hardware descriptor
+ * @param  data     Pointer to the buffer to store the data from the input fifo
+ * @param  size     Maximum number of bytes to get
+ * @return uint16_t Number of bytes stored in the buffer
+ */
+uint16_t SerialDriverReceive(serial_driver_t driver, uint8_t * data, uint16_t size);
+
+/**
+ * @brief Function to move data between the buffers and the fifos of a serial port
+ *
+ * @param  serial     Pointer to the serial port descriptor
+ * @return BaseType_t pdTRUE if a task with higher priority was unblocked and a context switch
+ *                    must be requested
+ */
+BaseType_t SerialHandleEvent(serial_t serial);
+
+/* === End of documentation ==================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} End of module definition for doxygen
+ ** @endcond */
+
+#endif /* SERIAL_DRIVER_H */
@@ -0,0 +1,99 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Buffered serial ports on LPC43xx
+ **
+ ** @addtogroup serial Serial
+ ** @brief Buffered serial ports
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "serial_driver.h"
+#include "FreeRTOS.h"
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Structure to store the hardware descriptor of a serial port
+ */
+struct serial_driver_s {
+    hal_sci_t sci; /**< Serial port of the hardware abstraction layer */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to handle the interrupts of a serial port
+ *
+ * @param  sci      Pointer to the structure with the serial port descriptor
+ * @param  status   Pointer to structure with flags that raises the event
+ * @param  object   Pointer to the buffered serial port descriptor
+ */
+static void DriverEvent(hal_sci_t sci, sci_status_t status, void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void DriverEvent(hal_sci_t sci, sci_status_t status, void * object) {
+    portYIELD_FROM_ISR(SerialHandleEvent(object));
+}
+
+/* === Public function implementation ========================================================== */
+
+serial_driver_t SerialDriverOpen(serial_config_t config, serial_t serial) {
+    serial_driver_t driver = NULL;
+
+    if (SciSetConfig(config->sci, config->line, config->pins)) {
+        driver = pvPortMalloc(sizeof(struct serial_driver_s));
+    }
+    if (driver) {
+        driver->sci = config->sci;
+        SciSetEventHandler(driver->sci, DriverEvent, serial);
+    }
+    return driver;
+}
+
+uint16_t SerialDriverSend(serial_driver_t driver, uint8_t const * data, uint16_t size) {
+    return SciSendData(driver->sci, data, size);
+}
+
+uint16_t SerialDriverReceive(serial_driver_t driver, uint8_t * data, uint16_t size) {
+    return SciReceiveData(driver->sci, data, size);
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
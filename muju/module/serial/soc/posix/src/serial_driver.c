@@ -0,0 +1,148 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Buffered serial ports on POSIX
+ **
+ ** Each port is the master side of a pseudo terminal, the programs in the host use the slave
+ ** side. A kernel task of the highest priority polls the terminal on every tick and plays the role
+ ** of the interrupt, because threads outside the kernel can not call the FreeRTOS POSIX port.
+ **
+ ** @addtogroup serial Serial
+ ** @brief Buffered serial ports
+ ** @cond INTERNAL
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include "serial_driver.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+/* === Macros definitions ====================================================================== */
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Structure to store the hardware descriptor of a serial port
+ */
+struct serial_driver_s {
+    int master;      /**< File descriptor of the master side of the pseudo terminal */
+    int slave;       /**< Slave side, kept open so the port survives the host closing it */
+    serial_t serial; /**< Buffered serial port descriptor sended to the events */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function with the task that emulates the interrupts of a serial port
+ *
+ * @param  object   Pointer to the hardware descriptor, used as parameter when task created
+ */
+static void DriverTask(void * object);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void DriverTask(void * object) {
+    serial_driver_t driver = object;
+
+    while (true) {
+        // The tasks woken by the event run when this task blocks until the next tick
+        taskENTER_CRITICAL();
+        (void)SerialHandleEvent(driver->serial);
+        taskEXIT_CRITICAL();
+        vTaskDelay(1);
+    }
+}
+
+/* === Public function implementation ========================================================== */
+
+serial_driver_t SerialDriverOpen(serial_config_t config, serial_t serial) {
+    serial_driver_t driver = pvPortMalloc(sizeof(struct serial_driver_s));
+    struct termios settings;
+    const char * name = NULL;
+
+    if (driver == NULL) {
+        return NULL;
+    }
+    driver->serial = serial;
+    driver->slave = -1;
+    driver->master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if ((driver->master >= 0) && (grantpt(driver->master) == 0) && (unlockpt(driver->master) == 0)) {
+        name = ptsname(driver->master);
+    }
+    if (name != NULL) {
+        driver->slave = open(name, O_RDWR | O_NOCTTY);
+    }
+    if ((driver->slave >= 0) && (tcgetattr(driver->slave, &settings) == 0)) {
+        cfmakeraw(&settings);
+        tcsetattr(driver->slave, TCSANOW, &settings);
+    }
+
+    if ((driver->slave < 0) ||
+        (xTaskCreate(DriverTask, "Serial", configMINIMAL_STACK_SIZE, driver,
+                     configMAX_PRIORITIES - 1, NULL) != pdPASS)) {
+        if (driver->slave >= 0) {
+            close(driver->slave);
+        }
+        if (driver->master >= 0) {
+            close(driver->master);
+        }
+        vPortFree(driver);
+        return NULL;
+    }
+
+    fprintf(stderr, "Serial port on %s\n", name);
+    return driver;
+}
+
+uint16_t SerialDriverSend(serial_driver_t driver, uint8_t const * data, uint16_t size) {
+    ssize_t result = write(driver->master, data, size);
+    return (result > 0) ? result : 0;
+}
+
+uint16_t SerialDriverReceive(serial_driver_t driver, uint8_t * data, uint16_t size) {
+    ssize_t result = read(driver->master, data, size);
+    return (result > 0) ? result : 0;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen
+ ** @endcond */
@@ -0,0 +1,256 @@
+/************************************************************************************************
+Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+https://www.microprocesadores.unt.edu.ar/
+
+Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+associated documentation files (the "Software"), to deal in the Software without restriction,
+including without limitation the rights to use, copy, modify, merge, publish, distribute,
+sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial
+portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*************************************************************************************************/
+
+/** @file
+ ** @brief Buffered serial ports implementation
+ **
+ ** @addtogroup serial Serial
+ ** @brief Buffered serial ports
+ ** @{ */
+
+/* === Headers files inclusions =============================================================== */
+
+#include "serial.h"
+#include "serial_driver.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "task.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+/**
+ * @brief Number of bytes moved from the input fifo to the reception buffer on each step
+ */
+#define SERIAL_FIFO_SIZE 16
+
+/**
+ * @brief Maximum size of the transmission buffer, the positions are 16 bits free running counters
+ */
+#define SERIAL_OUTPUT_LIMIT 32768
+
+/* === Private data type declarations ========================================================== */
+
+/**
+ * @brief Structure to store a buffered serial port descriptor
+ *
+ * Only the sender writes the head of the transmission buffer and only the interrupt writes its
+ * tail, so the positions are shared without locks.
+ */
+struct serial_s {
+    serial_driver_t driver;     /**< Hardware descriptor of the serial port */
+    StreamBufferHandle_t input; /**< Reception buffer, written by the interrupt */
+    SemaphoreHandle_t space;    /**< Given by the interrupt when it frees transmission space */
+    uint8_t * output;           /**< Transmission ring buffer */
+    uint16_t mask;              /**< Size of the transmission buffer minus one */
+    volatile uint16_t head;     /**< Free running position of the next byte to commit */
+    volatile uint16_t tail;     /**< Free running position of the next byte to transmit */
+    volatile bool sending;      /**< A fifo empty event is expected from the hardware */
+    volatile uint32_t lost;     /**< Received bytes discarded because the buffer was full */
+};
+
+/* === Private variable declarations =========================================================== */
+
+/* === Private function declarations =========================================================== */
+
+/**
+ * @brief Function to release all the resources of a serial port descriptor
+ *
+ * @param  self     Pointer to the serial port descriptor
+ */
+static void SerialDestroy(serial_t self);
+
+/**
+ * @brief Function to move pending data from the transmission buffer to the output fifo
+ *
+ * @param  self     Pointer to the serial port descriptor
+ * @return uint16_t Number of bytes moved to the output fifo
+ */
+static uint16_t SerialTransmit(serial_t self);
+
+/* === Public variable definitions ============================================================= */
+
+/* === Private variable definitions ============================================================ */
+
+/* === Private function implementation ========================================================= */
+
+static void SerialDestroy(serial_t self) {
+    if (self->input) {
+        vStreamBufferDelete(self->input);
+    }
+    if (self->space) {
+        vSemaphoreDelete(self->space);
+    }
+    vPortFree(self->output);
+    vPortFree(self);
+}
+
+static uint16_t SerialTransmit(serial_t self) {
+    uint16_t total = 0;
+    uint16_t sent;
+
+    do {
+        uint16_t pending = self->head - self->tail;
+        uint16_t offset = self->tail & self->mask;
+        uint16_t contiguous = self->mask + 1 - offset;
+
+        sent = 0;
+        if (pending > 0) {
+            sent = SerialDriverSend(self->driver, &self->output[offset],
+                                    (pending < contiguous) ? pending : contiguous);
+        }
+        self->tail += sent;
+        total += sent;
+    } while (sent > 0);
+
+    // While the hardware holds data or there is data waiting for room, a fifo empty event follows
+    self->sending = (total > 0) || (self->head != self->tail);
+    return total;
+}
+
+/* === Public function implementation ========================================================== */
+
+serial_t SerialCreate(serial_config_t config) {
+    serial_t self;
+
+    if ((config == NULL) || (config->input_size == 0) || (config->output_size == 0) ||
+        (config->output_size > SERIAL_OUTPUT_LIMIT) ||
+        ((config->output_size & (config->output_size - 1)) != 0)) {
+        return NULL;
+    }
+
+    self = pvPortMalloc(sizeof(struct serial_s));
+    if (self == NULL) {
+        return NULL;
+    }
+    memset(self, 0, sizeof(struct serial_s));
+    self->mask = config->output_size - 1;
+    self->output = pvPortMalloc(config->output_size);
+    self->input = xStreamBufferCreate(config->input_size, 1);
+    self->space = xSemaphoreCreateBinary();
+
+    // The driver starts the events, so it is opened only when the descriptor is complete
+    if (self->output && self->input && self->space) {
+        self->driver = SerialDriverOpen(config, self);
+    }
+    if (self->driver == NULL) {
+        SerialDestroy(self);
+        self = NULL;
+    }
+    return self;
+}
+
+uint16_t SerialReserve(serial_t self, uint8_t ** buffer, uint16_t size, TickType_t timeout) {
+    TimeOut_t start;
+    uint16_t granted = 0;
+
+    if ((self == NULL) || (buffer == NULL)) {
+        return 0;
+    }
+
+    vTaskSetTimeOutState(&start);
+    while (size > 0) {
+        uint16_t offset = self->head & self->mask;
+        uint16_t available = self->mask + 1 - (uint16_t)(self->head - self->tail);
+        uint16_t contiguous = self->mask + 1 - offset;
+
+        granted = (size < available) ? size : available;
+        granted = (granted < contiguous) ? granted : contiguous;
+        if (granted > 0) {
+            *buffer = &self->output[offset];
+            break;
+        }
+        if (xTaskCheckForTimeOut(&start, &timeout) != pdFALSE) {
+            break;
+        }
+        xSemaphoreTake(self->space, timeout);
+    }
+    return granted;
+}
+
+void SerialCommit(serial_t self, uint16_t count) {
+    if ((self == NULL) || (count == 0)) {
+        return;
+    }
+
+    self->head += count;
+
+    // Without a pending fifo empty event the transmission must be started here
+    taskENTER_CRITICAL();
+    if (!self->sending) {
+        SerialTransmit(self);
+    }
+    taskEXIT_CRITICAL();
+}
+
+uint16_t SerialWrite(serial_t self, void const * data, uint16_t size, TickType_t timeout) {
+    uint8_t const * bytes = data;
+    uint16_t written = 0;
+    uint16_t granted;
+    uint8_t * buffer;
+
+    while (written < size) {
+        granted = SerialReserve(self, &buffer, size - written, timeout);
+        if (granted == 0) {
+            break;
+        }
+        memcpy(buffer, &bytes[written], granted);
+        SerialCommit(self, granted);
+        written += granted;
+    }
+    return written;
+}
+
+uint16_t SerialRead(serial_t self, void * data, uint16_t size, TickType_t timeout) {
+    if ((self == NULL) || (data == NULL)) {
+        return 0;
+    }
+    return xStreamBufferReceive(self->input, data, size, timeout);
+}
+
+uint32_t SerialGetLost(serial_t self) {
+    return self ? self->lost : 0;
+}
+
+BaseType_t SerialHandleEvent(serial_t self) {
+    uint8_t data[SERIAL_FIFO_SIZE];
+    BaseType_t woken = pdFALSE;
+    uint16_t count;
+
+    // The input fifo is always emptied, the bytes that do not fit in the buffer are discarded
+    while ((count = SerialDriverReceive(self->driver, data, sizeof(data))) > 0) {
+        self->lost += count - xStreamBufferSendFromISR(self->input, data, count, &woken);
+    }
+
+    if (SerialTransmit(self) > 0) {
+        xSemaphoreGiveFromISR(self->space, &woken);
+    }
+    return woken;
+}
+
+/* === End of documentation ==================================================================== */
+
+/** @} End of module definition for doxygen */
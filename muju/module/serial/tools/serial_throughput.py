@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+##################################################################################################
+# Copyright (c) 2022-2023, Laboratorio de Microprocesadores
+# Facultad de Ciencias Exactas y Tecnología, Universidad Nacional de Tucumán
+# https://www.microprocesadores.unt.edu.ar/
+#
+# Copyright (c) 2022-2023, Esteban Volentini <evolentini@herrera.unt.edu.ar>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+# associated documentation files (the "Software"), to deal in the Software without restriction,
+# including without limitation the rights to use, copy, modify, merge, publish, distribute,
+# sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial
+# portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT
+# NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+# NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
+# OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+##################################################################################################
+"""Measures the throughput of a serial port that sends back every received byte, like the
+examples/freertos/serial sample, and checks that the data returns unchanged.
+
+The data sent ahead of the echo is limited to a window, which must not be larger than the
+reception buffer of the port because the bytes that do not fit in it are discarded.
+
+On POSIX the port is the pseudo terminal printed by the sample when it starts.
+"""
+
+import argparse
+import os
+import select
+import sys
+import termios
+import time
+import tty
+
+
+def pattern(size):
+    """Returns a block of data that repeats every 251 bytes, so misplaced blocks are detected"""
+    return bytes(index % 251 for index in range(size))
+
+
+def measure(port, total, block, window):
+    """Sends total bytes in chunks of block bytes, never more than window bytes ahead of the
+    echo, and returns the elapsed seconds and the number of mismatched bytes"""
+    data = pattern(total)
+    received = bytearray()
+    sent = 0
+
+    start = time.monotonic()
+    while len(received) < total:
+        ahead = min(block, window - (sent - len(received)), total - sent)
+        writers = [port] if ahead > 0 else []
+        readable, writable, _ = select.select([port], writers, [], 2.0)
+        if not readable and not writable:
+            sys.exit(f"timeout after {len(received)} of {total} bytes")
+        if writable:
+            sent += os.write(port, data[sent : sent + ahead])
+        if readable:
+            received += os.read(port, 65536)
+    elapsed = time.monotonic() - start
+
+    errors = sum(1 for got, expected in zip(received, data) if got != expected)
+    return elapsed, errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", help="serial device or pseudo terminal of the sample")
+    parser.add_argument("--bytes", type=int, default=1 << 20, help="amount of data to send")
+    parser.add_argument("--block", type=int, default=256, help="maximum size of each write")
+    parser.add_argument("--window", type=int, default=512, help="maximum data sent ahead")
+    arguments = parser.parse_args()
+
+    port = os.open(arguments.port, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    try:
+        tty.setraw(port)
+        termios.tcflush(port, termios.TCIOFLUSH)
+        elapsed, errors = measure(
+            port, arguments.bytes, arguments.block, arguments.window
+        )
+    finally:
+        os.close(port)
+
+    print(f"Transferred: {arguments.bytes} bytes each way in {elapsed:.3f} s")
+    print(f"Throughput: {arguments.bytes / elapsed / 1024:.1f} KiB/s")
+    print(f"Errors: {errors}")
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
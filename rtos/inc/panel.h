@@ -0,0 +1,124 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file panel.h
+ ** @brief Recursos del poncho utilizados por la edicion del reloj sobre FreeRTOS
+ **/
+
+#ifndef PANEL_H_
+#define PANEL_H_
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdbool.h>
+#include <stdint.h>
+#include "hal.h"
+#include "screen.h"
+#include "clock_source.h"
+
+/* === Header for C++ compatibility ================================================================================ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+//! Cantidad de digitos de la pantalla
+#define PANEL_DIGITS 4
+
+//! Cantidad de teclas, en el mismo orden que los eventos de teclas de la interfaz
+#define PANEL_KEYS 6
+
+/* === Public data type declarations =============================================================================== */
+
+//! Recursos del poncho que utiliza la aplicacion
+typedef struct panel_s {
+    screen_t screen;                 // Pantalla de siete segmentos multiplexada
+    hal_gpio_bit_t keys[PANEL_KEYS]; // Teclas en el orden de los eventos de la interfaz
+    hal_gpio_bit_t alarm_led;        // Led que indica que la alarma esta sonando
+    hal_sci_t console;               // Puerto serie para los informes, NULL si se usa la salida de errores
+} const * panel_t;
+
+/* === Public variable declarations ================================================================================ */
+
+/* === Public function declarations ================================================================================ */
+
+/**
+ * @brief Configura los terminales del poncho y crea la pantalla.
+ *
+ * En la placa posix las teclas 1 a 6 del teclado de la PC emulan las teclas del poncho, o bien se leen de un guion
+ * indicado con la variable de entorno HAL_GPIO_SCRIPT. En el guion las teclas se nombran F1 a F4, ACCEPT y CANCEL, por
+ * ejemplo "t=1500ms press F1", y los eventos se aplican en sincronismo con el tick del sistema operativo.
+ *
+ * @return Un puntero a los recursos del poncho o NULL si no se pudo crear la pantalla.
+ */
+panel_t PanelCreate(void);
+
+/**
+ * @brief Lee el estado de una tecla sin filtrar rebotes.
+ *
+ * @param panel Puntero a los recursos del poncho.
+ * @param key Indice de la tecla, entre 0 y PANEL_KEYS - 1.
+ * @return true si la tecla esta presionada, false si esta libre o el indice es invalido.
+ */
+bool PanelKeyIsPressed(panel_t panel, uint8_t key);
+
+/**
+ * @brief Enciende o apaga el led de la alarma.
+ *
+ * @param panel Puntero a los recursos del poncho.
+ * @param active true para encender el led, false para apagarlo.
+ */
+void PanelSetAlarmLed(panel_t panel, bool active);
+
+/**
+ * @brief Envia un texto por la consola, esperando hasta que se haya transmitido completo.
+ *
+ * @param panel Puntero a los recursos del poncho.
+ * @param text Cadena terminada en cero que se desea enviar.
+ */
+void PanelConsoleWrite(panel_t panel, const char * text);
+
+/**
+ * @brief Devuelve la fuente de la hora del dia que se utiliza para crear el reloj.
+ *
+ * En POSIX, si esta definida la variable de entorno RTOS_LOCAL_TIME, la hora se toma del reloj de la PC. Sin la
+ * variable, y en la placa, el reloj solo cuenta los ticks, asi los guiones de entradas son reproducibles.
+ *
+ * @param panel Puntero a los recursos del poncho.
+ * @return Un puntero a la fuente de la hora, o NULL si el reloj no utiliza una fuente externa.
+ */
+clock_source_t PanelClockSource(panel_t panel);
+
+/**
+ * @brief Guarda una copia de las trazas del sistema operativo para decodificarlas en la computadora.
+ *
+ * En POSIX la copia se escribe en el archivo indicado por la variable de entorno RTOS_TRACE_FILE. En la placa no hace
+ * nada, el vector trace_buffer se copia con el depurador.
+ *
+ * @param panel Puntero a los recursos del poncho.
+ */
+void PanelSaveTrace(panel_t panel);
+
+/* === End of conditional blocks =================================================================================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PANEL_H_ */
@@ -0,0 +1,356 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file main.c
+ ** @brief Reloj despertador sobre FreeRTOS
+ **
+ ** Cada actividad del reloj es una tarea: la multiplexacion de la pantalla, el muestreo de las teclas, el avance de la
+ ** hora y la interfaz de usuario. Las teclas llegan a la interfaz por una cola y los segundos por un grupo de eventos,
+ ** que tambien despierta a la interfaz cuando hay teclas pendientes. Una tarea de menor prioridad informa
+ ** periodicamente el uso del procesador, la pila libre de cada tarea, el modo de la interfaz y la duracion de las
+ ** regiones medidas con el modulo de perfilado.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include <stdio.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "profile.h"
+#include "panel.h"
+#include "clock.h"
+#include "ui.h"
+
+/* === Private macros definitions ================================================================================== */
+
+#define DISPLAY_PERIOD_MS 1   // Cada digito se refresca durante un milisegundo
+#define COMPOSE_DIVIDER   10  // La pantalla se recompone cada 10 refrescos
+#define BLINK_PERIOD      100 // El punto parpadea una vez por segundo (100 composiciones)
+
+#define KEYS_PERIOD_MS 10 // Periodo de muestreo de las teclas
+#define KEYS_DEBOUNCE  3  // Muestras iguales consecutivas para aceptar un cambio de estado
+#define KEYS_QUEUE     8  // Teclas que pueden esperar a ser procesadas por la interfaz
+#define KEYS_QUEUE_ID  1  // Numero que identifica a la cola de teclas en las trazas
+
+#define CLOCK_PERIOD_MS        10 // Periodo de avance del reloj
+#define CLOCK_TICKS_PER_SECOND (1000 / CLOCK_PERIOD_MS)
+
+#define MONITOR_PERIOD_MS 5000 // Periodo de los informes de uso del procesador y de la pila
+#define MONITOR_TASKS     8    // Maxima cantidad de tareas que se informan
+#define MONITOR_LINE      64   // Longitud maxima de una linea del informe
+
+// Regiones de codigo medidas con el modulo de perfilado
+#define REGION_REFRESH 0 // Multiplexado de un digito de la pantalla
+#define REGION_COMPOSE 1 // Recomposicion de la pantalla con los digitos de la interfaz
+#define REGION_CLOCK   2 // Avance del reloj
+
+// Bits del grupo de eventos que despierta a la interfaz
+#define UI_EVENT_KEY    (1 << 0) // Hay teclas pendientes en la cola
+#define UI_EVENT_SECOND (1 << 1) // La hora actual avanzo un segundo
+
+// Prioridades de las tareas, la pantalla tiene la mayor prioridad para no introducir parpadeos
+#define DISPLAY_PRIORITY (tskIDLE_PRIORITY + 5)
+#define CLOCK_PRIORITY   (tskIDLE_PRIORITY + 4)
+#define KEYS_PRIORITY    (tskIDLE_PRIORITY + 3)
+#define UI_PRIORITY      (tskIDLE_PRIORITY + 2)
+#define MONITOR_PRIORITY (tskIDLE_PRIORITY + 1)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Informa un error por la consola y detiene la ejecucion del programa.
+ * @param message Descripcion del error.
+ */
+static void StopByError(const char * message);
+
+/**
+ * @brief Refresca un digito de la pantalla por periodo y la recompone con los digitos de la interfaz.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void DisplayTask(void * object);
+
+/**
+ * @brief Muestrea las teclas, filtra los rebotes y envia a la interfaz cada tecla liberada.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void KeysTask(void * object);
+
+/**
+ * @brief Hace avanzar el reloj y avisa a la interfaz cada vez que cambia el segundo.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void ClockTask(void * object);
+
+/**
+ * @brief Espera teclas o segundos y los procesa en la maquina de estados de la interfaz.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void UiTask(void * object);
+
+/**
+ * @brief Informa periodicamente el porcentaje de uso del procesador y la pila libre de cada tarea.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void MonitorTask(void * object);
+
+/**
+ * @brief Escribe por la consola una linea del informe de perfilado.
+ * @param object Puntero a datos del informe, no se utiliza.
+ * @param text Linea de texto que se debe escribir.
+ */
+static void MonitorWrite(void * object, const char * text);
+
+static void UiFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
+static void UiAlarmIndicator(bool active);
+
+/* === Private variable definitions ================================================================================ */
+
+static panel_t panel;
+static clock_t clock;
+static ui_t ui;
+
+static QueueHandle_t keys_queue;      // Teclas liberadas pendientes de procesar
+static EventGroupHandle_t ui_events; // Eventos que despiertan a la interfaz
+static SemaphoreHandle_t state_lock; // Protege el reloj y los digitos de la interfaz entre las tareas
+
+static const struct ui_driver_s ui_driver = {
+    .FlashDigits = UiFlashDigits,
+    .AlarmIndicator = UiAlarmIndicator,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function implementation ============================================================================= */
+
+static void StopByError(const char * message) {
+    PanelConsoleWrite(panel, message);
+    taskDISABLE_INTERRUPTS();
+    while (true) {
+    }
+}
+
+static void UiFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    // La tarea de la pantalla usa la configuracion del parpadeo en cada refresco, no debe verla a medio cambiar
+    taskENTER_CRITICAL();
+    DisplayFlashDigits(panel->screen, from, to, divisor);
+    taskEXIT_CRITICAL();
+}
+
+static void UiAlarmIndicator(bool active) {
+    PanelSetAlarmLed(panel, active);
+}
+
+static void DisplayTask(void * object) {
+    TickType_t last_wake = xTaskGetTickCount();
+    uint8_t compose_count = 0;
+    uint8_t blink_count = 0;
+
+    while (true) {
+        PROFILE_BEGIN(REGION_REFRESH);
+        ScreenRefresh(panel->screen);
+        PROFILE_END(REGION_REFRESH);
+
+        // Si la interfaz esta cambiando sus digitos la pantalla no espera, los toma en el siguiente refresco
+        compose_count = (compose_count + 1) % COMPOSE_DIVIDER;
+        if ((compose_count == 0) && (xSemaphoreTake(state_lock, 0) != pdTRUE)) {
+            compose_count = COMPOSE_DIVIDER - 1;
+        } else if (compose_count == 0) {
+            PROFILE_BEGIN(REGION_COMPOSE);
+            ScreenWriteBCD(panel->screen, UiGetDigits(ui), UI_DIGITS);
+            ScreenWriteDOT(panel->screen, UiGetDots(ui), UI_DIGITS);
+            xSemaphoreGive(state_lock);
+
+            blink_count = (blink_count + 1) % BLINK_PERIOD;
+            if (blink_count < BLINK_PERIOD / 2) {
+                ScreenToggleDot(panel->screen, 1);
+            }
+            PROFILE_END(REGION_COMPOSE);
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(DISPLAY_PERIOD_MS));
+    }
+}
+
+static void KeysTask(void * object) {
+    TickType_t last_wake = xTaskGetTickCount();
+    uint8_t debounce[PANEL_KEYS] = {0};
+    uint8_t pressed = 0; // Estado filtrado de las teclas, un bit por tecla
+
+    while (true) {
+        for (uint8_t key = 0; key < PANEL_KEYS; key++) {
+            bool current = PanelKeyIsPressed(panel, key);
+
+            if (current == ((pressed >> key) & 1)) {
+                debounce[key] = 0;
+            } else if (++debounce[key] >= KEYS_DEBOUNCE) {
+                debounce[key] = 0;
+                pressed ^= (1 << key);
+                if (!current) {
+                    uint8_t event = EVENT_KEY_SET_TIME + key;
+                    xQueueSend(keys_queue, &event, 0);
+                    xEventGroupSetBits(ui_events, UI_EVENT_KEY);
+                }
+            }
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(KEYS_PERIOD_MS));
+    }
+}
+
+static void ClockTask(void * object) {
+    TickType_t last_wake = xTaskGetTickCount();
+    clock_time_t current_time = {0};
+    uint8_t last_second = 0;
+
+    while (true) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(CLOCK_PERIOD_MS));
+        xSemaphoreTake(state_lock, portMAX_DELAY);
+        PROFILE_BEGIN(REGION_CLOCK);
+        ClockNewTick(clock);
+        PROFILE_END(REGION_CLOCK);
+        ClockGetTime(clock, &current_time);
+        xSemaphoreGive(state_lock);
+        if (current_time.bcd[0] != last_second) {
+            last_second = current_time.bcd[0];
+            xEventGroupSetBits(ui_events, UI_EVENT_SECOND);
+        }
+    }
+}
+
+static void UiTask(void * object) {
+    EventBits_t bits;
+    uint8_t event;
+
+    while (true) {
+        bits = xEventGroupWaitBits(ui_events, UI_EVENT_KEY | UI_EVENT_SECOND, pdTRUE, pdFALSE, portMAX_DELAY);
+
+        // La interfaz modifica el reloj y sus digitos, el mutex evita que el reloj o la pantalla la interrumpan a
+        // medio cambio, y la herencia de prioridad evita que la tarea del reloj espere a las de menor prioridad
+        xSemaphoreTake(state_lock, portMAX_DELAY);
+        if (bits & UI_EVENT_SECOND) {
+            UiProcessEvent(ui, EVENT_CLOCK_SECOND);
+        }
+        while (xQueueReceive(keys_queue, &event, 0) == pdTRUE) {
+            UiProcessEvent(ui, event);
+        }
+        xSemaphoreGive(state_lock);
+    }
+}
+
+static void MonitorTask(void * object) {
+    static TaskStatus_t tasks[MONITOR_TASKS];
+    static uint32_t previous[MONITOR_TASKS]; // Tiempo acumulado en el informe anterior, por numero de tarea
+    TickType_t last_wake = xTaskGetTickCount();
+    char line[MONITOR_LINE];
+
+    while (true) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(MONITOR_PERIOD_MS));
+
+        UBaseType_t count = uxTaskGetSystemState(tasks, MONITOR_TASKS, NULL);
+        uint32_t elapsed[MONITOR_TASKS];
+        uint32_t total = 0;
+
+        // Los contadores se comparan con el informe anterior, por lo que su desborde no afecta al resultado
+        for (UBaseType_t index = 0; index < count; index++) {
+            uint8_t slot = tasks[index].xTaskNumber % MONITOR_TASKS;
+            elapsed[index] = tasks[index].ulRunTimeCounter - previous[slot];
+            previous[slot] = tasks[index].ulRunTimeCounter;
+            total += elapsed[index];
+        }
+
+        PanelConsoleWrite(panel, "\r\nTarea            CPU  Pila libre\r\n");
+        for (UBaseType_t index = 0; index < count; index++) {
+            uint32_t percent = (total >= 100) ? elapsed[index] / (total / 100) : 0;
+            snprintf(line, sizeof(line), "%-*s %3u%%  %5u\r\n", configMAX_TASK_NAME_LEN, tasks[index].pcTaskName,
+                     (unsigned int)percent, (unsigned int)tasks[index].usStackHighWaterMark);
+            PanelConsoleWrite(panel, line);
+        }
+
+        xSemaphoreTake(state_lock, portMAX_DELAY);
+        system_mode_t mode = UiGetMode(ui);
+        xSemaphoreGive(state_lock);
+        snprintf(line, sizeof(line), "\r\nModo de la interfaz %u\r\n", (unsigned int)mode);
+        PanelConsoleWrite(panel, line);
+
+        PanelConsoleWrite(panel, "\r\n");
+        ProfileDump(MonitorWrite, NULL);
+        PanelSaveTrace(panel);
+    }
+}
+
+static void MonitorWrite(void * object, const char * text) {
+    PanelConsoleWrite(panel, text);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(void) {
+    panel = PanelCreate();
+    // La interfaz configura el parpadeo de la pantalla del poncho al crearse, por lo que el poncho se verifica antes
+    if (panel == NULL) {
+        StopByError("No se pudo crear la pantalla del poncho\r\n");
+    }
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, PanelClockSource(panel));
+    ui = UiCreate(clock, &ui_driver);
+    keys_queue = xQueueCreate(KEYS_QUEUE, sizeof(uint8_t));
+    ui_events = xEventGroupCreate();
+    state_lock = xSemaphoreCreateMutex();
+
+    ProfileInit();
+    ProfileSetName(REGION_REFRESH, "ScreenRefresh");
+    ProfileSetName(REGION_COMPOSE, "Compose");
+    ProfileSetName(REGION_CLOCK, "ClockNewTick");
+
+    if ((clock == NULL) || (ui == NULL) || (keys_queue == NULL) || (ui_events == NULL) || (state_lock == NULL)) {
+        StopByError("No hay memoria para crear los objetos de la aplicacion\r\n");
+    }
+    vQueueSetQueueNumber(keys_queue, KEYS_QUEUE_ID);
+
+    if (xTaskCreate(DisplayTask, "Pantalla", configMINIMAL_STACK_SIZE, NULL, DISPLAY_PRIORITY, NULL) != pdPASS) {
+        StopByError("No se pudo crear la tarea de la pantalla\r\n");
+    }
+    if (xTaskCreate(KeysTask, "Teclas", configMINIMAL_STACK_SIZE, NULL, KEYS_PRIORITY, NULL) != pdPASS) {
+        StopByError("No se pudo crear la tarea de las teclas\r\n");
+    }
+    if (xTaskCreate(ClockTask, "Reloj", configMINIMAL_STACK_SIZE, NULL, CLOCK_PRIORITY, NULL) != pdPASS) {
+        StopByError("No se pudo crear la tarea del reloj\r\n");
+    }
+    if (xTaskCreate(UiTask, "Interfaz", 2 * configMINIMAL_STACK_SIZE, NULL, UI_PRIORITY, NULL) != pdPASS) {
+        StopByError("No se pudo crear la tarea de la interfaz\r\n");
+    }
+    if (xTaskCreate(MonitorTask, "Monitor", 4 * configMINIMAL_STACK_SIZE, NULL, MONITOR_PRIORITY, NULL) != pdPASS) {
+        StopByError("No se pudo crear la tarea del monitor\r\n");
+    }
+
+    vTaskStartScheduler();
+
+    // vTaskStartScheduler solo retorna si no hay memoria para crear la tarea inactiva
+    StopByError("No se pudo iniciar el sistema operativo\r\n");
+    return 0;
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t task, char * name) {
+    PanelConsoleWrite(panel, "Desborde de pila en la tarea ");
+    StopByError(name);
+}
+
+/* === End of documentation ======================================================================================== */
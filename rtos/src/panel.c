@@ -0,0 +1,300 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file panel.c
+ ** @brief Recursos del poncho utilizados por la edicion del reloj sobre FreeRTOS
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "panel.h"
+#include "board.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "freertos_trace.h"
+#include <string.h>
+
+#ifdef POSIX
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#endif
+
+/* === Private macros definitions ================================================================================== */
+
+//! Cantidad de terminales de segmentos, siete segmentos y el punto
+#define PANEL_SEGMENTS 8
+
+/* === Private data type declarations ============================================================================== */
+
+//! Terminales del poncho y su polaridad en la placa seleccionada
+struct panel_pins_s {
+    hal_gpio_bit_t digits[PANEL_DIGITS];     // Anodos de los digitos, de izquierda a derecha
+    hal_gpio_bit_t segments[PANEL_SEGMENTS]; // Segmentos en el orden de SEGMENT_A a SEGMENT_P
+    bool keys_inverted;                      // Las teclas se leen en cero al presionarlas
+    bool led_inverted;                       // El led se enciende con un cero
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Asigna los terminales del poncho segun la placa seleccionada.
+ * @param panel Estructura donde se asignan las teclas, el led y la consola.
+ */
+static void AssignResources(struct panel_s * panel);
+
+//! Apaga todos los digitos y segmentos de la pantalla
+static void DigitsTurnOff(void);
+
+//! Enciende los segmentos indicados, uno por bit en el orden de SEGMENT_A a SEGMENT_P
+static void SegmentsUpdate(uint8_t value);
+
+//! Enciende el digito indicado, contando desde la izquierda
+static void DigitTurnOn(uint8_t digit);
+
+#ifdef POSIX
+//! Escribe un bloque de la copia de las trazas en el archivo recibido como parametro
+static void TraceWriteFile(void * object, const void * data, uint32_t size);
+#endif
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+static struct panel_pins_s pins;
+
+static const struct screen_driver_s screen_driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+#ifdef POSIX
+//! Nombres de las teclas del poncho en los guiones de entradas, en el orden de las teclas del panel
+static const char * const key_names[PANEL_KEYS] = {"F1", "F2", "F3", "F4", "ACCEPT", "CANCEL"};
+#endif
+
+/* === Private function implementation ============================================================================= */
+
+static void AssignResources(struct panel_s * panel) {
+#ifdef EDU_CIAA_NXP
+    static const struct hal_sci_line_s console_line = {
+        .baud_rate = 115200,
+        .data_bits = 8,
+        .parity = HAL_SCI_NO_PARITY,
+    };
+    struct hal_sci_pins_s console_pins = {
+        .txd_pin = HAL_PIN_P7_1,
+        .rxd_pin = HAL_PIN_P7_2,
+    };
+
+    pins.digits[0] = HAL_GPIO0_3;
+    pins.digits[1] = HAL_GPIO0_2;
+    pins.digits[2] = HAL_GPIO0_1;
+    pins.digits[3] = HAL_GPIO0_0;
+
+    pins.segments[0] = HAL_GPIO2_0;
+    pins.segments[1] = HAL_GPIO2_1;
+    pins.segments[2] = HAL_GPIO2_2;
+    pins.segments[3] = HAL_GPIO2_3;
+    pins.segments[4] = HAL_GPIO2_4;
+    pins.segments[5] = HAL_GPIO2_5;
+    pins.segments[6] = HAL_GPIO2_6;
+    pins.segments[7] = HAL_GPIO5_16;
+
+    panel->keys[0] = HAL_GPIO5_12; // F1, ajustar hora
+    panel->keys[1] = HAL_GPIO5_13; // F2, ajustar alarma
+    panel->keys[2] = HAL_GPIO5_14; // F3, decrementar
+    panel->keys[3] = HAL_GPIO5_15; // F4, incrementar
+    panel->keys[4] = HAL_GPIO5_9;  // Aceptar
+    panel->keys[5] = HAL_GPIO5_8;  // Cancelar
+    pins.keys_inverted = true;
+
+    panel->alarm_led = HAL_GPIO0_10; // Canal azul del led RGB
+    pins.led_inverted = true;
+
+    panel->console = HAL_SCI_USART2;
+    SciSetConfig(panel->console, &console_line, &console_pins);
+#elif POSIX
+    sigset_t signals;
+
+    // Los hilos de la emulacion no deben atender las señales que utiliza el puerto de FreeRTOS
+    sigfillset(&signals);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    pins.digits[0] = HAL_GPIO1_3;
+    pins.digits[1] = HAL_GPIO1_2;
+    pins.digits[2] = HAL_GPIO1_1;
+    pins.digits[3] = HAL_GPIO1_0;
+
+    pins.segments[0] = HAL_GPIO2_0;
+    pins.segments[1] = HAL_GPIO2_1;
+    pins.segments[2] = HAL_GPIO2_2;
+    pins.segments[3] = HAL_GPIO2_3;
+    pins.segments[4] = HAL_GPIO2_4;
+    pins.segments[5] = HAL_GPIO2_5;
+    pins.segments[6] = HAL_GPIO2_6;
+    pins.segments[7] = HAL_GPIO2_7;
+
+    panel->keys[0] = HAL_GPIO0_0; // Tecla 1 del teclado de la PC
+    panel->keys[1] = HAL_GPIO0_1;
+    panel->keys[2] = HAL_GPIO0_2;
+    panel->keys[3] = HAL_GPIO0_3;
+    panel->keys[4] = HAL_GPIO0_4;
+    panel->keys[5] = HAL_GPIO0_5; // Tecla 6 del teclado de la PC
+    pins.keys_inverted = true; // La emulacion deja las entradas en alto y el guion las pone en bajo al presionarlas
+
+    panel->alarm_led = HAL_GPIO3_0;
+    pins.led_inverted = false;
+
+    panel->console = NULL;
+#else
+#error "This program does not have support for the selected board"
+#endif
+}
+
+static void DigitsTurnOff(void) {
+    for (int index = 0; index < PANEL_DIGITS; index++) {
+        GpioSetState(pins.digits[index], false);
+    }
+    for (int index = 0; index < PANEL_SEGMENTS; index++) {
+        GpioSetState(pins.segments[index], false);
+    }
+}
+
+static void SegmentsUpdate(uint8_t value) {
+    for (int index = 0; index < PANEL_SEGMENTS; index++) {
+        GpioSetState(pins.segments[index], value & (1 << index));
+    }
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    if (digit < PANEL_DIGITS) {
+        GpioSetState(pins.digits[digit], true);
+    }
+}
+
+#ifdef POSIX
+static void TraceWriteFile(void * object, const void * data, uint32_t size) {
+    fwrite(data, 1, size, (FILE *)object);
+}
+#endif
+
+/* === Public function implementation ============================================================================== */
+
+#ifdef POSIX
+void vApplicationTickHook(void) {
+    static uint64_t time = 0;
+
+    // El guion de entradas avanza en sincronismo con el tick del sistema operativo
+    time += 1000000 / configTICK_RATE_HZ;
+    GpioScriptAdvanceTo(time);
+}
+#endif
+
+panel_t PanelCreate(void) {
+    static struct panel_s panel = {0};
+
+    BoardSetup();
+    AssignResources(&panel);
+
+#ifdef POSIX
+    // Los nombres se registran antes de configurar el primer terminal, que es cuando se carga el guion de entradas
+    for (int index = 0; index < PANEL_KEYS; index++) {
+        GpioScriptSetAlias(key_names[index], panel.keys[index]);
+    }
+#endif
+
+    for (int index = 0; index < PANEL_DIGITS; index++) {
+        GpioSetDirection(pins.digits[index], true);
+    }
+    for (int index = 0; index < PANEL_SEGMENTS; index++) {
+        GpioSetDirection(pins.segments[index], true);
+    }
+    DigitsTurnOff();
+
+    for (int index = 0; index < PANEL_KEYS; index++) {
+        GpioSetDirection(panel.keys[index], false);
+    }
+
+    GpioSetDirection(panel.alarm_led, true);
+    PanelSetAlarmLed(&panel, false);
+
+    panel.screen = ScreenCreate(PANEL_DIGITS, PANEL_DIGITS, &screen_driver);
+    return (panel.screen != NULL) ? &panel : NULL;
+}
+
+bool PanelKeyIsPressed(panel_t panel, uint8_t key) {
+    if ((panel == NULL) || (key >= PANEL_KEYS)) {
+        return false;
+    }
+    return GpioGetState(panel->keys[key]) != pins.keys_inverted;
+}
+
+void PanelSetAlarmLed(panel_t panel, bool active) {
+    if (panel != NULL) {
+        GpioSetState(panel->alarm_led, active != pins.led_inverted);
+    }
+}
+
+void PanelConsoleWrite(panel_t panel, const char * text) {
+    uint16_t pending = strlen(text);
+
+    if ((panel == NULL) || (panel->console == NULL)) {
+#ifdef POSIX
+        // La salida estandar la ocupa el dibujo de los terminales emulados
+        fputs(text, stderr);
+#endif
+        return;
+    }
+    while (pending > 0) {
+        uint16_t sent = SciSendData(panel->console, text, pending);
+        text += sent;
+        pending -= sent;
+    }
+}
+
+clock_source_t PanelClockSource(panel_t panel) {
+#ifdef POSIX
+    if ((panel != NULL) && (getenv("RTOS_LOCAL_TIME") != NULL)) {
+        return ClockSourcePosix();
+    }
+#endif
+    return NULL;
+}
+
+void PanelSaveTrace(panel_t panel) {
+#ifdef POSIX
+    const char * name = getenv("RTOS_TRACE_FILE");
+    FILE * file;
+
+    if (name == NULL) {
+        return;
+    }
+    file = fopen(name, "wb");
+    if (file != NULL) {
+        TraceSnapshot(TraceWriteFile, file);
+        fclose(file);
+    }
+#endif
+}
+
+/* === End of documentation ======================================================================================== */
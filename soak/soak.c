@@ -0,0 +1,539 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file soak.c
+ ** @brief Simulacion acelerada de larga duracion del reloj despertador completo en el host
+ **
+ ** Enlaza los modulos reales de la aplicacion (reloj, interfaz, pantalla, entradas digitales, cola de eventos,
+ ** registro de eventos y planificador) con una placa simulada y ejecuta las mismas tareas de app.c que main.c. Los
+ ** terminales de las teclas son los registros emulados del sustituto de lpc_open de las pruebas, por lo que las
+ ** pulsaciones pasan por la deteccion de flancos real. Un usuario aleatorio ajusta la hora, programa alarmas, las
+ ** habilita y deshabilita, y pospone o cancela las que suenan, mientras en cada tick se verifica que:
+ **  - la hora avanza de a un segundo cada SOAK_TICKS_PER_SECOND ticks, salvo cuando el usuario la ajusta;
+ **  - cada ocurrencia de la alarma o de la alarma pospuesta suena exactamente una vez, sin demoras en el modo de
+ **    reposo y sin sonar cuando no corresponde;
+ **  - la pantalla muestra la hora del reloj mientras la interfaz esta en reposo o con la alarma sonando.
+ **
+ ** La simulacion termina con error en la primera violacion e informa la semilla para poder reproducirla.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "app.h"
+#include "clock.h"
+#include "digital.h"
+#include "event_queue.h"
+#include "host_time.h"
+#include "poncho.h"
+#include "scheduler.h"
+#include "screen.h"
+#include "telemetry.h"
+#include "ui.h"
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Ticks simulados por segundo, en cada uno se multiplexa un digito y se ejecutan todas las tareas de la aplicacion
+#ifndef SOAK_TICKS_PER_SECOND
+#define SOAK_TICKS_PER_SECOND 4
+#endif
+
+#define SOAK_DEFAULT_DAYS    365 // Duracion de la simulacion si no se indica otra
+#define SOAK_DEFAULT_SEED    1   // Semilla del usuario aleatorio si no se indica otra
+#define SOAK_SECONDS_PER_DAY 86400
+#define SOAK_MINUTES_PER_DAY 1440
+#define SOAK_TICKS_PER_DAY   ((uint64_t)SOAK_SECONDS_PER_DAY * SOAK_TICKS_PER_SECOND)
+
+//! Ticks sin cambios que necesita la pantalla para mostrar la hora: interfaz, composicion y multiplexado
+#define SOAK_STABLE_TICKS 3
+
+//! Ticks en el modo de reposo que puede demorar en sonar una alarma, hasta el proximo evento de segundo
+#define SOAK_ALARM_LATENCY (SOAK_TICKS_PER_SECOND + 1)
+
+#define SOAK_ACTION_PERIOD  (4 * 3600 * SOAK_TICKS_PER_SECOND) // Ticks promedio entre dos acciones del usuario
+#define SOAK_RESPONSE_TICKS (120 * SOAK_TICKS_PER_SECOND)      // Demora maxima del usuario en atender la alarma
+#define SOAK_SCRIPT_SIZE    64                                 // Teclas que el usuario puede tener planificadas
+
+#define SOAK_KEYS    APP_KEYS                           // Teclas del poncho, en el orden de los eventos de la interfaz
+#define SOAK_NO_KEY  SOAK_KEYS                          // Ninguna tecla presionada o liberada
+#define TASKS_COUNT  (sizeof(tasks) / sizeof(tasks[0])) // Cantidad de tareas del planificador
+#define BLINK_PERIOD (2 * SOAK_TICKS_PER_SECOND)        // El punto de los segundos parpadea una vez por segundo
+
+/* === Private data type declarations ============================================================================== */
+
+//! Terminal de una tecla del poncho
+struct soak_key_s {
+    uint8_t gpio;
+    uint8_t bit;
+};
+
+/* === Private function declarations =============================================================================== */
+
+static void DigitsTurnOff(void);
+static void SegmentsUpdate(uint8_t segments);
+static void DigitTurnOn(uint8_t digit);
+static void UiFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
+static void UiAlarmIndicator(bool active);
+static uint32_t FakeCycles(void);
+
+//! Devuelve el tiempo simulado con el que se marcan los registros de eventos
+static uint32_t TelemetryClock(void);
+
+//! Descarta los registros de eventos, como si el puerto serie los transmitiera sin demoras
+static uint16_t TelemetryWrite(const void * data, uint16_t size);
+
+//! Termina la simulacion informando la violacion encontrada y el momento en que ocurrio
+static void Fail(const char * format, ...);
+
+//! Genera el siguiente numero pseudoaleatorio del usuario simulado
+static uint32_t Random(void);
+
+//! Convierte una hora del reloj en segundos desde la medianoche
+static uint32_t Seconds(const clock_time_t * time);
+
+//! Agrega una tecla al guion del usuario, si hay lugar
+static void Enqueue(uint8_t key);
+
+//! Agrega las pulsaciones de incremento o decremento necesarias para desplazar un valor
+static void EnqueueAdjust(int delta);
+
+//! Planifica el ajuste de la hora actual a un valor aleatorio
+static void PlanSetTime(void);
+
+//! Planifica una alarma unos minutos despues de la hora actual o en un horario aleatorio
+static void PlanSetAlarm(void);
+
+//! Decide la proxima accion del usuario segun el modo de la interfaz
+static void PlanUser(void);
+
+//! Presiona o libera las teclas segun el guion del usuario
+static void DriveKeys(void);
+
+//! Verifica el estado de la aplicacion despues de cada tick
+static void Check(void);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Terminales de las teclas, indexados por el evento que generan al liberarse
+static const struct soak_key_s KEYS[SOAK_KEYS] = {
+    [EVENT_KEY_SET_TIME] = {KEY_F1_GPIO, KEY_F1_BIT},
+    [EVENT_KEY_SET_ALARM] = {KEY_F2_GPIO, KEY_F2_BIT},
+    [EVENT_KEY_DECREMENT] = {KEY_F3_GPIO, KEY_F3_BIT},
+    [EVENT_KEY_INCREMENT] = {KEY_F4_GPIO, KEY_F4_BIT},
+    [EVENT_KEY_ACCEPT] = {KEY_ACCEPT_GPIO, KEY_ACCEPT_BIT},
+    [EVENT_KEY_CANCEL] = {KEY_CANCEL_GPIO, KEY_CANCEL_BIT},
+};
+
+//! Imagen de cada digito en la pantalla, independiente de la tabla del modulo de pantalla
+static const uint8_t IMAGES[10] = {
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F,
+    SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_D | SEGMENT_E | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_G,
+    SEGMENT_B | SEGMENT_C | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_E | SEGMENT_F | SEGMENT_G,
+    SEGMENT_A | SEGMENT_B | SEGMENT_C | SEGMENT_D | SEGMENT_F | SEGMENT_G,
+};
+
+static const struct screen_driver_s screen_driver = {
+    .DigitsTurnOff = DigitsTurnOff,
+    .SegmentsUpdate = SegmentsUpdate,
+    .DigitTurnOn = DigitTurnOn,
+};
+
+static const struct ui_driver_s ui_driver = {
+    .FlashDigits = UiFlashDigits,
+    .AlarmIndicator = UiAlarmIndicator,
+};
+
+// Aplicacion bajo prueba
+static struct app_s app = {.blink_period = BLINK_PERIOD};
+static scheduler_t scheduler;
+
+// Las mismas tareas de main.c en el mismo orden, todas en cada tick porque el tick simulado es mas largo
+static const struct scheduler_task_s tasks[] = {
+    {.name = "compose", .handler = AppDisplayComposeTask, .object = &app, .period = 1, .budget = UINT32_MAX},
+    {.name = "clock", .handler = AppClockTask, .object = &app, .period = 1, .budget = UINT32_MAX},
+    {.name = "keys", .handler = AppKeysScanTask, .object = &app, .period = 1, .budget = UINT32_MAX},
+    {.name = "ui", .handler = AppUiTask, .object = &app, .period = 1, .budget = UINT32_MAX},
+};
+
+// Placa simulada
+static uint8_t segments_latch;    // Segmentos escritos antes de encender un digito
+static uint8_t shown[UI_DIGITS];  // Segmentos que muestra cada digito de la pantalla
+static uint8_t refreshed;         // Ultimo digito encendido por el multiplexado
+static uint8_t indicator_changes; // Veces que se encendio el indicador de alarma en el tick actual
+
+// Usuario simulado
+static uint32_t seed;
+static uint32_t random_state;
+static uint8_t script[SOAK_SCRIPT_SIZE]; // Teclas planificadas, en orden
+static uint8_t script_head;
+static uint8_t script_count;
+static uint8_t pressed = SOAK_NO_KEY;  // Tecla presionada actualmente
+static uint8_t released = SOAK_NO_KEY; // Tecla liberada en el tick actual
+static uint64_t response;              // Tick en que el usuario atiende la alarma, cero si no la escucho
+
+// Modelo de referencia
+static uint64_t ticks;            // Ticks simulados desde el comienzo
+static bool synced;               // Se conoce el tick en que comenzo el segundo actual
+static uint64_t second_tick;      // Tick en que cambio el ultimo segundo
+static bool time_valid;           // El reloj tenia una hora valida en el tick anterior
+static uint32_t last_seconds;     // Hora del tick anterior, en segundos desde la medianoche
+static system_mode_t mode_before; // Modo de la interfaz antes del tick actual
+static bool enabled_before;       // Alarma habilitada antes del tick actual
+static uint32_t alarm_before;     // Hora de la alarma antes del tick actual, en segundos
+static bool snooze_active;        // Hay una alarma pospuesta pendiente
+static uint32_t snooze_target;    // Hora de la alarma pospuesta, en segundos
+static bool pending;              // Hay una ocurrencia de la alarma que todavia no sono
+static uint32_t pending_ticks;    // Ticks en el modo de reposo con una ocurrencia pendiente
+static uint32_t stable;           // Ticks consecutivos con el mismo modo y los mismos digitos de la hora
+static uint32_t last_display;     // Modo y minutos del tick anterior
+
+// Estadisticas
+static uint32_t presses;
+static uint32_t time_sets;
+static uint32_t occurrences;
+static uint32_t rings;
+static uint32_t snoozes;
+static uint32_t cancels;
+static uint32_t absorbed;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void DigitsTurnOff(void) {
+}
+
+static void SegmentsUpdate(uint8_t segments) {
+    segments_latch = segments;
+}
+
+static void DigitTurnOn(uint8_t digit) {
+    shown[digit] = segments_latch;
+    refreshed = digit;
+}
+
+static void UiFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    DisplayFlashDigits(app.screen, from, to, divisor);
+}
+
+static void UiAlarmIndicator(bool active) {
+    if (active) {
+        indicator_changes++;
+    }
+}
+
+static uint32_t FakeCycles(void) {
+    return 0;
+}
+
+static uint32_t TelemetryClock(void) {
+    return (uint32_t)(ticks * 1000 / SOAK_TICKS_PER_SECOND);
+}
+
+static uint16_t TelemetryWrite(const void * data, uint16_t size) {
+    (void)data;
+    return size;
+}
+
+static void Fail(const char * format, ...) {
+    va_list arguments;
+    uint32_t now = time_valid ? last_seconds : 0;
+
+    fprintf(stderr, "Dia %" PRIu64 " %02u:%02u:%02u, tick %" PRIu64 ", semilla %u: ", ticks / SOAK_TICKS_PER_DAY,
+            now / 3600, now / 60 % 60, now % 60, ticks, seed);
+    va_start(arguments, format);
+    vfprintf(stderr, format, arguments);
+    va_end(arguments);
+    fprintf(stderr, "\n");
+    exit(EXIT_FAILURE);
+}
+
+static uint32_t Random(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static uint32_t Seconds(const clock_time_t * time) {
+    return (time->bcd[5] * 10 + time->bcd[4]) * 3600 + (time->bcd[3] * 10 + time->bcd[2]) * 60 + time->bcd[1] * 10 +
+           time->bcd[0];
+}
+
+static void Enqueue(uint8_t key) {
+    if (script_count < SOAK_SCRIPT_SIZE) {
+        script[(script_head + script_count) % SOAK_SCRIPT_SIZE] = key;
+        script_count++;
+    }
+}
+
+static void EnqueueAdjust(int delta) {
+    for (; delta > 0; delta--) {
+        Enqueue(EVENT_KEY_INCREMENT);
+    }
+    for (; delta < 0; delta++) {
+        Enqueue(EVENT_KEY_DECREMENT);
+    }
+}
+
+static void PlanSetTime(void) {
+    Enqueue(EVENT_KEY_SET_TIME);
+    EnqueueAdjust((int)(Random() % 60) - 30);
+    Enqueue(EVENT_KEY_ACCEPT);
+    EnqueueAdjust((int)(Random() % 24) - 12);
+    // A veces el usuario se arrepiente y la hora no cambia
+    Enqueue((Random() % 8) ? EVENT_KEY_ACCEPT : EVENT_KEY_CANCEL);
+}
+
+static void PlanSetAlarm(void) {
+    clock_time_t alarm;
+    uint32_t target;
+
+    // La mitad de las alarmas se programan a pocos minutos para que suenen muchas veces durante la simulacion
+    if (Random() % 2) {
+        target = (last_seconds / 60 + 1 + Random() % 10) % SOAK_MINUTES_PER_DAY;
+    } else {
+        target = Random() % SOAK_MINUTES_PER_DAY;
+    }
+
+    // La interfaz comienza la edicion con la hora de la alarma actual y los minutos no acarrean a las horas
+    ClockGetAlarmTime(app.clock, &alarm);
+    uint32_t current = Seconds(&alarm) / 60;
+    int minutes = ((int)(target % 60) - (int)(current % 60) + 90) % 60 - 30;
+    int hours = ((int)(target / 60) - (int)(current / 60) + 36) % 24 - 12;
+
+    Enqueue(EVENT_KEY_SET_ALARM);
+    EnqueueAdjust(minutes);
+    Enqueue(EVENT_KEY_ACCEPT);
+    EnqueueAdjust(hours);
+    Enqueue((Random() % 8) ? EVENT_KEY_ACCEPT : EVENT_KEY_CANCEL);
+}
+
+static void PlanUser(void) {
+    system_mode_t mode = UiGetMode(app.ui);
+
+    if ((pressed != SOAK_NO_KEY) || (script_count > 0)) {
+        return;
+    }
+
+    if (mode == MODE_ALARM_TRIGGERED) {
+        if (response == 0) {
+            response = ticks + 1 + Random() % SOAK_RESPONSE_TICKS;
+        } else if (ticks >= response) {
+            response = 0;
+            Enqueue((Random() % 4) ? EVENT_KEY_ACCEPT : EVENT_KEY_CANCEL);
+        }
+        return;
+    }
+    response = 0;
+
+    if (mode == MODE_UNSET) {
+        PlanSetTime();
+    } else if (Random() % SOAK_ACTION_PERIOD == 0) {
+        switch (Random() % 8) {
+        case 0:
+            PlanSetTime();
+            break;
+        case 1:
+            Enqueue(EVENT_KEY_ACCEPT); // Habilita la alarma
+            break;
+        case 2:
+            Enqueue(EVENT_KEY_CANCEL); // Deshabilita la alarma
+            break;
+        case 3:
+            for (uint32_t count = 1 + Random() % 4; count > 0; count--) {
+                Enqueue(Random() % SOAK_KEYS);
+            }
+            break;
+        default:
+            PlanSetAlarm();
+            break;
+        }
+    }
+}
+
+static void DriveKeys(void) {
+    released = SOAK_NO_KEY;
+    if (pressed != SOAK_NO_KEY) {
+        // Las teclas son activas en bajo, se liberan poniendo el terminal en alto
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, KEYS[pressed].gpio, KEYS[pressed].bit, true);
+        released = pressed;
+        pressed = SOAK_NO_KEY;
+    } else if (script_count > 0) {
+        pressed = script[script_head];
+        script_head = (script_head + 1) % SOAK_SCRIPT_SIZE;
+        script_count--;
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, KEYS[pressed].gpio, KEYS[pressed].bit, false);
+        presses++;
+    }
+}
+
+static void Check(void) {
+    clock_time_t now;
+    system_mode_t mode = UiGetMode(app.ui);
+    bool valid = ClockGetTime(app.clock, &now);
+    uint32_t seconds = Seconds(&now);
+
+    if (time_valid && !valid) {
+        Fail("el reloj perdio la hora");
+    }
+
+    if ((mode_before == MODE_SET_TIME_HOURS) && (mode == MODE_HOME)) {
+        // El ajuste no reinicia la fraccion de segundo del reloj, por lo que el primer segundo puede ser mas corto
+        time_sets++;
+        synced = false;
+    } else if (time_valid && (seconds != last_seconds)) {
+        if (seconds != (last_seconds + 1) % SOAK_SECONDS_PER_DAY) {
+            Fail("la hora salto a %02u:%02u:%02u", seconds / 3600, seconds / 60 % 60, seconds % 60);
+        }
+        if (synced && (ticks - second_tick != SOAK_TICKS_PER_SECOND)) {
+            Fail("el segundo duro %" PRIu64 " ticks", ticks - second_tick);
+        }
+        synced = true;
+        second_tick = ticks;
+
+        uint32_t target = snooze_active ? snooze_target : alarm_before;
+        if (enabled_before && (seconds == target)) {
+            occurrences++;
+            snooze_active = false;
+            if ((mode_before == MODE_ALARM_TRIGGERED) || pending) {
+                // La alarma ya estaba sonando, la nueva ocurrencia no puede distinguirse de la anterior
+                absorbed++;
+            } else {
+                pending = true;
+                pending_ticks = 0;
+            }
+        }
+    }
+    time_valid = valid;
+    last_seconds = seconds;
+
+    bool rang = (indicator_changes > 0);
+    for (; indicator_changes > 0; indicator_changes--) {
+        if (!pending) {
+            Fail("la alarma sono sin que la hora coincida");
+        }
+        pending = false;
+        rings++;
+    }
+    if (pending && (mode == MODE_HOME) && (++pending_ticks > SOAK_ALARM_LATENCY)) {
+        Fail("la alarma no sono");
+    }
+
+    // La tecla liberada en el mismo tick en que comienza a sonar la alarma se procesa despues del evento de segundo
+    if (((mode_before == MODE_ALARM_TRIGGERED) || rang) && (mode == MODE_HOME)) {
+        if (released == EVENT_KEY_ACCEPT) {
+            snoozes++;
+            snooze_active = true;
+            snooze_target = ((seconds / 60 + UI_SNOOZE_MINUTES) % SOAK_MINUTES_PER_DAY) * 60;
+        } else {
+            cancels++;
+            snooze_active = false;
+        }
+    }
+
+    uint32_t display = (mode << 16) | (seconds / 60);
+    stable = (display == last_display) ? stable + 1 : 1;
+    last_display = display;
+    if ((stable >= SOAK_STABLE_TICKS) && ((mode == MODE_HOME) || (mode == MODE_ALARM_TRIGGERED))) {
+        const uint8_t digits[UI_DIGITS] = {now.bcd[5], now.bcd[4], now.bcd[3], now.bcd[2]};
+        if ((shown[refreshed] & ~SEGMENT_P) != IMAGES[digits[refreshed]]) {
+            Fail("el digito %u muestra 0x%02x en lugar de %u", refreshed, shown[refreshed], digits[refreshed]);
+        }
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    uint32_t days = SOAK_DEFAULT_DAYS;
+
+    seed = SOAK_DEFAULT_SEED;
+    if ((argc > 3) || ((argc > 1) && (sscanf(argv[1], "%u", &days) != 1)) ||
+        ((argc > 2) && (sscanf(argv[2], "%u", &seed) != 1)) || (seed == 0)) {
+        fprintf(stderr, "Uso: %s [dias [semilla]], la semilla no puede ser cero\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    random_state = seed;
+
+    // Las teclas se liberan antes de crear las entradas para que la primera lectura no detecte un flanco
+    FakeChipReset();
+    for (uint8_t key = 0; key < SOAK_KEYS; key++) {
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, KEYS[key].gpio, KEYS[key].bit, true);
+        app.keys[key] = DigitalInputCreate(KEYS[key].gpio, KEYS[key].bit, true);
+    }
+    app.screen = ScreenCreate(UI_DIGITS, UI_DIGITS, &screen_driver);
+    app.clock = ClockCreate(SOAK_TICKS_PER_SECOND);
+    app.events = EventQueueCreate();
+    app.ui = UiCreate(app.clock, &ui_driver);
+    app.telemetry = TelemetryCreate(TelemetryClock);
+    scheduler = SchedulerCreate(tasks, TASKS_COUNT, FakeCycles);
+
+    uint64_t total = (uint64_t)days * SOAK_TICKS_PER_DAY;
+    uint64_t start = HostTimeNow();
+    for (ticks = 0; ticks < total; ticks++) {
+        clock_time_t alarm;
+
+        mode_before = UiGetMode(app.ui);
+        enabled_before = ClockIsAlarmEnabled(app.clock);
+        ClockGetAlarmTime(app.clock, &alarm);
+        alarm_before = Seconds(&alarm);
+
+        PlanUser();
+        DriveKeys();
+
+        // Lo que main.c hace en la interrupcion del temporizador y en el lazo principal
+        ScreenRefresh(app.screen);
+        SchedulerTick(scheduler);
+        SchedulerDispatch(scheduler);
+        TelemetryDrain(app.telemetry, TelemetryWrite);
+
+        Check();
+    }
+    double elapsed = (HostTimeNow() - start) / 1e9;
+
+    if (EventQueueGetLost(app.events) != 0) {
+        Fail("se perdieron %u eventos", EventQueueGetLost(app.events));
+    }
+    if (TelemetryGetLost(app.telemetry) != 0) {
+        Fail("se perdieron %" PRIu32 " registros de eventos", TelemetryGetLost(app.telemetry));
+    }
+    if (SchedulerGetMissedTicks(scheduler) != 0) {
+        Fail("el planificador perdio %u ticks", SchedulerGetMissedTicks(scheduler));
+    }
+
+    printf("Simulados %u dias, %" PRIu64 " ticks en %.1f s: %.1f millones de ticks por segundo\n", days, total,
+           elapsed, elapsed > 0 ? total / elapsed / 1e6 : 0.0);
+    printf("Teclas %u, ajustes de hora %u, ocurrencias de alarma %u, sonaron %u, absorbidas %u, pospuestas %u, "
+           "canceladas %u\n",
+           presses, time_sets, occurrences, rings, absorbed, snoozes, cancels);
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ======================================================================================== */
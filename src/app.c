@@ -0,0 +1,139 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file app.c
+ ** @brief Tareas del reloj despertador que no dependen de la placa
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "app.h"
+#include "profile.h"
+#include <stddef.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Registra el cambio de modo de la interfaz y, si corresponde, el disparo, la postergacion o la cancelacion
+ * de la alarma.
+ * @param self Puntero a la estructura con los objetos de la aplicacion.
+ * @param previous Modo de la interfaz antes de procesar el evento.
+ * @param event Evento que provoco el cambio de modo.
+ */
+static void LogModeChange(app_t self, system_mode_t previous, event_t event);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+static void LogModeChange(app_t self, system_mode_t previous, event_t event) {
+    system_mode_t mode = UiGetMode(self->ui);
+
+    TelemetryLog(self->telemetry, TELEMETRY_MODE, mode);
+    if (mode == MODE_ALARM_TRIGGERED) {
+        uint32_t hours = self->current_time.time.hours[1] * 10 + self->current_time.time.hours[0];
+        uint32_t minutes = self->current_time.time.minutes[1] * 10 + self->current_time.time.minutes[0];
+        TelemetryLog(self->telemetry, TELEMETRY_ALARM, hours * 60 + minutes);
+    } else if ((previous == MODE_ALARM_TRIGGERED) && (event == EVENT_KEY_ACCEPT)) {
+        TelemetryLog(self->telemetry, TELEMETRY_SNOOZE, UI_SNOOZE_MINUTES);
+    } else if ((previous == MODE_ALARM_TRIGGERED) && (event == EVENT_KEY_CANCEL)) {
+        TelemetryLog(self->telemetry, TELEMETRY_CANCEL, 0);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+void AppDisplayComposeTask(void * object) {
+    app_t self = object;
+    uint8_t digits[UI_DIGITS];
+    uint8_t dots[UI_DIGITS];
+
+    memcpy(digits, UiGetDigits(self->ui), sizeof(digits));
+    memcpy(dots, UiGetDots(self->ui), sizeof(dots));
+
+    self->blink_count = (self->blink_count + 1) % self->blink_period;
+    if (self->blink_count < self->blink_period / 2) {
+        dots[1] = !dots[1];
+    }
+
+    if (self->DisableRefresh != NULL) {
+        self->DisableRefresh();
+    }
+    ScreenWriteBCD(self->screen, digits, UI_DIGITS);
+    ScreenWriteDOT(self->screen, dots, UI_DIGITS);
+    if (self->EnableRefresh != NULL) {
+        self->EnableRefresh();
+    }
+}
+
+void AppClockTask(void * object) {
+    app_t self = object;
+    uint8_t last_second = self->current_time.bcd[0];
+
+    PROFILE_BEGIN(APP_REGION_CLOCK);
+    ClockNewTick(self->clock); // la validacion ya es interna al reloj, no hace falta validar aca
+    PROFILE_END(APP_REGION_CLOCK);
+    ClockGetTime(self->clock, &self->current_time);
+    if (self->current_time.bcd[0] != last_second) {
+        EventQueuePost(self->events, EVENT_CLOCK_SECOND);
+    }
+}
+
+void AppKeysScanTask(void * object) {
+    app_t self = object;
+
+    // Las teclas estan en el orden de los eventos, por lo que el indice de cada una es el evento que genera
+    for (uint8_t key = 0; key < APP_KEYS; key++) {
+        if (DigitalInputWasDeactivated(self->keys[key])) {
+            EventQueuePost(self->events, key);
+        }
+    }
+}
+
+void AppUiTask(void * object) {
+    app_t self = object;
+    event_t event;
+
+    while (EventQueueGet(self->events, &event)) {
+        system_mode_t previous = UiGetMode(self->ui);
+
+        if (event == EVENT_CLOCK_SECOND) {
+            if (self->SecondElapsed != NULL) {
+                self->SecondElapsed();
+            }
+        } else {
+            TelemetryLog(self->telemetry, TELEMETRY_KEY, event);
+        }
+        UiProcessEvent(self->ui, event);
+        if (UiGetMode(self->ui) != previous) {
+            LogModeChange(self, previous, event);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
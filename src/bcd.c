@@ -0,0 +1,124 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file bcd.c
+ ** @brief Aritmetica de campos BCD empaquetados para la hora y la alarma
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "bcd.h"
+
+/* === Private macros definitions ================================================================================== */
+
+// Con este factor y un desplazamiento de 11 bits se obtiene la division por diez exacta para valores menores a 1029
+#define TENTH_FACTOR 205
+#define TENTH_SHIFT  11
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lleva un valor al rango del campo restando el limite tantas veces como haga falta.
+ * @param value Puntero al valor a reducir, al terminar es menor que el limite.
+ * @param limit Cantidad de valores del campo.
+ * @return Cantidad de veces que se resto el limite.
+ */
+static uint16_t Reduce(uint32_t * value, uint8_t limit);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+static uint16_t Reduce(uint32_t * value, uint8_t limit) {
+    uint16_t wraps = 0;
+
+    // Los pasos de uno en uno de los botones se resuelven con una sola comparacion, los pasos grandes restan el limite
+    // desplazado de mayor a menor como en una division binaria, con una cantidad fija de iteraciones
+    if (*value < limit) {
+        return 0;
+    }
+    if (*value < 2 * (uint32_t)limit) {
+        *value -= limit;
+        return 1;
+    }
+    for (int8_t shift = 15; shift >= 0; shift--) {
+        uint32_t multiple = (uint32_t)limit << shift;
+
+        if (*value >= multiple) {
+            *value -= multiple;
+            wraps += (uint16_t)(1U << shift);
+        }
+    }
+    return wraps;
+}
+
+/* === Public function implementation ============================================================================== */
+
+uint8_t BcdToBinary(uint8_t field) {
+    uint8_t tens = BCD_TENS(field);
+
+    return (uint8_t)((tens << 3) + (tens << 1) + BCD_UNITS(field));
+}
+
+uint8_t BcdFromBinary(uint8_t value) {
+    uint8_t tens = (uint8_t)((value * TENTH_FACTOR) >> TENTH_SHIFT);
+
+    return BCD_PACK(tens, value - (tens << 3) - (tens << 1));
+}
+
+uint16_t BcdAddWrap(uint8_t * field, uint16_t step, uint8_t limit) {
+    uint32_t value = (uint32_t)BcdToBinary(*field) + step;
+    uint16_t wraps = Reduce(&value, limit);
+
+    *field = BcdFromBinary((uint8_t)value);
+    return wraps;
+}
+
+uint16_t BcdSubtractWrap(uint8_t * field, uint16_t step, uint8_t limit) {
+    uint32_t amount = step;
+    uint16_t wraps = Reduce(&amount, limit);
+    uint8_t value = BcdToBinary(*field);
+
+    if (value < amount) {
+        value += limit;
+        wraps++;
+    }
+    *field = BcdFromBinary((uint8_t)(value - amount));
+    return wraps;
+}
+
+void BcdAddSaturate(uint8_t * field, uint16_t step, uint8_t limit) {
+    uint32_t value = (uint32_t)BcdToBinary(*field) + step;
+
+    *field = BcdFromBinary((value < limit) ? (uint8_t)value : (uint8_t)(limit - 1));
+}
+
+void BcdSubtractSaturate(uint8_t * field, uint16_t step) {
+    uint8_t value = BcdToBinary(*field);
+
+    *field = BcdFromBinary((value > step) ? (uint8_t)(value - step) : 0);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -31,6 +31,7 @@ SPDX-License-Identifier: MIT
 #include "chip.h"
 #include <stddef.h>
 #include "poncho.h"
+#include "hal.h"
 
 /* === Macros definitions ========================================================================================== */
 
@@ -48,6 +49,12 @@ static void SegmentsInit(void);
 static void DigitsInit(void);
 /* === Private variable definitions ================================================================================ */
 
+static uint32_t idle_cycles = 0;  // Ciclos suspendidos desde la ultima medicion
+static uint32_t window_start = 0; // Valor del contador de ciclos al comenzar la medicion
+
+static const struct hal_sci_line_s console_line = {
+    .baud_rate = 115200, .data_bits = 8, .parity = HAL_SCI_NO_PARITY};
+
 static const struct screen_driver_s display_driver = {
     .DigitsTurnOff = DigitsTurnOff, .SegmentsUpdate = SegmentsUpdate, .DigitTurnOn = DigitTurnOn};
 
@@ -165,18 +172,61 @@ Board_t BoardCreate(void) {
     Chip_SCU_PinMuxSet(KEY_CANCEL_PORT, KEY_CANCEL_PIN, SCU_MODE_INBUFF_EN | SCU_MODE_INACT | KEY_CANCEL_FUNC);
     self->cancel = DigitalInputCreate(KEY_CANCEL_GPIO, KEY_CANCEL_BIT, true);
 
+    // Puerto serie del conector USB, por donde se transmite el registro de eventos
+    struct hal_sci_pins_s console_pins = {.txd_pin = HAL_PIN_P7_1, .rxd_pin = HAL_PIN_P7_2};
+    self->console = HAL_SCI_USART2;
+    SciSetConfig(self->console, &console_line, &console_pins);
+
+    // Puerto serie de los comandos, separado del registro de eventos para que sus tramas no se mezclen
+    struct hal_sci_pins_s commands_pins = {.txd_pin = HAL_PIN_P2_3, .rxd_pin = HAL_PIN_P2_4};
+    self->commands = HAL_SCI_USART3;
+    SciSetConfig(self->commands, &console_line, &commands_pins);
+
+    // Contador de ciclos del nucleo utilizado para medir el tiempo inactivo y la duracion de las tareas
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
     return self;
 }
 
-void SysTickInit(uint16_t ticks) {
-    __asm volatile("cpsid i"); // Deshabilita las interrupciones
+void BoardSleep(void) {
+    uint32_t start = DWT->CYCCNT;
+
+    __WFI();
+    idle_cycles += DWT->CYCCNT - start;
+}
 
-    SystemCoreClockUpdate();                 // Actualiza la frecuencia del núcleo del sistema
-    SysTick_Config(SystemCoreClock / ticks); // Configura SysTick para interrupciones cada 1 ms
+uint8_t BoardGetIdlePercent(void) {
+    uint32_t now = DWT->CYCCNT;
+    uint32_t elapsed = now - window_start;
+    uint8_t result = 0;
 
-    NVIC_SetPriority(SysTick_IRQn, (1 << __NVIC_PRIO_BITS) - 1); // Establece la prioridad más baja para SysTick
+    if (elapsed >= 100) {
+        result = idle_cycles / (elapsed / 100);
+    }
+    idle_cycles = 0;
+    window_start = now;
+    return (result > 100) ? 100 : result;
+}
+
+uint32_t BoardGetCycles(void) {
+    return DWT->CYCCNT;
+}
+
+#ifdef SCREEN_STATIC_CONFIG
+// Con la configuracion fija la pantalla llama a estas funciones en lugar de usar display_driver
+void ScreenDigitsTurnOff(void) {
+    DigitsTurnOff();
+}
+
+void ScreenSegmentsUpdate(uint8_t segments) {
+    SegmentsUpdate(segments);
+}
 
-    __asm volatile("cpsie i"); // Habilita las interrupciones
+void ScreenDigitTurnOn(uint8_t digit) {
+    DigitTurnOn(digit);
 }
+#endif
 
 /* === End of documentation ======================================================================================== */
@@ -23,6 +23,7 @@ SPDX-License-Identifier: MIT
 
 /* === Headers files inclusions ==================================================================================== */
 #include "clock.h"
+#include "bcd.h"
 #include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
@@ -30,14 +31,63 @@ SPDX-License-Identifier: MIT
 /* === Header for C++ compatibility ================================================================================ */
 
 /* === Private macros definitions ================================================================================ */
+
+// Con la frecuencia fija al compilar el contador de ticks se compara con una constante
+#ifdef CLOCK_STATIC_TPS
+#if CLOCK_STATIC_TPS < 1 || CLOCK_STATIC_TPS > UINT16_MAX
+#error "CLOCK_STATIC_TPS debe estar entre 1 y 65535"
+#endif
+#define TICKS_PER_SECOND(self) CLOCK_STATIC_TPS
+#else
+#define TICKS_PER_SECOND(self) ((self)->ticks_per_second)
+#endif
 /* === Private data type declarations ========================================================== */
 
+struct clock_s {
+    uint32_t clock_ticks; // Ticks desde el ultimo segundo, con una fuente detenida llega al doble de la frecuencia
+    clock_time_t current_time;
+    bool valid;
+#ifndef CLOCK_STATIC_TPS
+    uint16_t ticks_per_second;
+#endif
+    clock_source_t source;   // Fuente externa de la hora, NULL si el reloj solo cuenta los ticks
+    uint32_t source_seconds; // Ultima hora leida de la fuente, en segundos desde la medianoche
+    uint32_t source_faults;  // Segundos que avanzo con los ticks porque la fuente fallo o se detuvo
+
+    // De aca en adelante es parte de la alarma
+    clock_time_t alarm_time;
+    bool alarm_enabled;
+    bool alarm_triggered;      // Indica si la alarma esta sonando o no
+    clock_time_t snoozed_time; // Guarda la hora de la alarma pospuesta
+    bool snoozed_active;       // Indica si la alarma pospuesta esta activa
+};
+
 /* === Private variable declarations =========================================================== */
 
 /* === Private function declarations =========================================================== */
 
 static bool IsValidTime(const clock_time_t * time);
 
+/**
+ * @brief Avanza la hora actual un segundo, propagando los acarreos de los digitos BCD.
+ * @param self Puntero al reloj.
+ */
+static void IncrementSecond(clock_t self);
+
+/**
+ * @brief Actualiza la hora actual con la fuente externa cuando esta cambia de segundo.
+ * @param self Puntero al reloj.
+ * @return Segundos que avanzo la hora, 0 si no comenzo un nuevo segundo. Un retroceso de la hora cuenta como uno.
+ */
+static uint32_t FollowSource(clock_t self);
+
+/**
+ * @brief Dispara la alarma normal o pospuesta si su hora esta entre los ultimos segundos transcurridos.
+ * @param self Puntero al reloj.
+ * @param elapsed Segundos que avanzo la hora, la alarma se verifica en cada uno de ellos.
+ */
+static void CheckAlarm(clock_t self, uint32_t elapsed);
+
 /* === Public macros definitions =================================================================================== */
 
 /* === Public data type declarations =============================================================================== */
@@ -72,26 +122,157 @@ static bool IsValidTime(const clock_time_t * time) {
     return true;
 }
 
-/* === Public function implementation ========================================================= */
-struct clock_s {
-    uint16_t clock_ticks;
-    clock_time_t current_time;
-    bool valid;
-    uint16_t ticks_per_second;
+static uint32_t TimeToSeconds(const clock_time_t * time) {
+    uint32_t hours = time->time.hours[1] * 10 + time->time.hours[0];
+    uint32_t minutes = time->time.minutes[1] * 10 + time->time.minutes[0];
 
-    // De aca en adelante es parte de la alarma
-    clock_time_t alarm_time;
-    bool alarm_enabled;
-    bool alarm_triggered;      // Indica si la alarma esta sonando o no
-    clock_time_t snoozed_time; // Guarda la hora de la alarma pospuesta
-    bool snoozed_active;       // Indica si la alarma pospuesta esta activa
-};
+    return hours * 3600 + minutes * 60 + time->time.seconds[1] * 10 + time->time.seconds[0];
+}
+
+static void SecondsToTime(uint32_t seconds, clock_time_t * time) {
+    uint8_t hours = seconds / 3600;
+    uint8_t minutes = seconds / 60 % 60;
+
+    time->time.hours[1] = hours / 10;
+    time->time.hours[0] = hours % 10;
+    time->time.minutes[1] = minutes / 10;
+    time->time.minutes[0] = minutes % 10;
+    time->time.seconds[1] = seconds % 60 / 10;
+    time->time.seconds[0] = seconds % 10;
+}
+
+//! Segundos que hay que avanzar desde una hora hasta otra, pasando la medianoche si hace falta
+static uint32_t SecondsBetween(uint32_t from, uint32_t to) {
+    return (to + CLOCK_SOURCE_SECONDS_PER_DAY - from) % CLOCK_SOURCE_SECONDS_PER_DAY;
+}
+
+static void IncrementSecond(clock_t self) {
+    self->current_time.time.seconds[0]++;
+
+    // Rollover segundos (unidades)
+    if (self->current_time.time.seconds[0] > 9) {
+        self->current_time.time.seconds[0] = 0;
+        self->current_time.time.seconds[1]++;
+
+        // Rollover segundos (decenas)
+        if (self->current_time.time.seconds[1] > 5) {
+            self->current_time.time.seconds[1] = 0;
+            self->current_time.time.minutes[0]++;
+
+            // Rollover minutos (unidades)
+            if (self->current_time.time.minutes[0] > 9) {
+                self->current_time.time.minutes[0] = 0;
+                self->current_time.time.minutes[1]++;
+
+                // Rollover minutos (decenas)
+                if (self->current_time.time.minutes[1] > 5) {
+                    self->current_time.time.minutes[1] = 0;
+                    self->current_time.time.hours[0]++;
+
+                    // Rollover horas (unidades)
+                    if (self->current_time.time.hours[0] > 9) {
+                        self->current_time.time.hours[0] = 0;
+                        self->current_time.time.hours[1]++;
+                    }
+                    // Rollover horas completo (23:59:59 -> 00:00:00)
+                    if (self->current_time.time.hours[1] > 2 ||
+                        (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] > 3)) {
+                        // Volver a 00:00:00 si pasa de 23:59:59
+                        // memset(&self->current_time, 0, sizeof(clock_time_t)); ->NO USO PORQUE ME PUEDE ROMPER
+                        // LA ALARMA
+                        self->current_time.time.seconds[0] = 0;
+                        self->current_time.time.seconds[1] = 0;
+                        self->current_time.time.minutes[0] = 0;
+                        self->current_time.time.minutes[1] = 0;
+                        self->current_time.time.hours[0] = 0;
+                        self->current_time.time.hours[1] = 0;
+                    }
+                }
+            }
+        }
+    }
+}
+
+static uint32_t FollowSource(clock_t self) {
+    uint32_t seconds;
+    uint32_t elapsed;
+
+    // Los ticks solo indican cuando consultar la fuente: desde un tick antes del cambio de segundo esperado se la lee
+    // en cada tick hasta que cambia, y ese cambio fija la fase de los ticks siguientes
+    if (self->clock_ticks + 1 < TICKS_PER_SECOND(self)) {
+        return 0;
+    }
+    if (!self->source->Read(&seconds) || (seconds >= CLOCK_SOURCE_SECONDS_PER_DAY)) {
+        // Si la fuente deja de responder el reloj sigue contando los ticks
+        if (self->clock_ticks < TICKS_PER_SECOND(self)) {
+            return 0;
+        }
+        self->clock_ticks = 0;
+        self->source_faults++;
+        IncrementSecond(self);
+        self->source_seconds = TimeToSeconds(&self->current_time);
+        return 1;
+    }
+    if (seconds == self->source_seconds) {
+        // Una fuente que responde pero no cambia en mas de dos segundos se detuvo, el reloj avanza un segundo con los
+        // ticks y conserva la ultima lectura para volver a seguirla cuando cambie
+        if (self->clock_ticks <= 2 * (uint32_t)TICKS_PER_SECOND(self)) {
+            return 0;
+        }
+        self->clock_ticks -= TICKS_PER_SECOND(self);
+        self->source_faults++;
+        IncrementSecond(self);
+        return 1;
+    }
+
+    // Los saltos hacia adelante de menos de medio dia cuentan como tiempo transcurrido, los demas son ajustes hacia
+    // atras de la hora de la fuente
+    elapsed = SecondsBetween(TimeToSeconds(&self->current_time), seconds);
+    if (elapsed > CLOCK_SOURCE_SECONDS_PER_DAY / 2) {
+        elapsed = 1;
+    }
+
+    self->clock_ticks = 0;
+    self->source_seconds = seconds;
+    SecondsToTime(seconds, &self->current_time);
+    return elapsed;
+}
+
+static void CheckAlarm(clock_t self, uint32_t elapsed) {
+    if (self->alarm_enabled) {
+        clock_time_t * target = self->snoozed_active ? &self->snoozed_time : &self->alarm_time;
+        bool reached = ClockTimesMatch(&self->current_time, target);
+
+        // Si la hora salto varios segundos la alarma suena tambien cuando su hora quedo entre los segundos salteados
+        if (!reached && (elapsed > 1)) {
+            reached = SecondsBetween(TimeToSeconds(target), TimeToSeconds(&self->current_time)) < elapsed;
+        }
+        if (reached) {
+            self->alarm_triggered = true;
+            self->snoozed_active = false; // Se desactiva una vez que se disparó
+        }
+    }
+}
+
+/* === Public function implementation ========================================================= */
 
 clock_t ClockCreate(uint16_t ticks_per_second) {
+    return ClockCreateWithSource(ticks_per_second, NULL);
+}
+
+clock_t ClockCreateWithSource(uint16_t ticks_per_second, clock_source_t source) {
 
     if (ticks_per_second < 1) {
         return NULL; // No se puede crear un reloj con menos de 1 tick por segundo
     }
+#ifdef CLOCK_STATIC_TPS
+    if (ticks_per_second != CLOCK_STATIC_TPS) {
+        return NULL;
+    }
+#endif
+    if (source && (!source->Read || !source->Write)) {
+        return NULL;
+    }
 
     clock_t self = malloc(sizeof(struct clock_s));
     if (self == NULL) {
@@ -99,8 +280,17 @@ clock_t ClockCreate(uint16_t ticks_per_second) {
     }
     memset(self, 0, sizeof(struct clock_s)); // Inicializar a cero
 
+#ifndef CLOCK_STATIC_TPS
     self->ticks_per_second = ticks_per_second;
+#endif
     self->valid = false;
+    self->source = source;
+
+    // Si la fuente conservo la hora el reloj comienza con una hora valida
+    if (source && source->Read(&self->source_seconds) && (self->source_seconds < CLOCK_SOURCE_SECONDS_PER_DAY)) {
+        SecondsToTime(self->source_seconds, &self->current_time);
+        self->valid = true;
+    }
 
     // Alarma
     self->alarm_enabled = false;
@@ -126,71 +316,42 @@ bool ClockSetTime(clock_t self, const clock_time_t * new_time) {
     memcpy(&self->current_time, new_time, sizeof(*new_time));
     self->valid = true;
 
+    // La fuente reinicia su fraccion de segundo al ajustarla, los ticks se alinean con ella
+    if (self->source) {
+        self->source_seconds = TimeToSeconds(new_time);
+        self->source->Write(self->source_seconds);
+        self->clock_ticks = 0;
+    }
+
     return true;
 }
 
 void ClockNewTick(clock_t self) {
+    uint32_t elapsed = 1;
+
     if (!self || !self->valid)
         return;
     // Incrementar el contador de ticks del reloj
     self->clock_ticks++;
-    if (self->clock_ticks == self->ticks_per_second) {
-        self->clock_ticks = 0;
-        self->current_time.time.seconds[0]++;
-
-        // Rollover segundos (unidades)
-        if (self->current_time.time.seconds[0] > 9) {
-            self->current_time.time.seconds[0] = 0;
-            self->current_time.time.seconds[1]++;
-
-            // Rollover segundos (decenas)
-            if (self->current_time.time.seconds[1] > 5) {
-                self->current_time.time.seconds[1] = 0;
-                self->current_time.time.minutes[0]++;
-
-                // Rollover minutos (unidades)
-                if (self->current_time.time.minutes[0] > 9) {
-                    self->current_time.time.minutes[0] = 0;
-                    self->current_time.time.minutes[1]++;
-
-                    // Rollover minutos (decenas)
-                    if (self->current_time.time.minutes[1] > 5) {
-                        self->current_time.time.minutes[1] = 0;
-                        self->current_time.time.hours[0]++;
-
-                        // Rollover horas (unidades)
-                        if (self->current_time.time.hours[0] > 9) {
-                            self->current_time.time.hours[0] = 0;
-                            self->current_time.time.hours[1]++;
-                        }
-                        // Rollover horas completo (23:59:59 -> 00:00:00)
-                        if (self->current_time.time.hours[1] > 2 ||
-                            (self->current_time.time.hours[1] == 2 && self->current_time.time.hours[0] > 3)) {
-                            // Volver a 00:00:00 si pasa de 23:59:59
-                            // memset(&self->current_time, 0, sizeof(clock_time_t)); ->NO USO PORQUE ME PUEDE ROMPER
-                            // LA ALARMA
-                            self->current_time.time.seconds[0] = 0;
-                            self->current_time.time.seconds[1] = 0;
-                            self->current_time.time.minutes[0] = 0;
-                            self->current_time.time.minutes[1] = 0;
-                            self->current_time.time.hours[0] = 0;
-                            self->current_time.time.hours[1] = 0;
-                        }
-                    }
-                }
-            }
+    if (self->source != NULL) {
+        elapsed = FollowSource(self);
+        if (elapsed == 0) {
+            return;
         }
+    } else if (self->clock_ticks == TICKS_PER_SECOND(self)) {
+        self->clock_ticks = 0;
+        IncrementSecond(self);
+    } else {
+        return;
     }
 
-    // Verificar si la alarma (normal o pospuesta) debe sonar
-    if (self->alarm_enabled) {
-        clock_time_t * target = self->snoozed_active ? &self->snoozed_time : &self->alarm_time;
+    // La alarma (normal o pospuesta) se verifica solo al cambiar el segundo, asi suena una unica vez aunque se
+    // cancele o se programe durante el mismo segundo en que la hora coincide
+    CheckAlarm(self, elapsed);
+}
 
-        if (ClockTimesMatch(&self->current_time, target)) {
-            self->alarm_triggered = true;
-            self->snoozed_active = false; // Se desactiva una vez que se disparó
-        }
-    }
+uint32_t ClockGetSourceFaults(clock_t self) {
+    return self ? self->source_faults : 0;
 }
 
 // Guarda una copia de la hora de la alarma (alarm_time) en el reloj.
@@ -248,27 +409,16 @@ bool ClockSnoozeAlarm(clock_t self, uint8_t minutes_to_snooze) {
         return false;
     }
 
-    // Tomamos la hora actual como punto de partida
-    uint8_t min_units = self->current_time.time.minutes[0];
-    uint8_t min_tens = self->current_time.time.minutes[1];
-    uint8_t hr_units = self->current_time.time.hours[0];
-    uint8_t hr_tens = self->current_time.time.hours[1];
+    // Tomamos la hora actual como punto de partida, las vueltas de los minutos se acarrean a las horas
+    uint8_t minutes = BCD_PACK(self->current_time.time.minutes[1], self->current_time.time.minutes[0]);
+    uint8_t hours = BCD_PACK(self->current_time.time.hours[1], self->current_time.time.hours[0]);
 
-    uint8_t current_minutes = min_tens * 10 + min_units;
-    uint8_t current_hours = hr_tens * 10 + hr_units;
-
-    uint16_t total_minutes = current_minutes + minutes_to_snooze;
-    uint16_t new_hours = current_hours + (total_minutes / 60);
-    uint16_t new_minutes = total_minutes % 60;
-
-    if (new_hours >= 24) {
-        new_hours %= 24;
-    }
+    BcdAddWrap(&hours, BcdAddWrap(&minutes, minutes_to_snooze, BCD_MINUTES), BCD_HOURS);
 
-    self->snoozed_time.time.hours[1] = new_hours / 10;
-    self->snoozed_time.time.hours[0] = new_hours % 10;
-    self->snoozed_time.time.minutes[1] = new_minutes / 10;
-    self->snoozed_time.time.minutes[0] = new_minutes % 10;
+    self->snoozed_time.time.hours[1] = BCD_TENS(hours);
+    self->snoozed_time.time.hours[0] = BCD_UNITS(hours);
+    self->snoozed_time.time.minutes[1] = BCD_TENS(minutes);
+    self->snoozed_time.time.minutes[0] = BCD_UNITS(minutes);
     self->snoozed_time.time.seconds[1] = 0;
     self->snoozed_time.time.seconds[0] = 0;
 
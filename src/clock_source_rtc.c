@@ -0,0 +1,105 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clock_source_rtc.c
+ ** @brief Fuente de la hora del dia sobre el reloj de tiempo real con bateria del LPC43xx
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "clock_source.h"
+#include "chip.h"
+#include <stddef.h>
+
+/* === Private macros definitions ================================================================================== */
+
+// El registro de proposito general se alimenta con la misma bateria que el reloj de tiempo real, la marca indica
+// que la hora del reloj fue ajustada y que no se perdio la alimentacion desde entonces
+#define RTC_MARK_REGISTER 0
+#define RTC_MARK          0x52544331
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Indica si el reloj de tiempo real esta funcionando con una hora ajustada.
+ * @return true si la hora del reloj de tiempo real es valida, false en caso contrario.
+ */
+static bool RtcIsSet(void);
+
+static bool RtcRead(uint32_t * seconds);
+
+static bool RtcWrite(uint32_t seconds);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct clock_source_s rtc_source = {
+    .Read = RtcRead,
+    .Write = RtcWrite,
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static bool RtcIsSet(void) {
+    return (LPC_RTC->CCR & RTC_CCR_CLKEN) && (Chip_REGFILE_Read(LPC_REGFILE, RTC_MARK_REGISTER) == RTC_MARK);
+}
+
+static bool RtcRead(uint32_t * seconds) {
+    if (!RtcIsSet()) {
+        return false;
+    }
+
+    // El registro consolidado tiene los segundos, minutos y horas capturados en el mismo instante
+    uint32_t time = LPC_RTC->CTIME[0];
+    uint32_t hours = (time & RTC_CTIME0_HOURS_MASK) >> 16;
+    uint32_t minutes = (time & RTC_CTIME0_MINUTES_MASK) >> 8;
+
+    *seconds = hours * 3600 + minutes * 60 + (time & RTC_CTIME0_SECONDS_MASK);
+    return true;
+}
+
+static bool RtcWrite(uint32_t seconds) {
+    if (seconds >= CLOCK_SOURCE_SECONDS_PER_DAY) {
+        return false;
+    }
+
+    Chip_RTC_Enable(LPC_RTC, DISABLE);
+    Chip_RTC_SetTime(LPC_RTC, RTC_TIMETYPE_SECOND, seconds % 60);
+    Chip_RTC_SetTime(LPC_RTC, RTC_TIMETYPE_MINUTE, seconds / 60 % 60);
+    Chip_RTC_SetTime(LPC_RTC, RTC_TIMETYPE_HOUR, seconds / 3600);
+    // Se reinicia la fraccion de segundo para que el proximo segundo se cumpla un segundo despues del ajuste
+    Chip_RTC_ResetClockTickCounter(LPC_RTC);
+    Chip_RTC_Enable(LPC_RTC, ENABLE);
+    Chip_REGFILE_Write(LPC_REGFILE, RTC_MARK_REGISTER, RTC_MARK);
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+clock_source_t ClockSourceRtc(void) {
+    if (!RtcIsSet()) {
+        Chip_RTC_Init(LPC_RTC);
+    }
+    return &rtc_source;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,320 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file command.c
+ ** @brief Interprete de los comandos que envia el anfitrion por el puerto serie
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "command.h"
+#include "frame.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Cantidad de entradas de la tabla de comandos, uno mas que el mayor codigo
+#define COMMAND_COUNT (PROTOCOL_GET_STATUS + 1)
+
+//! Bytes de datos de la respuesta mas larga
+#define COMMAND_RESPONSE_MAX (PROTOCOL_HEADER_SIZE + PROTOCOL_STATUS_SIZE)
+
+/* === Private data type declarations ============================================================================== */
+
+struct command_s {
+    clock_t clock;
+    command_driver_t driver;
+    frame_decoder_t decoder;
+    uint16_t received; // Tramas recibidas correctamente
+    uint16_t errors;   // Tramas descartadas por errores
+};
+
+//! Argumentos y respuesta de la ejecucion de un comando
+typedef struct command_call_s {
+    const uint8_t * arguments; // Argumentos recibidos, en la cantidad que indica la tabla de comandos
+    uint8_t * data;            // Datos de la respuesta, a continuacion de la cabecera
+    uint16_t length;           // Cantidad de bytes de datos de la respuesta
+} * command_call_t;
+
+/**
+ * @brief Funcion que ejecuta un comando.
+ * @param self Puntero al interprete.
+ * @param call Puntero a los argumentos y a la respuesta del comando.
+ * @return Resultado del comando.
+ */
+typedef protocol_result_t (*command_handler_t)(command_t self, command_call_t call);
+
+//! Entrada de la tabla de comandos
+struct command_entry_s {
+    command_handler_t handler; // Funcion que ejecuta el comando, NULL si el codigo no existe
+    uint8_t arguments;         // Cantidad exacta de bytes de argumentos
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Convierte horas, minutos y segundos en binario a una hora del reloj.
+ * @param values Puntero a las horas, los minutos y los segundos.
+ * @param time Puntero donde se almacena la hora convertida.
+ * @return true si los valores forman una hora valida, false en caso contrario.
+ */
+static bool ValuesToTime(const uint8_t * values, clock_time_t * time);
+
+/**
+ * @brief Convierte una hora del reloj a horas, minutos y segundos en binario.
+ * @param time Puntero a la hora del reloj.
+ * @param values Puntero donde se almacenan las horas, los minutos y los segundos.
+ */
+static void TimeToValues(const clock_time_t * time, uint8_t * values);
+
+/**
+ * @brief Escribe un contador con el byte mas significativo primero.
+ * @param data Puntero donde se escribe el contador.
+ * @param value Valor del contador.
+ * @param size Cantidad de bytes del contador.
+ * @return Puntero al byte siguiente al contador.
+ */
+static uint8_t * PutCounter(uint8_t * data, uint32_t value, uint8_t size);
+
+/**
+ * @brief Ejecuta una trama recibida y envia la respuesta.
+ * @param self Puntero al interprete.
+ * @param payload Puntero a los datos de la trama.
+ * @param size Cantidad de bytes de datos de la trama.
+ */
+static void Execute(command_t self, const uint8_t * payload, uint16_t size);
+
+static protocol_result_t GetTime(command_t self, command_call_t call);
+static protocol_result_t SetTime(command_t self, command_call_t call);
+static protocol_result_t GetAlarm(command_t self, command_call_t call);
+static protocol_result_t SetAlarm(command_t self, command_call_t call);
+static protocol_result_t Provision(command_t self, command_call_t call);
+static protocol_result_t GetStatus(command_t self, command_call_t call);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct command_entry_s commands[COMMAND_COUNT] = {
+    [PROTOCOL_GET_TIME] = {.handler = GetTime, .arguments = 0},
+    [PROTOCOL_SET_TIME] = {.handler = SetTime, .arguments = 3},
+    [PROTOCOL_GET_ALARM] = {.handler = GetAlarm, .arguments = 0},
+    [PROTOCOL_SET_ALARM] = {.handler = SetAlarm, .arguments = 3},
+    [PROTOCOL_PROVISION] = {.handler = Provision, .arguments = 6},
+    [PROTOCOL_GET_STATUS] = {.handler = GetStatus, .arguments = 0},
+};
+
+/* === Private function implementation ============================================================================= */
+
+static bool ValuesToTime(const uint8_t * values, clock_time_t * time) {
+    if ((values[0] > 23) || (values[1] > 59) || (values[2] > 59)) {
+        return false;
+    }
+    time->time.hours[1] = values[0] / 10;
+    time->time.hours[0] = values[0] % 10;
+    time->time.minutes[1] = values[1] / 10;
+    time->time.minutes[0] = values[1] % 10;
+    time->time.seconds[1] = values[2] / 10;
+    time->time.seconds[0] = values[2] % 10;
+    return true;
+}
+
+static void TimeToValues(const clock_time_t * time, uint8_t * values) {
+    values[0] = time->time.hours[1] * 10 + time->time.hours[0];
+    values[1] = time->time.minutes[1] * 10 + time->time.minutes[0];
+    values[2] = time->time.seconds[1] * 10 + time->time.seconds[0];
+}
+
+static uint8_t * PutCounter(uint8_t * data, uint32_t value, uint8_t size) {
+    for (uint8_t index = 0; index < size; index++) {
+        data[index] = value >> (8 * (size - 1 - index));
+    }
+    return data + size;
+}
+
+static protocol_result_t GetTime(command_t self, command_call_t call) {
+    clock_time_t time;
+
+    call->data[0] = ClockGetTime(self->clock, &time);
+    TimeToValues(&time, &call->data[1]);
+    call->length = 4;
+    return PROTOCOL_OK;
+}
+
+static protocol_result_t SetTime(command_t self, command_call_t call) {
+    clock_time_t time;
+
+    if (!ValuesToTime(call->arguments, &time)) {
+        return PROTOCOL_INVALID;
+    }
+    return ClockSetTime(self->clock, &time) ? PROTOCOL_OK : PROTOCOL_REJECTED;
+}
+
+static protocol_result_t GetAlarm(command_t self, command_call_t call) {
+    clock_time_t alarm;
+
+    if (!ClockGetAlarmTime(self->clock, &alarm)) {
+        return PROTOCOL_REJECTED;
+    }
+    TimeToValues(&alarm, call->data);
+    call->data[2] = ClockIsAlarmEnabled(self->clock);
+    call->length = 3;
+    return PROTOCOL_OK;
+}
+
+static protocol_result_t SetAlarm(command_t self, command_call_t call) {
+    const uint8_t values[3] = {call->arguments[0], call->arguments[1], 0};
+    bool enabled = call->arguments[2];
+    clock_time_t alarm;
+
+    if (!ValuesToTime(values, &alarm) || (call->arguments[2] > 1)) {
+        return PROTOCOL_INVALID;
+    }
+    if (!ClockSetAlarmTime(self->clock, &alarm)) {
+        return PROTOCOL_REJECTED;
+    }
+    if (enabled) {
+        ClockEnableAlarm(self->clock);
+    } else {
+        ClockDisableAlarm(self->clock);
+    }
+    // El reloj solo cambia la habilitacion cuando tiene una hora valida
+    return (ClockIsAlarmEnabled(self->clock) == enabled) ? PROTOCOL_OK : PROTOCOL_REJECTED;
+}
+
+static protocol_result_t Provision(command_t self, command_call_t call) {
+    const uint8_t * arguments = call->arguments;
+    const uint8_t values[3] = {arguments[3], arguments[4], 0};
+    clock_time_t time;
+
+    // Se validan todos los argumentos antes de aplicar alguno, asi un pedido incorrecto no deja cambios a medias
+    if (!ValuesToTime(arguments, &time) || !ValuesToTime(values, &time) || (arguments[5] > 1)) {
+        return PROTOCOL_INVALID;
+    }
+
+    protocol_result_t result = SetTime(self, call);
+    if (result == PROTOCOL_OK) {
+        call->arguments = &arguments[3];
+        result = SetAlarm(self, call);
+    }
+    return result;
+}
+
+static protocol_result_t GetStatus(command_t self, command_call_t call) {
+    command_counters_t counters = {0};
+    clock_time_t time;
+    uint8_t flags = 0;
+
+    if (self->driver->GetCounters != NULL) {
+        self->driver->GetCounters(&counters);
+    }
+    if (ClockGetTime(self->clock, &time)) {
+        flags |= PROTOCOL_FLAG_TIME_VALID;
+    }
+    if (ClockIsAlarmEnabled(self->clock)) {
+        flags |= PROTOCOL_FLAG_ALARM_ENABLED;
+    }
+    if (ClockIsAlarmTriggered(self->clock)) {
+        flags |= PROTOCOL_FLAG_ALARM_TRIGGERED;
+    }
+
+    uint8_t * next = PutCounter(call->data, flags, 1);
+    next = PutCounter(next, self->received, 2);
+    next = PutCounter(next, self->errors, 2);
+    next = PutCounter(next, counters.missed_ticks, 2);
+    next = PutCounter(next, counters.overruns, 2);
+    next = PutCounter(next, counters.telemetry_lost, 4);
+    next = PutCounter(next, counters.serial_lost, 4);
+    call->length = next - call->data;
+    return PROTOCOL_OK;
+}
+
+static void Execute(command_t self, const uint8_t * payload, uint16_t size) {
+    uint8_t response[COMMAND_RESPONSE_MAX];
+    uint8_t frame[FRAME_ENCODED_MAX];
+    struct command_call_s call = {.arguments = &payload[1], .data = &response[PROTOCOL_HEADER_SIZE], .length = 0};
+
+    if (size == 0) {
+        return;
+    }
+
+    const struct command_entry_s * entry = (payload[0] < COMMAND_COUNT) ? &commands[payload[0]] : NULL;
+    response[0] = payload[0] | PROTOCOL_RESPONSE;
+    if ((entry == NULL) || (entry->handler == NULL)) {
+        response[1] = PROTOCOL_UNKNOWN;
+    } else if (size - 1 != entry->arguments) {
+        response[1] = PROTOCOL_INVALID;
+    } else {
+        response[1] = entry->handler(self, &call);
+    }
+    if (response[1] != PROTOCOL_OK) {
+        call.length = 0;
+    }
+
+    // Si el puerto no tiene lugar la respuesta se pierde y el anfitrion repite el pedido al no recibirla
+    self->driver->Write(frame, FrameEncode(response, PROTOCOL_HEADER_SIZE + call.length, frame));
+}
+
+/* === Public function implementation ============================================================================== */
+
+command_t CommandCreate(clock_t clock, command_driver_t driver) {
+    if ((clock == NULL) || (driver == NULL) || (driver->Write == NULL)) {
+        return NULL;
+    }
+
+    command_t self = malloc(sizeof(struct command_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct command_s));
+        self->clock = clock;
+        self->driver = driver;
+        self->decoder = FrameDecoderCreate();
+        if (self->decoder == NULL) {
+            free(self);
+            self = NULL;
+        }
+    }
+    return self;
+}
+
+void CommandReceive(command_t self, const uint8_t * data, uint16_t size) {
+    const uint8_t * payload;
+    uint16_t length;
+
+    if ((self == NULL) || (data == NULL)) {
+        return;
+    }
+
+    for (uint16_t index = 0; index < size; index++) {
+        frame_status_t status = FrameDecoderPush(self->decoder, data[index]);
+
+        if (status == FRAME_READY) {
+            self->received++;
+            payload = FrameDecoderGetPayload(self->decoder, &length);
+            Execute(self, payload, length);
+        } else if (status == FRAME_ERROR) {
+            self->errors++;
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,108 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file event_queue.c
+ ** @brief Cola de eventos entre las interrupciones y el lazo principal
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "event_queue.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#if (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) != 0 || EVENT_QUEUE_SIZE > 128
+#error "EVENT_QUEUE_SIZE debe ser una potencia de dos no mayor a 128"
+#endif
+
+//! Mascara para convertir un contador libre en una posicion del arreglo
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1)
+
+/* === Private data type declarations ============================================================================== */
+
+// Los indices son contadores libres: solo el productor escribe head y solo el consumidor escribe tail
+struct event_queue_s {
+    event_t events[EVENT_QUEUE_SIZE];
+    volatile uint8_t head; // Cantidad de eventos agregados
+    volatile uint8_t tail; // Cantidad de eventos retirados
+    uint16_t lost;         // Eventos descartados por cola llena
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+/* === Public function implementation ============================================================================== */
+
+event_queue_t EventQueueCreate(void) {
+    event_queue_t self = malloc(sizeof(struct event_queue_s));
+
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct event_queue_s));
+    }
+    return self;
+}
+
+bool EventQueuePost(event_queue_t self, event_t event) {
+    if (self == NULL) {
+        return false;
+    }
+
+    uint8_t head = self->head;
+    if ((uint8_t)(head - self->tail) >= EVENT_QUEUE_SIZE) {
+        self->lost++;
+        return false;
+    }
+    self->events[head & EVENT_QUEUE_MASK] = event;
+    self->head = head + 1; // Se publica el indice despues de escribir el evento
+    return true;
+}
+
+bool EventQueueGet(event_queue_t self, event_t * event) {
+    if ((self == NULL) || (event == NULL)) {
+        return false;
+    }
+
+    uint8_t tail = self->tail;
+    if (tail == self->head) {
+        return false;
+    }
+    *event = self->events[tail & EVENT_QUEUE_MASK];
+    self->tail = tail + 1; // Se libera la posicion despues de leer el evento
+    return true;
+}
+
+bool EventQueueIsEmpty(event_queue_t self) {
+    return (self == NULL) || (self->tail == self->head);
+}
+
+uint16_t EventQueueGetLost(event_queue_t self) {
+    return (self != NULL) ? self->lost : 0;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,192 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file frame.c
+ ** @brief Tramas con relleno COBS y CRC-16 para los mensajes por el puerto serie
+ **
+ ** El relleno COBS reemplaza cada cero de la trama por la distancia al cero siguiente, por lo que el separador no
+ ** aparece dentro de la trama y el receptor se sincroniza con el primer separador que recibe. El CRC se agrega al
+ ** final de los datos con el byte mas significativo primero, asi el CRC calculado sobre los datos y el CRC recibido
+ ** vale cero y el decodificador lo puede acumular byte a byte sin saber donde terminan los datos.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "frame.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#define FRAME_POLYNOMIAL  0x1021 // Polinomio del CRC-16 CCITT
+#define FRAME_CRC_INITIAL 0xFFFF // Valor inicial del CRC
+#define FRAME_BLOCK_MAX   0xFF   // Codigo COBS de un bloque de 254 bytes que no termina en un cero
+
+//! Cantidad de bytes decodificados que puede almacenar el decodificador
+#define FRAME_BUFFER_SIZE (FRAME_PAYLOAD_MAX + FRAME_CRC_SIZE)
+
+/* === Private data type declarations ============================================================================== */
+
+struct frame_decoder_s {
+    uint8_t data[FRAME_BUFFER_SIZE];
+    uint16_t size;     // Bytes decodificados de la trama en curso
+    uint16_t crc;      // CRC acumulado de los bytes decodificados
+    uint8_t code;      // Codigo COBS del bloque en curso, cero si no se recibio ningun byte de la trama
+    uint8_t remaining; // Bytes que faltan para terminar el bloque en curso, cero si el proximo byte es un codigo
+    bool overflow;     // La trama en curso excede el buffer
+    bool ready;        // El ultimo byte completo una trama valida
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Acumula un byte en el calculo del CRC.
+ * @param crc Valor acumulado del CRC.
+ * @param byte Byte que se agrega al calculo.
+ * @return Nuevo valor acumulado del CRC.
+ */
+static uint16_t CrcUpdate(uint16_t crc, uint8_t byte);
+
+/**
+ * @brief Almacena un byte decodificado de la trama en curso.
+ * @param self Puntero al decodificador.
+ * @param byte Byte decodificado.
+ */
+static void Store(frame_decoder_t self, uint8_t byte);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+static uint16_t CrcUpdate(uint16_t crc, uint8_t byte) {
+    crc ^= (uint16_t)byte << 8;
+    for (int bit = 0; bit < 8; bit++) {
+        crc = (crc << 1) ^ (FRAME_POLYNOMIAL & -(crc >> 15));
+    }
+    return crc;
+}
+
+static void Store(frame_decoder_t self, uint8_t byte) {
+    if (self->size < FRAME_BUFFER_SIZE) {
+        self->data[self->size++] = byte;
+        self->crc = CrcUpdate(self->crc, byte);
+    } else {
+        self->overflow = true;
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+uint16_t FrameCrc(const uint8_t * data, uint16_t size) {
+    uint16_t crc = FRAME_CRC_INITIAL;
+
+    for (uint16_t index = 0; index < size; index++) {
+        crc = CrcUpdate(crc, data[index]);
+    }
+    return crc;
+}
+
+uint16_t FrameEncode(const uint8_t * payload, uint16_t size, uint8_t * frame) {
+    if ((frame == NULL) || (size > FRAME_PAYLOAD_MAX) || ((payload == NULL) && (size != 0))) {
+        return 0;
+    }
+
+    uint16_t crc = FrameCrc(payload, size);
+    uint16_t block = 0;  // Posicion del codigo del bloque en curso
+    uint16_t length = 1; // El primer byte es el codigo del primer bloque
+    uint8_t code = 1;
+
+    for (uint16_t index = 0; index < size + FRAME_CRC_SIZE; index++) {
+        uint8_t byte = (index < size) ? payload[index] : (index == size) ? (crc >> 8) : (crc & 0xFF);
+
+        if (byte != 0) {
+            frame[length++] = byte;
+            code++;
+        }
+        // Un cero o un bloque de 254 bytes sin ceros terminan el bloque en curso
+        if ((byte == 0) || (code == FRAME_BLOCK_MAX)) {
+            frame[block] = code;
+            block = length++;
+            code = 1;
+        }
+    }
+    frame[block] = code;
+    frame[length++] = FRAME_DELIMITER;
+    return length;
+}
+
+frame_decoder_t FrameDecoderCreate(void) {
+    frame_decoder_t self = malloc(sizeof(struct frame_decoder_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct frame_decoder_s));
+        self->crc = FRAME_CRC_INITIAL;
+    }
+    return self;
+}
+
+frame_status_t FrameDecoderPush(frame_decoder_t self, uint8_t byte) {
+    frame_status_t status = FRAME_INCOMPLETE;
+
+    if (self == NULL) {
+        return FRAME_ERROR;
+    }
+
+    self->ready = false;
+    if (byte == FRAME_DELIMITER) {
+        if (self->code != 0) {
+            self->ready = !self->overflow && (self->remaining == 0) && (self->size >= FRAME_CRC_SIZE);
+            self->ready = self->ready && (self->crc == 0);
+            status = self->ready ? FRAME_READY : FRAME_ERROR;
+        }
+        self->code = 0;
+        self->remaining = 0;
+        self->overflow = false;
+        self->crc = FRAME_CRC_INITIAL;
+    } else if (self->remaining == 0) {
+        // El cero implicito al final de cada bloque se agrega recien al comenzar el siguiente, porque el ultimo
+        // bloque de la trama no termina en un cero
+        if ((self->code != 0) && (self->code < FRAME_BLOCK_MAX)) {
+            Store(self, 0);
+        }
+        if (self->code == 0) {
+            self->size = 0; // Primer byte de una trama nueva
+        }
+        self->code = byte;
+        self->remaining = byte - 1;
+    } else {
+        Store(self, byte);
+        self->remaining--;
+    }
+    return status;
+}
+
+const uint8_t * FrameDecoderGetPayload(frame_decoder_t self, uint16_t * size) {
+    if ((self == NULL) || (size == NULL) || !self->ready) {
+        return NULL;
+    }
+    *size = self->size - FRAME_CRC_SIZE;
+    return self->data;
+}
+
+/* === End of documentation ======================================================================================== */
@@ -36,12 +36,55 @@
 
 #include "chip.h"
 #include <stdbool.h>
+#include "app.h"
 #include "digital.h"
 #include "config.h"
 #include "bsp.h"
 #include "screen.h"
 #include "poncho.h"
 #include "clock.h"
+#include "command.h"
+#include "event_queue.h"
+#include "hal_eeprom.h"
+#include "hal_tick.h"
+#include "profile.h"
+#include "scheduler.h"
+#include "settings.h"
+#include "telemetry.h"
+#include "ui.h"
+#include <string.h>
+
+/* === Macros definitions ====================================================================== */
+
+#define TICK_PERIOD_US         1000 // Periodo del temporizador del sistema, en microsegundos
+#define CYCLES_PER_US          204  // El nucleo funciona a 204 MHz
+#define BUDGET_US(us)          ((us) * CYCLES_PER_US)
+#define COMPOSE_PERIOD         10   // La pantalla se recompone cada 10 ms
+#define BLINK_PERIOD           100  // El punto parpadea una vez por segundo (100 composiciones)
+#define CLOCK_PERIOD           10   // El reloj avanza cada 10 ms
+#define CLOCK_OFFSET           (CLOCK_PERIOD / 2)
+#define CLOCK_TICKS_PER_SECOND (1000000 / (TICK_PERIOD_US * CLOCK_PERIOD))
+#define KEYS_PERIOD            10   // Las teclas se muestrean cada 10 ms, lo que filtra los rebotes
+#define UI_PERIOD              10   // Los eventos pendientes se procesan cada 10 ms
+#define SETTINGS_PERIOD        1000 // Los cambios de la configuracion se guardan como maximo una vez por segundo
+#define TELEMETRY_PERIOD       10   // El registro de eventos se entrega al puerto serie cada 10 ms
+#define CONSOLE_OUTPUT_SIZE    256  // Buffer de transmision del puerto serie, potencia de dos
+#define CONSOLE_INPUT_SIZE     16   // Buffer de recepcion del puerto serie, no se reciben datos
+#define COMMANDS_PERIOD        10   // Los comandos recibidos se procesan cada 10 ms
+#define COMMANDS_OUTPUT_SIZE   64   // Buffer de transmision de las respuestas, potencia de dos
+#define COMMANDS_INPUT_SIZE    128  // Buffer de recepcion de los comandos, potencia de dos
+#define COMMANDS_CHUNK         32   // Bytes recibidos que se entregan al interprete en cada activacion
+
+// La frecuencia fija del reloj, si se compila con ella, tiene que coincidir con la de la tarea que lo hace avanzar
+#if defined(CLOCK_STATIC_TPS) && (CLOCK_STATIC_TPS != CLOCK_TICKS_PER_SECOND)
+#error "CLOCK_STATIC_TPS no coincide con la frecuencia de la tarea del reloj"
+#endif
+
+// Regiones de codigo medidas con el modulo de perfilado, los resultados quedan en profile_table
+#define REGION_REFRESH  0                // Multiplexado de un digito de la pantalla
+#define REGION_CLOCK    APP_REGION_CLOCK // Avance del reloj, lo mide la tarea compartida del reloj
+#define REGION_DISPATCH 2                // Iteracion del lazo principal que atiende un tick del planificador
+#define TASKS_COUNT            (sizeof(tasks) / sizeof(tasks[0]))
 
 /* === Private data type declarations ========================================================== */
 
@@ -49,374 +92,353 @@
 
 /* === Private function declarations =========================================================== */
 
-void valueToTime(uint8_t * digits, clock_time_t * time);
-void timeToValue(uint8_t * digits, clock_time_t * time);
+/**
+ * @brief Multiplexa un digito de la pantalla y registra un nuevo tick en el planificador.
+ *
+ * Es el unico trabajo que se realiza en la interrupcion del temporizador, todo lo demas se difiere a las tareas del
+ * planificador que se ejecutan en el lazo principal. Mide su propia duracion en isr_last_cycles e isr_worst_cycles.
+ *
+ * @param object Puntero a datos del suscriptor, no se utiliza.
+ */
+static void SystemTick(void * object);
+
+/**
+ * @brief Mide el porcentaje de tiempo inactivo del ultimo segundo, la tarea de la interfaz la llama con cada segundo.
+ */
+static void SampleIdlePercent(void);
+
+//! Deshabilita las interrupciones para que el multiplexado no lea la pantalla mientras se publica una nueva imagen
+static void DisableRefresh(void);
+
+//! Vuelve a habilitar las interrupciones despues de publicar una nueva imagen en la pantalla
+static void EnableRefresh(void);
+
+/**
+ * @brief Guarda en la memoria no volatil los cambios de la alarma.
+ *
+ * La habilitacion de la alarma guardada se restaura recien cuando el reloj tiene una hora valida, porque antes el
+ * reloj no permite habilitarla.
+ *
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void SettingsTask(void * object);
+
+/**
+ * @brief Registra los ticks perdidos y los presupuestos excedidos y entrega el registro de eventos al puerto serie.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void TelemetryTask(void * object);
+
+/**
+ * @brief Devuelve el tiempo con el que se marcan los registros de eventos.
+ * @return Milisegundos transcurridos desde el arranque del temporizador del sistema.
+ */
+static uint32_t TelemetryClock(void);
+
+/**
+ * @brief Coloca los bytes del registro de eventos en el buffer de transmision del puerto serie sin esperar.
+ * @param data Puntero a los bytes que se deben transmitir.
+ * @param size Cantidad de bytes que se deben transmitir.
+ * @return Cantidad de bytes aceptados por el puerto serie.
+ */
+static uint16_t TelemetryWrite(const void * data, uint16_t size);
+
+/**
+ * @brief Entrega al interprete los bytes recibidos por el puerto de los comandos.
+ * @param object Puntero a datos de la tarea, no se utiliza.
+ */
+static void CommandsTask(void * object);
+
+/**
+ * @brief Coloca una respuesta en el buffer de transmision del puerto de los comandos sin esperar.
+ * @param data Puntero a los bytes que se deben transmitir.
+ * @param size Cantidad de bytes que se deben transmitir.
+ * @return Cantidad de bytes aceptados por el puerto serie.
+ */
+static uint16_t CommandsWrite(const void * data, uint16_t size);
+
+/**
+ * @brief Obtiene los contadores del planificador, del registro de eventos y de los puertos serie.
+ * @param counters Puntero donde se almacenan los contadores.
+ */
+static void CommandsGetCounters(command_counters_t * counters);
+
+/**
+ * @brief Configura el parpadeo de los digitos de la pantalla a pedido de la interfaz.
+ * @param from Primer digito que parpadea.
+ * @param to Ultimo digito que parpadea.
+ * @param divisor Periodo del parpadeo, cero para dejar de parpadear.
+ */
+static void UiFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
 
-uint32_t ClockGetTicks(void);
-bool milisegundosAntibounce(digital_input_t boton, uint32_t msNecesarios);
+/**
+ * @brief Enciende o apaga el led que indica que la alarma esta sonando.
+ * @param active true para encender el led, false para apagarlo.
+ */
+static void UiAlarmIndicator(bool active);
+
+/**
+ * @brief Informa un error de arranque por el puerto serie, enciende el led rojo y detiene el programa.
+ * @param message Texto que se envia por el puerto serie.
+ */
+static void StopByError(const char * message);
 
 /* === Public variable definitions ============================================================= */
 
-system_mode_t mode = MODE_UNSET; // Modo del sistema, comienza en no configurado
 Board_t board;
-clock_t clock;             // Variable global para el reloj
-clock_time_t current_time; // Variable global para la hora actual del reloj
-clock_time_t alarm_time;   // Variable global para la hora de la alarma
+// Reloj, interfaz, cola de eventos, teclas y hora actual que comparten las tareas de la aplicacion
+struct app_s app = {
+    .blink_period = BLINK_PERIOD,
+    .SecondElapsed = SampleIdlePercent,
+    .DisableRefresh = DisableRefresh,
+    .EnableRefresh = EnableRefresh,
+};
 
-uint8_t digits[4] = {0, 0, 0, 0}; // Dígitos para mostrar la hora
-uint8_t dots[4] = {0, 1, 0, 0};
+scheduler_t scheduler;    // Planificador de las tareas, sus mediciones se consultan con SchedulerGetStats
+uint8_t idle_percent = 0; // Porcentaje de tiempo inactivo medido durante el ultimo segundo
 
-uint8_t last_state;
-uint16_t ticks = 1000;
-static volatile uint32_t systemTicks = 0;
+uint32_t isr_last_cycles = 0;  // Duracion de la ultima interrupcion del temporizador, en ciclos
+uint32_t isr_worst_cycles = 0; // Peor duracion medida de la interrupcion del temporizador, en ciclos
+
+settings_store_t settings_store; // Almacen de la configuracion en la EEPROM
+telemetry_t telemetry;           // Registro de eventos que se transmite por el puerto serie
+command_t command;               // Interprete de los comandos que envia el anfitrion
 
-bool segundo;
 /* === Private variable definitions ============================================================ */
 
+static settings_t settings = {.brightness = 100}; // Ultima configuracion guardada, o la de fabrica
+static volatile uint32_t milliseconds = 0;        // Tiempo transcurrido desde el arranque del temporizador
+
+static uint8_t console_output[CONSOLE_OUTPUT_SIZE]; // Buffer de transmision del puerto serie
+static uint8_t console_input[CONSOLE_INPUT_SIZE];   // Buffer de recepcion del puerto serie
+static uint8_t commands_output[COMMANDS_OUTPUT_SIZE]; // Buffer de transmision de las respuestas
+static uint8_t commands_input[COMMANDS_INPUT_SIZE];   // Buffer de recepcion de los comandos
+
+static const struct hal_tick_subscriber_s system_tick = {
+    .handler = SystemTick, .divider = 1, .offset = 0, .priority = 0};
+
+// Las tareas activadas en el mismo tick se ejecutan en el orden de la tabla. Los presupuestos son los peores tiempos
+// admitidos para cada tarea.
+static const struct scheduler_task_s tasks[] = {
+    {.name = "compose", .handler = AppDisplayComposeTask, .object = &app, .period = COMPOSE_PERIOD, .offset = 0,
+     .budget = BUDGET_US(20)},
+    // Desfasadas para no coincidir con la recomposicion de la pantalla en el mismo tick
+    {.name = "clock", .handler = AppClockTask, .object = &app, .period = CLOCK_PERIOD, .offset = CLOCK_OFFSET,
+     .budget = BUDGET_US(20)},
+    {.name = "keys", .handler = AppKeysScanTask, .object = &app, .period = KEYS_PERIOD, .offset = 2,
+     .budget = BUDGET_US(20)},
+    {.name = "ui", .handler = AppUiTask, .object = &app, .period = UI_PERIOD, .offset = 7, .budget = BUDGET_US(200)},
+    // Solo inicia la programacion de la EEPROM, que termina sola mientras se ejecutan las otras tareas
+    {.name = "settings", .handler = SettingsTask, .period = SETTINGS_PERIOD, .offset = 3, .budget = BUDGET_US(50)},
+    // Solo copia bytes al buffer del puerto serie, la transmision la completa su interrupcion
+    {.name = "telemetry", .handler = TelemetryTask, .period = TELEMETRY_PERIOD, .offset = 9, .budget = BUDGET_US(20)},
+    {.name = "commands", .handler = CommandsTask, .period = COMMANDS_PERIOD, .offset = 1, .budget = BUDGET_US(50)},
+};
+
+static const struct ui_driver_s ui_driver = {
+    .FlashDigits = UiFlashDigits,
+    .AlarmIndicator = UiAlarmIndicator,
+};
+
+static const struct command_driver_s command_driver = {
+    .Write = CommandsWrite,
+    .GetCounters = CommandsGetCounters,
+};
+
 /* === Private function implementation ========================================================= */
 
-void valueToTime(uint8_t * digits, clock_time_t * time) {
-    time->bcd[5] = digits[0]; // horas decenas
-    time->bcd[4] = digits[1]; // horas unidades
-    time->bcd[3] = digits[2]; // minutos decenas
-    time->bcd[2] = digits[3]; // minutos unidades
-    time->bcd[1] = 0;         // segundos decenas
-    time->bcd[0] = 0;         // segundos unidades
-}
+static void StopByError(const char * message) {
+    SciWrite(board->console, message, strlen(message));
+    DigitalOutputActivate(board->led_red);
 
-void timeToValue(uint8_t * digits, clock_time_t * time) {
-    digits[0] = time->bcd[5]; // horas decenas
-    digits[1] = time->bcd[4]; // horas unidades
-    digits[2] = time->bcd[3]; // minutos decenas
-    digits[3] = time->bcd[2]; // minutos unidades
+    // Las interrupciones del puerto serie terminan de transmitir el mensaje mientras el procesador espera
+    while (true) {
+        __WFI();
+    }
 }
 
-uint32_t ClockGetTicks(void) {
-    return systemTicks;
+static void UiFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    // La interrupcion del temporizador usa la configuracion del parpadeo al multiplexar, no debe verla a medio cambiar
+    __disable_irq();
+    DisplayFlashDigits(board->screen, from, to, divisor);
+    __enable_irq();
 }
 
-bool milisegundosAntibounce(digital_input_t boton, uint32_t msNecesarios) {
-    static uint32_t tiempoInicio = 0;
-    static uint32_t tiempoUltimoCambio = 0;
-    static bool contando = false;
-    static bool autorizar = false;
-    static bool terminado = false;
-
-    uint32_t tiempoActual = ClockGetTicks();
-    digital_states_t cambio = DigitalInputWasChanged(boton);
-    bool presionado = DigitalInputGetIsActive(boton);
-
-    // Si ya se activó y no queremos repetir
-    if (terminado) {
-        // Esperar que el botón sea liberado para reiniciar todo
-        if (!presionado) {
-            contando = false;
-            autorizar = false;
-            terminado = false;
-        }
-        return false;
+static void UiAlarmIndicator(bool active) {
+    if (active) {
+        DigitalOutputActivate(board->led_blue);
+    } else {
+        DigitalOutputDeactivate(board->led_blue);
     }
+}
+
+/* === Public function implementation ========================================================= */
+
+int main(void) {
 
-    // Si hubo un cambio de estado (flanco), actualizamos tiempo
-    if (cambio != DIGITAL_INPUT_NO_CHANGE) {
-        tiempoUltimoCambio = tiempoActual;
+    // Inicializar el sistema
+    board = BoardCreate();
+    app.clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, ClockSourceRtc()); // La hora sobrevive a los cortes
+    app.events = EventQueueCreate();
+    app.ui = UiCreate(app.clock, &ui_driver); // Sin hora valida comienza con todos los digitos parpadeando
+    scheduler = SchedulerCreate(tasks, TASKS_COUNT, BoardGetCycles);
+    telemetry = TelemetryCreate(TelemetryClock);
+    SciSetBuffers(board->console, console_output, sizeof(console_output), console_input, sizeof(console_input));
+    command = CommandCreate(app.clock, &command_driver);
+    SciSetBuffers(board->commands, commands_output, sizeof(commands_output), commands_input, sizeof(commands_input));
+    if ((app.clock == NULL) || (app.events == NULL) || (app.ui == NULL) || (scheduler == NULL) ||
+        (telemetry == NULL) || (command == NULL)) {
+        StopByError("No hay memoria para crear los objetos de la aplicacion\r\n");
+    }
+    app.screen = board->screen;
+    app.telemetry = telemetry;
+    app.keys[EVENT_KEY_SET_TIME] = board->set_time;
+    app.keys[EVENT_KEY_SET_ALARM] = board->set_alarm;
+    app.keys[EVENT_KEY_DECREMENT] = board->decrement;
+    app.keys[EVENT_KEY_INCREMENT] = board->increment;
+    app.keys[EVENT_KEY_ACCEPT] = board->accept;
+    app.keys[EVENT_KEY_CANCEL] = board->cancel;
+
+    // La hora de la alarma guardada antes del ultimo corte de alimentacion se recupera aunque el reloj no tenga hora
+    EepromInit();
+    settings_store = SettingsStoreCreate(0, EepromGetSize());
+    if (SettingsLoad(settings_store, &settings)) {
+        ClockSetAlarmTime(app.clock, &settings.alarm);
     }
 
-    // Si hubo demasiada inactividad (sin cambios), reseteamos
-    if ((tiempoActual - tiempoUltimoCambio) >= 200) {
-        contando = false;
-        autorizar = false;
+    ProfileInit();
+    ProfileSetName(REGION_REFRESH, "ScreenRefresh");
+    ProfileSetName(REGION_CLOCK, "ClockNewTick");
+    ProfileSetName(REGION_DISPATCH, "Dispatch");
+
+    // Sin el temporizador no se ejecuta ninguna tarea, el reloj quedaria detenido sin indicar la falla
+    if (!TickSubscribe(&system_tick) || !TickServiceStart(TICK_PERIOD_US)) {
+        StopByError("No se pudo iniciar el temporizador del sistema\r\n");
     }
 
-    if (presionado) {
-        if (!contando) {
-            tiempoInicio = tiempoActual;
-            tiempoUltimoCambio = tiempoActual;
-            contando = true;
-        } else if ((tiempoActual - tiempoInicio) >= msNecesarios) {
-            autorizar = true;
-            contando = false;
+    while (true) {
+
+        // Las interrupciones se deshabilitan para que un tick registrado entre la verificacion y la suspension
+        // despierte igualmente al procesador
+        __disable_irq();
+        if (!SchedulerHasPending(scheduler)) {
+            BoardSleep();
         }
-    } else {
-        contando = false;
+        __enable_irq();
+
+        // El led rojo queda encendido si alguna tarea excedio su presupuesto o se perdio algun tick
+        PROFILE_BEGIN(REGION_DISPATCH);
+        if (SchedulerDispatch(scheduler) && !SchedulerIsSchedulable(scheduler)) {
+            DigitalOutputActivate(board->led_red);
+        }
+        PROFILE_END(REGION_DISPATCH);
     }
+}
 
-    if (autorizar) {
-        autorizar = false;
-        terminado = true;
-        return true;
+static void SystemTick(void * object) {
+    uint32_t start = BoardGetCycles();
+
+    // El multiplexado se hace aqui para que cada digito se encienda con un periodo fijo, sin depender de la duracion
+    // de las tareas que se ejecutan en el mismo tick
+    PROFILE_BEGIN(REGION_REFRESH);
+    ScreenRefresh(board->screen);
+    PROFILE_END(REGION_REFRESH);
+    SchedulerTick(scheduler);
+    milliseconds += TICK_PERIOD_US / 1000;
+
+    isr_last_cycles = BoardGetCycles() - start;
+    if (isr_last_cycles > isr_worst_cycles) {
+        isr_worst_cycles = isr_last_cycles;
     }
+}
 
-    return false;
+static void SampleIdlePercent(void) {
+    idle_percent = BoardGetIdlePercent();
 }
 
-/* === Public function implementation ========================================================= */
+static void DisableRefresh(void) {
+    __disable_irq();
+}
 
-int main(void) {
+static void EnableRefresh(void) {
+    __enable_irq();
+}
 
-    // Inicializar el sistema
-    board = BoardCreate();
-    clock = ClockCreate(ticks); // Crea el reloj con la frecuencia especificada (ticks por segundo)
+static void SettingsTask(void * object) {
+    static bool restored = false;
+    settings_t current = settings;
+    clock_time_t now;
 
-    SysTickInit(ticks);
-    DisplayFlashDigits(board->screen, 0, 3, 100);
+    if (!ClockGetTime(app.clock, &now)) {
+        return;
+    }
+    if (!restored) {
+        if (settings.alarm_enabled) {
+            ClockEnableAlarm(app.clock);
+        }
+        restored = true;
+    }
 
-    while (true) {
+    ClockGetAlarmTime(app.clock, &current.alarm);
+    current.alarm_enabled = ClockIsAlarmEnabled(app.clock);
+    // Si la EEPROM todavia esta programando el registro anterior se vuelve a intentar en la proxima activacion
+    if (SettingsSave(settings_store, &current)) {
+        settings = current;
+    }
+}
 
-        switch (mode) {
-        case MODE_UNSET:
-
-            if (DigitalInputWasDeactivated(board->set_alarm)) {
-                if (ClockGetAlarmTime(clock, &alarm_time)) {
-                    timeToValue(digits, &alarm_time); // Convierte la hora de la alarma a dígitos
-                }
-                if (ClockIsAlarmEnabled(clock)) {
-                    dots[0] = 1;
-                } else {
-                    dots[0] = 1;
-                    dots[1] = 1;
-                    dots[2] = 1;
-                    dots[3] = 1;
-                }
-                mode = MODE_SET_ALARM_MINUTES;
-                last_state = MODE_UNSET;
-                DisplayFlashDigits(board->screen, 2, 3, 100);
-
-            } else if (DigitalInputWasDeactivated(board->set_time)) {
-
-                mode = MODE_SET_TIME_MINUTES;
-                last_state = MODE_UNSET;
-                DisplayFlashDigits(board->screen, 2, 3, 100);
-            }
-            break;
-
-        case MODE_HOME:
-            if (ClockGetTime(clock, &current_time)) {
-                timeToValue(digits, &current_time); // Convierte la hora actual a dígitos
-            }
-            ScreenWriteBCD(board->screen, digits, sizeof(digits));
-            if (DigitalInputWasDeactivated(board->set_time)) {
-                DisplayFlashDigits(board->screen, 2, 3, 100);
-                mode = MODE_SET_TIME_MINUTES;
-                last_state = MODE_HOME;
-
-            } else if (DigitalInputWasDeactivated(board->set_alarm)) {
-                DisplayFlashDigits(board->screen, 2, 3, 100);
-                if (ClockGetAlarmTime(clock, &alarm_time)) {
-                    timeToValue(digits, &alarm_time); // Convierte la hora de la alarma a dígitos
-                }
-                if (ClockIsAlarmEnabled(clock)) {
-                    dots[0] = 1;
-                }
-                mode = MODE_SET_ALARM_MINUTES;
-                last_state = MODE_HOME;
-            }
-
-            // verificacion de la alarma
-            if (ClockIsAlarmTriggered(clock)) {
-                mode = MODE_ALARM_TRIGGERED;
-                DigitalOutputActivate(board->led_blue);
-            }
-
-            // activar y desactivar la alarma
-            if (DigitalInputWasDeactivated(board->accept)) {
-                ClockEnableAlarm(clock);
-            } else if (DigitalInputWasDeactivated(board->cancel)) {
-                ClockDisableAlarm(clock);
-            }
-            break;
-
-        case MODE_SET_TIME_MINUTES:
-            if (DigitalInputWasDeactivated(board->cancel)) {
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 100);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-            }
-            if (DigitalInputWasDeactivated(board->increment)) {
-                uint8_t minutos = digits[2] * 10 + digits[3]; // Combina los dígitos
-                minutos = (minutos + 1) % 60;                 // Aumenta y reinicia en 0 si pasa de 60
-                digits[2] = minutos / 10;                     // Divide en decenas
-                digits[3] = minutos % 10;                     // Y unidades
-            }
-
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                uint8_t minutos = digits[2] * 10 + digits[3]; // Combina los dígitos
-                minutos = (minutos - 1 + 60) % 60;            // Decrementa y reinicia en 59 si pasa de 0
-                digits[2] = minutos / 10;                     // Divide en decenas
-                digits[3] = minutos % 10;                     // Y unidades
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-                DisplayFlashDigits(board->screen, 0, 1, 100);
-                mode = MODE_SET_TIME_HOURS; // Cambia al modo de ajuste de horas
-                DisplayFlashDigits(board->screen, 0, 1, 100);
-            }
-            break;
-
-        case MODE_SET_TIME_HOURS:
-
-            if (DigitalInputWasDeactivated(board->cancel)) {
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 100);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-            }
-            if (DigitalInputWasDeactivated(board->increment)) {
-                uint8_t horas = digits[0] * 10 + digits[1]; // Combina los dígitos
-                horas = (horas + 1) % 24;                   // Aumenta y reinicia en 0 si pasa de 23
-                digits[0] = horas / 10;                     // Divide en decenas
-                digits[1] = horas % 10;                     // Y unidades
-            }
-
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                uint8_t horas = digits[0] * 10 + digits[1]; // Combina los dígitos
-                horas = (horas - 1 + 24) % 24;              // Decrementa y reinicia en 23 si pasa de 0
-                digits[0] = horas / 10;                     // Divide en decenas
-                digits[1] = horas % 10;                     // Y unidades
-            }
-
-            if (DigitalInputWasDeactivated(board->accept)) {
-                DisplayFlashDigits(board->screen, 0, 0, 0);
-                valueToTime(digits, &current_time); // Convierte los dígitos a tiempo actual
-                if (ClockSetTime(clock, &current_time)) {
-                    mode = MODE_HOME; // Vuelve al modo HOME después de aceptar
-                    last_state = MODE_HOME;
-                } else if (!ClockSetTime(clock, &current_time)) {
-                    DigitalOutputActivate(board->led_blue); // Opcional, para debug
-                }
-            }
-            break;
-
-        case MODE_SET_ALARM_MINUTES:
-            if (DigitalInputWasDeactivated(board->cancel)) {
-                dots[0] = 0;
-                dots[1] = 0;
-                dots[2] = 0;
-                dots[3] = 0;
-
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 100);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-            }
-
-            if (DigitalInputWasDeactivated(board->increment)) {
-                uint8_t minutos = digits[2] * 10 + digits[3]; // Combina los dígitos
-                minutos = (minutos + 1) % 60;                 // Aumenta y reinicia en 0 si pasa de 60
-                digits[2] = minutos / 10;                     // Divide en decenas
-                digits[3] = minutos % 10;                     // Y unidades
-            }
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                uint8_t minutos = digits[2] * 10 + digits[3]; // Combina los dígitos
-                minutos = (minutos - 1 + 60) % 60;            // Decrementa y reinicia en 59 si pasa de 0
-                digits[2] = minutos / 10;                     // Divide en decenas
-                digits[3] = minutos % 10;                     // Y unidades
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-                DisplayFlashDigits(board->screen, 0, 1, 100);
-                mode = MODE_SET_ALARM_HOURS;
-            }
-            break;
-        case MODE_SET_ALARM_HOURS:
-            if (DigitalInputWasDeactivated(board->cancel)) {
-                dots[0] = 0;
-                dots[0] = 0;
-                dots[1] = 0;
-                dots[2] = 0;
-                dots[3] = 0;
-                if (last_state == MODE_UNSET) {
-                    DisplayFlashDigits(board->screen, 0, 3, 100);
-                    mode = MODE_UNSET; // Cancelar y volver al modo UNSET
-                } else {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    mode = MODE_HOME; // Cancelar y volver al modo HOME
-                }
-            }
-            if (DigitalInputWasDeactivated(board->increment)) {
-                uint8_t horas = digits[0] * 10 + digits[1]; // Combina los dígitos
-                horas = (horas + 1) % 24;                   // Aumenta y reinicia en 0 si pasa de 23
-                digits[0] = horas / 10;                     // Divide en decenas
-                digits[1] = horas % 10;                     // Y unidades
-            }
-            if (DigitalInputWasDeactivated(board->decrement)) {
-                uint8_t horas = digits[0] * 10 + digits[1]; // Combina los dígitos
-                horas = (horas - 1 + 24) % 24;              // Decrementa y reinicia en 23 si pasa de 0
-                digits[0] = horas / 10;                     // Divide en decenas
-                digits[1] = horas % 10;                     // Y unidades
-            }
-            if (DigitalInputWasDeactivated(board->accept)) {
-                dots[0] = 0;
-                dots[0] = 0;
-                dots[1] = 0;
-                dots[2] = 0;
-                dots[3] = 0;
-                valueToTime(digits, &alarm_time); // Convierte los dígitos a tiempo de alarma
-                if (ClockSetAlarmTime(clock, &alarm_time)) {
-                    DisplayFlashDigits(board->screen, 0, 0, 0);
-                    ClockEnableAlarm(clock); // Habilita la alarma
-                    if (last_state != MODE_UNSET) {
-                        mode = MODE_HOME;
-                    } else {
-                        mode = MODE_UNSET;
-                        DisplayFlashDigits(board->screen, 0, 3, 100);
-                    }
-                }
-            }
-
-            break;
-
-        case MODE_ALARM_TRIGGERED:
-            if (ClockGetTime(clock, &current_time)) {
-                timeToValue(digits, &current_time);
-            }
-            if (DigitalInputWasDeactivated(board->cancel)) {
-                // Cancelar la alarma y volver al modo HOME
-                ClockCancelAlarmUntilNextDay(clock);
-                mode = MODE_HOME;
-                dots[3] = 0;
-
-            } else if (DigitalInputWasDeactivated(board->accept)) {
-                // Posponer la alarma
-                if (ClockSnoozeAlarm(clock, 5)) { // Posponer 5 minutos
-                    mode = MODE_HOME;             // Vuelve al modo HOME después de posponer
-                    dots[3] = 0;
-                }
-            }
-        }
+static void TelemetryTask(void * object) {
+    static uint16_t missed = 0;
+    static uint16_t overruns[TASKS_COUNT] = {0};
+    scheduler_stats_t stats;
 
-        for (int delay = 0; delay < 25000; delay++) {
-            __asm("NOP");
+    if (SchedulerGetMissedTicks(scheduler) != missed) {
+        missed = SchedulerGetMissedTicks(scheduler);
+        TelemetryLog(telemetry, TELEMETRY_MISSED_TICKS, missed);
+    }
+    for (uint8_t index = 0; index < TASKS_COUNT; index++) {
+        if (SchedulerGetStats(scheduler, index, &stats) && (stats.overruns != overruns[index])) {
+            overruns[index] = stats.overruns;
+            TelemetryLog(telemetry, TELEMETRY_OVERRUN, index);
         }
     }
+    TelemetryDrain(telemetry, TelemetryWrite);
 }
 
-void SysTick_Handler(void) {
-    static uint16_t tick_count = 0;
-    systemTicks++; // 1 ms por tick
+static uint32_t TelemetryClock(void) {
+    return milliseconds;
+}
 
-    ScreenRefresh(board->screen);
-    ScreenWriteBCD(board->screen, digits, sizeof(digits));
-    ScreenWriteDOT(board->screen, dots, sizeof(dots));
-
-    tick_count = (tick_count + 1) % 1000;
-    if (tick_count < 500) {
-        ScreenToggleDot(board->screen, 1);
-        if (mode == MODE_ALARM_TRIGGERED) {
-            dots[3] = 1;
+static uint16_t TelemetryWrite(const void * data, uint16_t size) {
+    return SciWrite(board->console, data, size);
+}
+
+static void CommandsTask(void * object) {
+    uint8_t received[COMMANDS_CHUNK];
+    uint16_t count;
+
+    // El anfitrion espera cada respuesta antes de enviar otro pedido, los bytes de un pedido que no se alcanzan a
+    // procesar quedan en el buffer de recepcion para la proxima activacion
+    count = SciRead(board->commands, received, sizeof(received));
+    CommandReceive(command, received, count);
+}
+
+static uint16_t CommandsWrite(const void * data, uint16_t size) {
+    return SciWrite(board->commands, data, size);
+}
+
+static void CommandsGetCounters(command_counters_t * counters) {
+    scheduler_stats_t stats;
+
+    counters->missed_ticks = SchedulerGetMissedTicks(scheduler);
+    counters->overruns = 0;
+    for (uint8_t index = 0; index < TASKS_COUNT; index++) {
+        if (SchedulerGetStats(scheduler, index, &stats)) {
+            counters->overruns += stats.overruns;
         }
     }
-
-    ClockNewTick(clock); // la validacion ya es interna al reloj, no hace falta validar aca
-    ClockGetTime(clock, &current_time);
+    counters->telemetry_lost = TelemetryGetLost(telemetry);
+    counters->serial_lost = SciGetLost(board->commands);
 }
 
 /* === End of documentation ==================================================================== */
@@ -0,0 +1,99 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clock_source_posix.c
+ ** @brief Fuente de la hora del dia sobre el reloj de tiempo real de la PC
+ **
+ ** No incluye clock.h porque el tipo clock_t del reloj coincide con el de la biblioteca estandar. El firmware solo
+ ** compila los archivos de src, sin las subcarpetas, asi que este archivo lo usan las pruebas y la edicion sobre
+ ** FreeRTOS para la PC.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "clock_source.h"
+#include <stddef.h>
+#include <time.h>
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static bool PosixRead(uint32_t * seconds);
+
+static bool PosixWrite(uint32_t seconds);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct clock_source_s posix_source = {
+    .Read = PosixRead,
+    .Write = PosixWrite,
+};
+
+static uint32_t offset = 0; // Diferencia entre la hora ajustada y la hora local de la PC, en segundos
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+//! Obtiene la hora local de la PC en segundos desde la medianoche
+static bool LocalSeconds(uint32_t * seconds) {
+    struct timespec now;
+    struct tm local;
+
+    if ((clock_gettime(CLOCK_REALTIME, &now) != 0) || (localtime_r(&now.tv_sec, &local) == NULL)) {
+        return false;
+    }
+    *seconds = local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    // Los segundos intercalados se cuentan como el ultimo segundo del minuto
+    if (local.tm_sec > 59) {
+        *seconds -= local.tm_sec - 59;
+    }
+    return true;
+}
+
+static bool PosixRead(uint32_t * seconds) {
+    if (!LocalSeconds(seconds)) {
+        return false;
+    }
+    *seconds = (*seconds + offset) % CLOCK_SOURCE_SECONDS_PER_DAY;
+    return true;
+}
+
+static bool PosixWrite(uint32_t seconds) {
+    uint32_t local;
+
+    if ((seconds >= CLOCK_SOURCE_SECONDS_PER_DAY) || !LocalSeconds(&local)) {
+        return false;
+    }
+    offset = (seconds + CLOCK_SOURCE_SECONDS_PER_DAY - local) % CLOCK_SOURCE_SECONDS_PER_DAY;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+clock_source_t ClockSourcePosix(void) {
+    return &posix_source;
+}
+
+/* === End of documentation ======================================================================================== */
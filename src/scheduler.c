@@ -0,0 +1,197 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file scheduler.c
+ ** @brief Planificador cooperativo disparado por tiempo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "scheduler.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Estado de ejecucion de una tarea del planificador
+struct scheduler_state_s {
+    uint16_t delay; // Ticks que faltan para la proxima activacion
+    bool ready;     // La tarea fue activada y espera ser ejecutada
+};
+
+// Solo la interrupcion escribe ticks y solo el despachador escribe processed
+struct scheduler_s {
+    const struct scheduler_task_s * tasks;
+    uint8_t count;
+    scheduler_clock_t clock;
+    volatile uint16_t ticks; // Cantidad de ticks registrados
+    uint16_t processed;      // Cantidad de ticks atendidos por el despachador
+    uint16_t missed;         // Ticks que llegaron antes de terminar de atender el anterior
+    struct scheduler_state_s state[SCHEDULER_MAX_TASKS];
+    scheduler_stats_t stats[SCHEDULER_MAX_TASKS];
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Descuenta un tick en todas las tareas y marca como listas las que deben activarse.
+ * @param self Puntero al planificador.
+ */
+static void ReleaseTasks(scheduler_t self);
+
+/**
+ * @brief Ejecuta una tarea y actualiza sus mediciones.
+ * @param self Puntero al planificador.
+ * @param index Posicion de la tarea en la tabla.
+ */
+static void RunTask(scheduler_t self, uint8_t index);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+static void ReleaseTasks(scheduler_t self) {
+    for (uint8_t index = 0; index < self->count; index++) {
+        struct scheduler_state_s * state = &self->state[index];
+
+        if (state->delay == 0) {
+            if (state->ready) {
+                self->stats[index].skipped++;
+            }
+            state->ready = true;
+            state->delay = self->tasks[index].period;
+        }
+        state->delay--;
+    }
+}
+
+static void RunTask(scheduler_t self, uint8_t index) {
+    scheduler_task_t task = &self->tasks[index];
+    scheduler_stats_t * stats = &self->stats[index];
+    uint32_t start = self->clock();
+
+    task->handler(task->object);
+
+    // La resta entre contadores libres da la duracion correcta aun si el contador desborda
+    stats->last = self->clock() - start;
+    if (stats->last > stats->worst) {
+        stats->worst = stats->last;
+    }
+    if (stats->last > task->budget) {
+        stats->overruns++;
+    }
+    stats->runs++;
+}
+
+/* === Public function implementation ============================================================================== */
+
+scheduler_t SchedulerCreate(const struct scheduler_task_s * tasks, uint8_t count, scheduler_clock_t clock) {
+    if ((tasks == NULL) || (clock == NULL) || (count == 0) || (count > SCHEDULER_MAX_TASKS)) {
+        return NULL;
+    }
+    for (uint8_t index = 0; index < count; index++) {
+        if ((tasks[index].handler == NULL) || (tasks[index].period == 0)) {
+            return NULL;
+        }
+    }
+
+    scheduler_t self = malloc(sizeof(struct scheduler_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct scheduler_s));
+        self->tasks = tasks;
+        self->count = count;
+        self->clock = clock;
+        for (uint8_t index = 0; index < count; index++) {
+            self->state[index].delay = tasks[index].offset;
+        }
+    }
+    return self;
+}
+
+void SchedulerTick(scheduler_t self) {
+    if (self != NULL) {
+        self->ticks++;
+    }
+}
+
+bool SchedulerHasPending(scheduler_t self) {
+    return (self != NULL) && (self->ticks != self->processed);
+}
+
+bool SchedulerDispatch(scheduler_t self) {
+    if (self == NULL) {
+        return false;
+    }
+
+    uint16_t elapsed = self->ticks - self->processed;
+    if (elapsed == 0) {
+        return false;
+    }
+    if (elapsed > 1) {
+        self->missed += elapsed - 1;
+    }
+
+    // Las activaciones de todos los ticks pendientes se registran antes de ejecutar, asi una tarea atrasada se
+    // cuenta como activacion perdida en lugar de ejecutarse varias veces seguidas
+    for (; elapsed > 0; elapsed--) {
+        ReleaseTasks(self);
+        self->processed++;
+    }
+
+    for (uint8_t index = 0; index < self->count; index++) {
+        if (self->state[index].ready) {
+            self->state[index].ready = false;
+            RunTask(self, index);
+        }
+    }
+    return true;
+}
+
+bool SchedulerGetStats(scheduler_t self, uint8_t index, scheduler_stats_t * stats) {
+    if ((self == NULL) || (stats == NULL) || (index >= self->count)) {
+        return false;
+    }
+    *stats = self->stats[index];
+    return true;
+}
+
+uint16_t SchedulerGetMissedTicks(scheduler_t self) {
+    return (self != NULL) ? self->missed : 0;
+}
+
+bool SchedulerIsSchedulable(scheduler_t self) {
+    if (self == NULL) {
+        return false;
+    }
+
+    bool result = (self->missed == 0);
+    for (uint8_t index = 0; index < self->count; index++) {
+        result = result && (self->stats[index].overruns == 0) && (self->stats[index].skipped == 0);
+    }
+    return result;
+}
+
+/* === End of documentation ======================================================================================== */
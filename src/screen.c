@@ -25,24 +25,47 @@ SPDX-License-Identifier: MIT
 #include <stdlib.h>
 #include <string.h>
 #include "screen.h"
-#include "poncho.h"
-#include "bsp.h"
 /* === Macros definitions ========================================================================================== */
 #ifndef SCREEN_MAX_DIGITS
 #define SCREEN_MAX_DIGITS 8
 #endif
 
+// Con la configuracion fija los valores son constantes y el compilador resuelve las divisiones y los modulos, y las
+// funciones del controlador se llaman en forma directa en lugar de hacerlo a traves de punteros
+#ifdef SCREEN_STATIC_CONFIG
+#if SCREEN_STATIC_DIGITS < 1 || SCREEN_STATIC_DIGITS > SCREEN_MAX_DIGITS
+#error "SCREEN_STATIC_DIGITS debe estar entre 1 y SCREEN_MAX_DIGITS"
+#endif
+#define DIGITS(screen)                 SCREEN_STATIC_DIGITS
+#define FLASHING_FREQUENCY(screen)     (2 * SCREEN_STATIC_FLASH_DIVISOR)
+#define FLASHING(screen)               ((screen)->flashing)
+#define DIGITS_TURN_OFF(screen)        ScreenDigitsTurnOff()
+#define SEGMENTS_UPDATE(screen, value) ScreenSegmentsUpdate(value)
+#define DIGIT_TURN_ON(screen, digit)   ScreenDigitTurnOn(digit)
+#else
+#define DIGITS(screen)                 ((screen)->digits)
+#define FLASHING_FREQUENCY(screen)     ((screen)->flashing_frequency)
+#define FLASHING(screen)               ((screen)->flashing_frequency != 0)
+#define DIGITS_TURN_OFF(screen)        (screen)->driver->DigitsTurnOff()
+#define SEGMENTS_UPDATE(screen, value) (screen)->driver->SegmentsUpdate(value)
+#define DIGIT_TURN_ON(screen, digit)   (screen)->driver->DigitTurnOn(digit)
+#endif
+
 /* === Private data type declarations ============================================================================== */
 
 struct screen_s {
-    uint8_t digits;
     uint8_t dots; // Nuevo: número de puntos
     uint8_t currentDigit;
     uint8_t flashing_from;
     uint8_t flashing_to;
     uint8_t flashing_count;
+#ifdef SCREEN_STATIC_CONFIG
+    bool flashing; // Indica si hay digitos parpadeando, la frecuencia es fija
+#else
+    uint8_t digits;
     uint16_t flashing_frequency;
     screen_driver_t driver;
+#endif
     uint8_t value[SCREEN_MAX_DIGITS];
     uint8_t value_dot[SCREEN_MAX_DIGITS]; // Nuevo: estado de los puntos
 };
@@ -70,34 +93,44 @@ static const uint8_t IMAGES[10] = {
 /* === Public function implementation ============================================================================== */
 
 screen_t ScreenCreate(uint8_t digits, uint8_t dots, screen_driver_t driver) {
+#ifdef SCREEN_STATIC_CONFIG
+    (void)driver;
+    if (digits != SCREEN_STATIC_DIGITS) {
+        return NULL;
+    }
+#endif
     screen_t screen = malloc(sizeof(struct screen_s));
     if (digits > SCREEN_MAX_DIGITS) {
         digits = SCREEN_MAX_DIGITS;
     }
     if (screen != NULL) {
-        screen->digits = digits;
         screen->dots = dots;
-        screen->driver = driver;
         screen->currentDigit = 0;
         screen->flashing_count = 0;
+#ifdef SCREEN_STATIC_CONFIG
+        screen->flashing = false;
+#else
+        screen->digits = digits;
+        screen->driver = driver;
         screen->flashing_frequency = 0;
+#endif
     }
 
     return screen;
 }
 
-void ScreenWriteBCD(screen_t screen, uint8_t * value, uint8_t size) {
+void ScreenWriteBCD(screen_t screen, const uint8_t * value, uint8_t size) {
     memset(screen->value, 0, sizeof(screen->value));
 
-    if (size > screen->digits) {
-        size = screen->digits;
+    if (size > DIGITS(screen)) {
+        size = DIGITS(screen);
     }
     for (uint8_t i = 0; i < size; i++) {
         screen->value[i] = IMAGES[value[i]];
     }
 }
 
-void ScreenWriteDOT(screen_t screen, uint8_t * value_dot, uint8_t size) {
+void ScreenWriteDOT(screen_t screen, const uint8_t * value_dot, uint8_t size) {
     memset(screen->value_dot, 0, sizeof(screen->value_dot));
 
     if (size > screen->dots) {
@@ -113,17 +146,17 @@ void ScreenWriteDOT(screen_t screen, uint8_t * value_dot, uint8_t size) {
 void ScreenRefresh(screen_t screen) {
     uint8_t segments;
 
-    screen->driver->DigitsTurnOff();
-    screen->currentDigit = (screen->currentDigit + 1) % screen->digits;
+    DIGITS_TURN_OFF(screen);
+    screen->currentDigit = (screen->currentDigit + 1) % DIGITS(screen);
 
     // segments = screen->value[screen->currentDigit];
     segments = screen->value[screen->currentDigit] | screen->value_dot[screen->currentDigit];
 
-    if (screen->flashing_frequency != 0) {
+    if (FLASHING(screen)) {
         if (screen->currentDigit == 0) {
-            screen->flashing_count = (screen->flashing_count + 1) % (screen->flashing_frequency);
+            screen->flashing_count = (screen->flashing_count + 1) % FLASHING_FREQUENCY(screen);
         }
-        if (screen->flashing_count < (screen->flashing_frequency / 2)) {
+        if (screen->flashing_count < (FLASHING_FREQUENCY(screen) / 2)) {
             if (screen->currentDigit >= screen->flashing_from) {
                 if (screen->currentDigit <= screen->flashing_to) {
                     segments = 0; // Flashing off
@@ -131,8 +164,8 @@ void ScreenRefresh(screen_t screen) {
             }
         }
     }
-    screen->driver->SegmentsUpdate(segments);
-    screen->driver->DigitTurnOn(screen->currentDigit);
+    SEGMENTS_UPDATE(screen, segments);
+    DIGIT_TURN_ON(screen, screen->currentDigit);
 }
 
 int DisplayFlashDigits(screen_t screen, uint8_t from, uint8_t to, uint16_t divisor) {
@@ -141,11 +174,21 @@ int DisplayFlashDigits(screen_t screen, uint8_t from, uint8_t to, uint16_t divis
         result = -1;
     } else if (!screen) {
         result = -1;
+#ifdef SCREEN_STATIC_CONFIG
+    } else if ((divisor != 0) && (divisor != SCREEN_STATIC_FLASH_DIVISOR)) {
+        result = -1;
+    } else {
+        screen->flashing_from = from;
+        screen->flashing_to = to;
+        screen->flashing = (divisor != 0);
+        screen->flashing_count = 0;
+#else
     } else {
         screen->flashing_from = from;
         screen->flashing_to = to;
         screen->flashing_frequency = 2 * divisor;
         screen->flashing_count = 0;
+#endif
     }
     return result;
 }
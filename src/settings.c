@@ -0,0 +1,250 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file settings.c
+ ** @brief Almacenamiento no volatil de la configuracion del reloj despertador
+ **
+ ** Cada registro ocupa SETTINGS_RECORD_SIZE bytes en formato little endian: el numero de secuencia en los bytes 0 a
+ ** 3, la hora de la alarma en BCD empaquetado en los bytes 4 a 6, las banderas en el byte 7, el brillo en el byte 8,
+ ** la calibracion en los bytes 9 y 10, la version del formato en el byte 11 y el CRC-32 de los bytes anteriores en
+ ** los bytes 12 a 15. El registro con numero de secuencia n se escribe siempre en la posicion n modulo la cantidad de
+ ** posiciones de la region.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "settings.h"
+#include "hal_eeprom.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#define SETTINGS_FORMAT      1          // Version del formato de los registros
+#define SETTINGS_FLAG_ALARM  0x01       // Bandera de la alarma habilitada
+#define SETTINGS_CRC_SIZE    12         // Bytes del registro cubiertos por el CRC
+#define SETTINGS_NO_LAP      UINT32_MAX // Vuelta de una posicion sin un registro valido
+#define SETTINGS_POLYNOMIAL  0xEDB88320 // Polinomio reflejado del CRC-32
+
+/* === Private data type declarations ============================================================================== */
+
+struct settings_store_s {
+    uint32_t offset;     // Posicion del comienzo de la region
+    uint32_t slots;      // Cantidad de registros que entran en la region
+    bool valid;          // Hay una configuracion guardada
+    uint32_t sequence;   // Numero de secuencia del ultimo registro guardado
+    settings_t settings; // Ultima configuracion guardada
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Lee y valida el registro de una posicion de la region.
+ * @param self Puntero al almacen.
+ * @param slot Posicion del registro.
+ * @param sequence Puntero donde se almacenara el numero de secuencia del registro.
+ * @param settings Puntero donde se almacenara la configuracion del registro, puede ser NULL.
+ * @return true si la posicion tiene un registro valido que le corresponde, false en caso contrario.
+ */
+static bool ReadRecord(settings_store_t self, uint32_t slot, uint32_t * sequence, settings_t * settings);
+
+/**
+ * @brief Obtiene la cantidad de vueltas completas a la region que se dieron antes de escribir una posicion.
+ * @param self Puntero al almacen.
+ * @param slot Posicion del registro.
+ * @return Numero de vuelta del registro, o SETTINGS_NO_LAP si la posicion no tiene un registro valido.
+ */
+static uint32_t ReadLap(settings_store_t self, uint32_t slot);
+
+/**
+ * @brief Busca el ultimo registro guardado en la region.
+ * @param self Puntero al almacen.
+ */
+static void Recover(settings_store_t self);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+static uint32_t Crc32(const uint8_t * data, uint32_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (uint32_t index = 0; index < size; index++) {
+        crc ^= data[index];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (SETTINGS_POLYNOMIAL & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void PutWord(uint8_t * data, uint32_t value) {
+    for (int index = 0; index < 4; index++) {
+        data[index] = value >> (8 * index);
+    }
+}
+
+static uint32_t GetWord(const uint8_t * data) {
+    return data[0] | (data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static bool IsValidAlarm(const clock_time_t * alarm) {
+    uint8_t seconds = alarm->time.seconds[1] * 10 + alarm->time.seconds[0];
+    uint8_t minutes = alarm->time.minutes[1] * 10 + alarm->time.minutes[0];
+    uint8_t hours = alarm->time.hours[1] * 10 + alarm->time.hours[0];
+
+    for (int index = 0; index < 6; index++) {
+        if (alarm->bcd[index] > 9) {
+            return false;
+        }
+    }
+    return (seconds < 60) && (minutes < 60) && (hours < 24);
+}
+
+static void Encode(uint8_t * record, uint32_t sequence, const settings_t * settings) {
+    PutWord(&record[0], sequence);
+    record[4] = (settings->alarm.time.hours[1] << 4) | settings->alarm.time.hours[0];
+    record[5] = (settings->alarm.time.minutes[1] << 4) | settings->alarm.time.minutes[0];
+    record[6] = (settings->alarm.time.seconds[1] << 4) | settings->alarm.time.seconds[0];
+    record[7] = settings->alarm_enabled ? SETTINGS_FLAG_ALARM : 0;
+    record[8] = settings->brightness;
+    record[9] = (uint16_t)settings->calibration;
+    record[10] = (uint16_t)settings->calibration >> 8;
+    record[11] = SETTINGS_FORMAT;
+    PutWord(&record[SETTINGS_CRC_SIZE], Crc32(record, SETTINGS_CRC_SIZE));
+}
+
+static void Decode(const uint8_t * record, settings_t * settings) {
+    settings->alarm.time.hours[1] = record[4] >> 4;
+    settings->alarm.time.hours[0] = record[4] & 0x0F;
+    settings->alarm.time.minutes[1] = record[5] >> 4;
+    settings->alarm.time.minutes[0] = record[5] & 0x0F;
+    settings->alarm.time.seconds[1] = record[6] >> 4;
+    settings->alarm.time.seconds[0] = record[6] & 0x0F;
+    settings->alarm_enabled = (record[7] & SETTINGS_FLAG_ALARM) != 0;
+    settings->brightness = record[8];
+    settings->calibration = (int16_t)(record[9] | (record[10] << 8));
+}
+
+static bool ReadRecord(settings_store_t self, uint32_t slot, uint32_t * sequence, settings_t * settings) {
+    uint8_t record[SETTINGS_RECORD_SIZE];
+
+    if (!EepromRead(self->offset + slot * SETTINGS_RECORD_SIZE, record, sizeof(record))) {
+        return false;
+    }
+    if ((GetWord(&record[SETTINGS_CRC_SIZE]) != Crc32(record, SETTINGS_CRC_SIZE)) || (record[11] != SETTINGS_FORMAT)) {
+        return false;
+    }
+    // Un registro valido que no corresponde a la posicion es de una region con otra geometria
+    *sequence = GetWord(&record[0]);
+    if (*sequence % self->slots != slot) {
+        return false;
+    }
+    if (settings != NULL) {
+        Decode(record, settings);
+    }
+    return true;
+}
+
+static uint32_t ReadLap(settings_store_t self, uint32_t slot) {
+    uint32_t sequence;
+
+    return ReadRecord(self, slot, &sequence, NULL) ? sequence / self->slots : SETTINGS_NO_LAP;
+}
+
+static void Recover(settings_store_t self) {
+    uint32_t first = ReadLap(self, 0);
+    uint32_t low = 0;
+    uint32_t high = self->slots;
+
+    // Las posiciones escritas en la vuelta actual forman un prefijo de la region, las siguientes son de la vuelta
+    // anterior, estan vacias o son el registro interrumpido por un corte, asi que el borde se busca por biseccion
+    while (high - low > 1) {
+        uint32_t middle = low + (high - low) / 2;
+        if (ReadLap(self, middle) == first) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    self->valid = ReadRecord(self, low, &self->sequence, &self->settings);
+    if (!self->valid) {
+        // La primera posicion solo es invalida si el corte fue al comenzar una vuelta, o si la region esta vacia
+        self->valid = ReadRecord(self, self->slots - 1, &self->sequence, &self->settings);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+settings_store_t SettingsStoreCreate(uint32_t offset, uint32_t size) {
+    if ((offset % SETTINGS_RECORD_SIZE != 0) || (size / SETTINGS_RECORD_SIZE < 2) ||
+        (offset > EepromGetSize()) || (size > EepromGetSize() - offset) || EepromIsBusy()) {
+        return NULL;
+    }
+
+    settings_store_t self = malloc(sizeof(struct settings_store_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct settings_store_s));
+        self->offset = offset;
+        self->slots = size / SETTINGS_RECORD_SIZE;
+        Recover(self);
+    }
+    return self;
+}
+
+bool SettingsLoad(settings_store_t self, settings_t * settings) {
+    if ((self == NULL) || (settings == NULL) || !self->valid) {
+        return false;
+    }
+    *settings = self->settings;
+    return true;
+}
+
+bool SettingsSave(settings_store_t self, const settings_t * settings) {
+    uint8_t record[SETTINGS_RECORD_SIZE];
+
+    if ((self == NULL) || (settings == NULL) || !IsValidAlarm(&settings->alarm)) {
+        return false;
+    }
+    if (self->valid && (memcmp(&self->settings.alarm, &settings->alarm, sizeof(clock_time_t)) == 0) &&
+        (self->settings.alarm_enabled == settings->alarm_enabled) &&
+        (self->settings.brightness == settings->brightness) &&
+        (self->settings.calibration == settings->calibration)) {
+        return true;
+    }
+
+    uint32_t sequence = self->valid ? self->sequence + 1 : 0;
+    uint32_t slot = sequence % self->slots;
+    Encode(record, sequence, settings);
+    if (!EepromWrite(self->offset + slot * SETTINGS_RECORD_SIZE, record, sizeof(record))) {
+        return false;
+    }
+    self->valid = true;
+    self->sequence = sequence;
+    self->settings = *settings;
+    return true;
+}
+
+/* === End of documentation ======================================================================================== */
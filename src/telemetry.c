@@ -0,0 +1,179 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file telemetry.c
+ ** @brief Registro binario de eventos del reloj para su envio por el puerto serie
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "telemetry.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#if (TELEMETRY_BUFFER_SIZE & (TELEMETRY_BUFFER_SIZE - 1)) != 0 || TELEMETRY_BUFFER_SIZE > 32768 ||                    \
+    TELEMETRY_BUFFER_SIZE < 4 * TELEMETRY_RECORD_MAX
+#error "TELEMETRY_BUFFER_SIZE debe ser una potencia de dos entre 64 y 32768"
+#endif
+
+//! Mascara para convertir un contador libre en una posicion del buffer
+#define TELEMETRY_MASK (TELEMETRY_BUFFER_SIZE - 1)
+
+//! Bit que indica que un entero codificado en base 128 continua en el byte siguiente
+#define TELEMETRY_VARINT_MORE 0x80
+
+/* === Private data type declarations ============================================================================== */
+
+// Los indices son contadores libres de bytes: solo TelemetryLog escribe head y solo TelemetryDrain escribe tail
+struct telemetry_s {
+    uint8_t buffer[TELEMETRY_BUFFER_SIZE];
+    uint16_t head;           // Cantidad de bytes agregados
+    uint16_t tail;           // Cantidad de bytes enviados
+    uint32_t last;           // Tiempo del ultimo registro agregado
+    uint32_t lost;           // Registros descartados desde la creacion
+    uint32_t unreported;     // Registros descartados que todavia no se informaron con un registro TELEMETRY_LOST
+    telemetry_clock_t clock; // Funcion que devuelve el tiempo actual
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Codifica un entero sin signo en base 128 a partir de una posicion del buffer.
+ * @param self Puntero al registro de eventos.
+ * @param head Contador libre de la posicion donde comienza el entero.
+ * @param value Valor que se desea codificar.
+ * @return Contador libre de la posicion siguiente al ultimo byte escrito.
+ */
+static uint16_t PutVarint(telemetry_t self, uint16_t head, uint32_t value);
+
+/**
+ * @brief Codifica un registro si el buffer tiene lugar para un registro de longitud maxima mas una reserva.
+ * @param self Puntero al registro de eventos.
+ * @param type Tipo del registro.
+ * @param value Valor del registro.
+ * @param now Tiempo actual, en milisegundos.
+ * @param reserve Bytes que deben quedar libres despues del registro.
+ * @return true si el registro se agrego, false si no habia lugar.
+ */
+static bool Append(telemetry_t self, uint8_t type, uint32_t value, uint32_t now, uint16_t reserve);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Private function implementation ============================================================================= */
+
+static uint16_t PutVarint(telemetry_t self, uint16_t head, uint32_t value) {
+    while (value >= TELEMETRY_VARINT_MORE) {
+        self->buffer[head & TELEMETRY_MASK] = (uint8_t)value | TELEMETRY_VARINT_MORE;
+        value = value >> 7;
+        head++;
+    }
+    self->buffer[head & TELEMETRY_MASK] = (uint8_t)value;
+    return head + 1;
+}
+
+static bool Append(telemetry_t self, uint8_t type, uint32_t value, uint32_t now, uint16_t reserve) {
+    uint16_t head = self->head;
+
+    // Se verifica el lugar para la longitud maxima, asi la codificacion no necesita controlar cada byte
+    if ((uint16_t)(head - self->tail) > TELEMETRY_BUFFER_SIZE - TELEMETRY_RECORD_MAX - reserve) {
+        return false;
+    }
+    self->buffer[head & TELEMETRY_MASK] = type;
+    head = PutVarint(self, head + 1, now - self->last);
+    head = PutVarint(self, head, value);
+    self->head = head;
+    self->last = now;
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+telemetry_t TelemetryCreate(telemetry_clock_t clock) {
+    if (clock == NULL) {
+        return NULL;
+    }
+
+    telemetry_t self = malloc(sizeof(struct telemetry_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct telemetry_s));
+        self->clock = clock;
+        self->last = clock();
+        Append(self, TELEMETRY_START, TELEMETRY_VERSION, self->last, 0);
+    }
+    return self;
+}
+
+bool TelemetryLog(telemetry_t self, telemetry_type_t type, uint32_t value) {
+    if ((self == NULL) || (type >= TELEMETRY_TYPES)) {
+        return false;
+    }
+
+    uint32_t now = self->clock();
+    // El aviso de los descartados solo se agrega si tambien entra el registro actual, sino se repetiria en cada intento
+    if (self->unreported != 0) {
+        if (Append(self, TELEMETRY_LOST, self->unreported, now, TELEMETRY_RECORD_MAX)) {
+            self->unreported = 0;
+        }
+    }
+    if ((self->unreported != 0) || !Append(self, type, value, now, 0)) {
+        self->lost++;
+        self->unreported++;
+        return false;
+    }
+    return true;
+}
+
+uint16_t TelemetryDrain(telemetry_t self, telemetry_writer_t writer) {
+    if ((self == NULL) || (writer == NULL)) {
+        return 0;
+    }
+
+    uint16_t tail = self->tail;
+    uint16_t sent = 0;
+    // Los bytes pendientes ocupan como maximo dos bloques contiguos, antes y despues del final del buffer
+    while (tail != self->head) {
+        uint16_t offset = tail & TELEMETRY_MASK;
+        uint16_t size = self->head - tail;
+        if (size > TELEMETRY_BUFFER_SIZE - offset) {
+            size = TELEMETRY_BUFFER_SIZE - offset;
+        }
+
+        uint16_t accepted = writer(&self->buffer[offset], size);
+        tail += accepted;
+        sent += accepted;
+        if (accepted < size) {
+            break;
+        }
+    }
+    self->tail = tail;
+    return sent;
+}
+
+uint32_t TelemetryGetLost(telemetry_t self) {
+    return (self != NULL) ? self->lost : 0;
+}
+
+/* === End of documentation ======================================================================================== */
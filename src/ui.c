@@ -0,0 +1,414 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file ui.c
+ ** @brief Maquina de estados de la interfaz de usuario del reloj despertador
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "ui.h"
+#include "bcd.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+//! Destino de una transicion que no cambia el modo actual
+#define UI_STATE_SAME MODE_COUNT
+
+//! Destino de una transicion que vuelve al ultimo modo de reposo
+#define UI_STATE_PREVIOUS (MODE_COUNT + 1)
+
+//! Celda de la tabla sin accion que no cambia el modo
+#define IGNORE {NULL, UI_STATE_SAME}
+
+//! Celda de la tabla que ejecuta una accion sin cambiar el modo
+#define STAY(action) {action, UI_STATE_SAME}
+
+//! Celda de la tabla que ejecuta una accion opcional y cambia al modo indicado si la accion tuvo exito
+#define GOTO(action, next) {action, next}
+
+//! Celda de la tabla que ejecuta una accion opcional y vuelve al ultimo modo de reposo si la accion tuvo exito
+#define BACK(action) {action, UI_STATE_PREVIOUS}
+
+//! Punto que indica que la alarma esta habilitada mientras se edita
+#define DOT_ALARM_ENABLED 0
+
+//! Punto que indica que la alarma esta sonando
+#define DOT_ALARM_TRIGGERED 3
+
+/* === Private data type declarations ============================================================================== */
+
+/**
+ * @brief Accion asociada a una transicion o a la entrada y salida de un modo.
+ * @param self Puntero a la interfaz.
+ * @return true si la transicion debe completarse, false para permanecer en el modo actual.
+ */
+typedef bool (*ui_action_t)(ui_t self);
+
+//! Celda de la tabla de transiciones
+struct ui_transition_s {
+    ui_action_t action; // Accion a ejecutar, NULL si no hay ninguna
+    uint8_t next;       // Modo siguiente, UI_STATE_SAME o UI_STATE_PREVIOUS
+};
+
+//! Descripcion de un modo de la interfaz
+struct ui_state_s {
+    ui_action_t entry; // Accion al entrar al modo, NULL si no hay ninguna
+    ui_action_t exit;  // Accion al salir del modo, NULL si no hay ninguna
+    bool resting;      // Los modos de reposo son el destino de UI_STATE_PREVIOUS
+};
+
+struct ui_s {
+    clock_t clock;
+    ui_driver_t driver;
+    uint8_t mode;     // Modo actual
+    uint8_t previous; // Ultimo modo de reposo del que se salio
+    uint8_t digits[UI_DIGITS];
+    uint8_t dots[UI_DIGITS];
+};
+
+/* === Private variable declarations =============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+//! Copia las horas y minutos de una hora del reloj a los digitos
+static void TimeToDigits(uint8_t * digits, const clock_time_t * time);
+
+//! Copia los digitos a las horas y minutos de una hora del reloj con los segundos en cero
+static void DigitsToTime(const uint8_t * digits, clock_time_t * time);
+
+//! Incrementa o decrementa en forma circular el valor de dos digitos consecutivos
+static void AdjustDigits(uint8_t * digits, uint8_t limit, int8_t delta);
+
+static bool ShowTime(ui_t self);
+static bool CheckTimeValid(ui_t self);
+static bool CheckAlarm(ui_t self);
+static bool EnableAlarm(ui_t self);
+static bool DisableAlarm(ui_t self);
+static bool LoadAlarm(ui_t self);
+static bool ClearAlarmDot(ui_t self);
+static bool IncrementMinutes(ui_t self);
+static bool DecrementMinutes(ui_t self);
+static bool IncrementHours(ui_t self);
+static bool DecrementHours(ui_t self);
+static bool CommitTime(ui_t self);
+static bool CommitAlarm(ui_t self);
+static bool SnoozeAlarm(ui_t self);
+static bool CancelAlarm(ui_t self);
+
+static bool EnterUnset(ui_t self);
+static bool EnterHome(ui_t self);
+static bool EnterEditMinutes(ui_t self);
+static bool EnterEditHours(ui_t self);
+static bool EnterAlarmTriggered(ui_t self);
+static bool ExitAlarmTriggered(ui_t self);
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private variable definitions ================================================================================ */
+
+//! Comportamiento de cada modo al entrar y salir
+static const struct ui_state_s states[MODE_COUNT] = {
+    [MODE_UNSET] = {.entry = EnterUnset, .resting = true},
+    [MODE_HOME] = {.entry = EnterHome, .resting = true},
+    [MODE_SET_TIME_MINUTES] = {.entry = EnterEditMinutes},
+    [MODE_SET_TIME_HOURS] = {.entry = EnterEditHours},
+    [MODE_SET_ALARM_MINUTES] = {.entry = EnterEditMinutes},
+    [MODE_SET_ALARM_HOURS] = {.entry = EnterEditHours},
+    [MODE_ALARM_TRIGGERED] = {.entry = EnterAlarmTriggered, .exit = ExitAlarmTriggered},
+};
+
+// clang-format off
+// Cada fila completa todas las columnas en el orden de ui_event_t para que ninguna celda quede en cero
+static const struct ui_transition_s transitions[MODE_COUNT][EVENT_COUNT] = {
+    //  SET_TIME                            SET_ALARM                                DECREMENT
+    //  INCREMENT                           ACCEPT                                   CANCEL
+    //  CLOCK_SECOND
+    [MODE_UNSET] = {
+        GOTO(NULL, MODE_SET_TIME_MINUTES),  GOTO(LoadAlarm, MODE_SET_ALARM_MINUTES), IGNORE,
+        IGNORE,                             IGNORE,                                  IGNORE,
+        GOTO(CheckTimeValid, MODE_HOME),
+    },
+    [MODE_HOME] = {
+        GOTO(NULL, MODE_SET_TIME_MINUTES),  GOTO(LoadAlarm, MODE_SET_ALARM_MINUTES), IGNORE,
+        IGNORE,                             STAY(EnableAlarm),                       STAY(DisableAlarm),
+        GOTO(CheckAlarm, MODE_ALARM_TRIGGERED),
+    },
+    [MODE_SET_TIME_MINUTES] = {
+        IGNORE,                             IGNORE,                                  STAY(DecrementMinutes),
+        STAY(IncrementMinutes),             GOTO(NULL, MODE_SET_TIME_HOURS),         BACK(NULL),
+        IGNORE,
+    },
+    [MODE_SET_TIME_HOURS] = {
+        IGNORE,                             IGNORE,                                  STAY(DecrementHours),
+        STAY(IncrementHours),               GOTO(CommitTime, MODE_HOME),             BACK(NULL),
+        IGNORE,
+    },
+    [MODE_SET_ALARM_MINUTES] = {
+        IGNORE,                             IGNORE,                                  STAY(DecrementMinutes),
+        STAY(IncrementMinutes),             GOTO(NULL, MODE_SET_ALARM_HOURS),        BACK(ClearAlarmDot),
+        IGNORE,
+    },
+    [MODE_SET_ALARM_HOURS] = {
+        IGNORE,                             IGNORE,                                  STAY(DecrementHours),
+        STAY(IncrementHours),               BACK(CommitAlarm),                       BACK(ClearAlarmDot),
+        IGNORE,
+    },
+    [MODE_ALARM_TRIGGERED] = {
+        IGNORE,                             IGNORE,                                  IGNORE,
+        IGNORE,                             GOTO(SnoozeAlarm, MODE_HOME),            GOTO(CancelAlarm, MODE_HOME),
+        STAY(ShowTime),
+    },
+};
+// clang-format on
+
+/* === Private function implementation ============================================================================= */
+
+static void TimeToDigits(uint8_t * digits, const clock_time_t * time) {
+    digits[0] = time->bcd[5]; // horas decenas
+    digits[1] = time->bcd[4]; // horas unidades
+    digits[2] = time->bcd[3]; // minutos decenas
+    digits[3] = time->bcd[2]; // minutos unidades
+}
+
+static void DigitsToTime(const uint8_t * digits, clock_time_t * time) {
+    time->bcd[5] = digits[0]; // horas decenas
+    time->bcd[4] = digits[1]; // horas unidades
+    time->bcd[3] = digits[2]; // minutos decenas
+    time->bcd[2] = digits[3]; // minutos unidades
+    time->bcd[1] = 0;         // segundos decenas
+    time->bcd[0] = 0;         // segundos unidades
+}
+
+static void AdjustDigits(uint8_t * digits, uint8_t limit, int8_t delta) {
+    uint8_t field = BCD_PACK(digits[0], digits[1]); // Combina los dígitos
+
+    // Ajusta y da la vuelta en los extremos sin dividir
+    if (delta < 0) {
+        BcdSubtractWrap(&field, (uint16_t)-delta, limit);
+    } else {
+        BcdAddWrap(&field, (uint16_t)delta, limit);
+    }
+    digits[0] = BCD_TENS(field);  // Decenas
+    digits[1] = BCD_UNITS(field); // Y unidades
+}
+
+static bool ShowTime(ui_t self) {
+    clock_time_t current_time;
+
+    if (ClockGetTime(self->clock, &current_time)) {
+        TimeToDigits(self->digits, &current_time);
+    }
+    return true;
+}
+
+static bool CheckTimeValid(ui_t self) {
+    clock_time_t current_time;
+
+    // La hora se puede ajustar sin pasar por la interfaz, por ejemplo con un comando por el puerto serie
+    return ClockGetTime(self->clock, &current_time);
+}
+
+static bool CheckAlarm(ui_t self) {
+    ShowTime(self);
+    return ClockIsAlarmTriggered(self->clock);
+}
+
+static bool EnableAlarm(ui_t self) {
+    ClockEnableAlarm(self->clock);
+    return true;
+}
+
+static bool DisableAlarm(ui_t self) {
+    ClockDisableAlarm(self->clock);
+    return true;
+}
+
+static bool LoadAlarm(ui_t self) {
+    clock_time_t alarm_time;
+
+    if (ClockGetAlarmTime(self->clock, &alarm_time)) {
+        TimeToDigits(self->digits, &alarm_time);
+    }
+    self->dots[DOT_ALARM_ENABLED] = ClockIsAlarmEnabled(self->clock);
+    return true;
+}
+
+static bool ClearAlarmDot(ui_t self) {
+    self->dots[DOT_ALARM_ENABLED] = 0;
+    return true;
+}
+
+static bool IncrementMinutes(ui_t self) {
+    AdjustDigits(&self->digits[2], BCD_MINUTES, 1);
+    return true;
+}
+
+static bool DecrementMinutes(ui_t self) {
+    AdjustDigits(&self->digits[2], BCD_MINUTES, -1);
+    return true;
+}
+
+static bool IncrementHours(ui_t self) {
+    AdjustDigits(&self->digits[0], BCD_HOURS, 1);
+    return true;
+}
+
+static bool DecrementHours(ui_t self) {
+    AdjustDigits(&self->digits[0], BCD_HOURS, -1);
+    return true;
+}
+
+static bool CommitTime(ui_t self) {
+    clock_time_t new_time;
+
+    DigitsToTime(self->digits, &new_time);
+    return ClockSetTime(self->clock, &new_time);
+}
+
+static bool CommitAlarm(ui_t self) {
+    clock_time_t alarm_time;
+
+    DigitsToTime(self->digits, &alarm_time);
+    if (!ClockSetAlarmTime(self->clock, &alarm_time)) {
+        return false;
+    }
+    ClockEnableAlarm(self->clock);
+    return ClearAlarmDot(self);
+}
+
+static bool SnoozeAlarm(ui_t self) {
+    return ClockSnoozeAlarm(self->clock, UI_SNOOZE_MINUTES);
+}
+
+static bool CancelAlarm(ui_t self) {
+    return ClockCancelAlarmUntilNextDay(self->clock);
+}
+
+static bool EnterUnset(ui_t self) {
+    self->driver->FlashDigits(0, UI_DIGITS - 1, 100);
+    return true;
+}
+
+static bool EnterHome(ui_t self) {
+    self->driver->FlashDigits(0, 0, 0);
+    return ShowTime(self);
+}
+
+static bool EnterEditMinutes(ui_t self) {
+    self->driver->FlashDigits(2, 3, 100);
+    return true;
+}
+
+static bool EnterEditHours(ui_t self) {
+    self->driver->FlashDigits(0, 1, 100);
+    return true;
+}
+
+static bool EnterAlarmTriggered(ui_t self) {
+    self->dots[DOT_ALARM_TRIGGERED] = 1;
+    self->driver->AlarmIndicator(true);
+    return true;
+}
+
+static bool ExitAlarmTriggered(ui_t self) {
+    self->dots[DOT_ALARM_TRIGGERED] = 0;
+    self->driver->AlarmIndicator(false);
+    return true;
+}
+
+/* === Public function implementation ============================================================================== */
+
+ui_t UiCreate(clock_t clock, ui_driver_t driver) {
+    if (clock == NULL || driver == NULL || driver->FlashDigits == NULL || driver->AlarmIndicator == NULL) {
+        return NULL;
+    }
+
+    ui_t self = malloc(sizeof(struct ui_s));
+    if (self != NULL) {
+        memset(self, 0, sizeof(struct ui_s));
+        self->clock = clock;
+        self->driver = driver;
+        self->mode = MODE_UNSET;
+        self->previous = MODE_UNSET;
+        self->dots[1] = 1; // Separador entre horas y minutos
+        if (ClockGetTime(clock, &(clock_time_t){0})) {
+            self->mode = MODE_HOME;
+            self->previous = MODE_HOME;
+            EnterHome(self);
+        } else {
+            EnterUnset(self);
+        }
+    }
+    return self;
+}
+
+void UiProcessEvent(ui_t self, ui_event_t event) {
+    if (self == NULL || event >= EVENT_COUNT) {
+        return;
+    }
+
+    const struct ui_transition_s * transition = &transitions[self->mode][event];
+    if (transition->action != NULL && !transition->action(self)) {
+        return;
+    }
+
+    uint8_t next = transition->next;
+    if (next == UI_STATE_SAME) {
+        return;
+    } else if (next == UI_STATE_PREVIOUS) {
+        next = self->previous;
+    }
+
+    const struct ui_state_s * current = &states[self->mode];
+    if (current->exit != NULL) {
+        current->exit(self);
+    }
+    if (current->resting) {
+        self->previous = self->mode;
+    }
+    self->mode = next;
+    if (states[next].entry != NULL) {
+        states[next].entry(self);
+    }
+}
+
+system_mode_t UiGetMode(ui_t self) {
+    if (self == NULL) {
+        return MODE_COUNT;
+    }
+    return (system_mode_t)self->mode;
+}
+
+const uint8_t * UiGetDigits(ui_t self) {
+    if (self == NULL) {
+        return NULL;
+    }
+    return self->digits;
+}
+
+const uint8_t * UiGetDots(ui_t self) {
+    if (self == NULL) {
+        return NULL;
+    }
+    return self->dots;
+}
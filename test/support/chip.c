@@ -0,0 +1,143 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.c
+ ** @brief Sustituto de la biblioteca lpc_open para ejecutar las pruebas del HAL lpc43xx en el host
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include "chip.h"
+#include <string.h>
+
+/* === Public variable definitions ================================================================================= */
+
+LPC_PIN_INT_T fake_pin_int;
+LPC_GPIO_T fake_gpio_port;
+fake_nvic_t fake_nvic;
+uint8_t fake_pintsel[8];
+uint32_t fake_rise_reads;
+
+/* === Public function implementation ============================================================================== */
+
+void FakeChipReset(void) {
+    memset(&fake_pin_int, 0, sizeof(fake_pin_int));
+    memset(&fake_gpio_port, 0, sizeof(fake_gpio_port));
+    memset(&fake_nvic, 0, sizeof(fake_nvic));
+    memset(fake_pintsel, 0, sizeof(fake_pintsel));
+    fake_rise_reads = 0;
+}
+
+void FakePinIntTrigger(uint8_t channel, bool rising) {
+    uint32_t mask = 1 << channel;
+
+    if (rising) {
+        fake_pin_int.RISE |= mask;
+    } else {
+        fake_pin_int.FALL |= mask;
+    }
+    if ((rising && (fake_pin_int.IENR & mask)) || (!rising && (fake_pin_int.IENF & mask))) {
+        fake_pin_int.IST |= mask;
+        fake_nvic.pending[PIN_INT0_IRQn + channel] = true;
+    }
+}
+
+void Chip_SCU_PinMux(uint8_t port, uint8_t pin, uint16_t mode, uint8_t func) {
+    (void)port;
+    (void)pin;
+    (void)mode;
+    (void)func;
+}
+
+void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum) {
+    fake_pintsel[PortSel] = (PortNum << 5) | PinNum;
+}
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool output) {
+    if (output) {
+        pGPIO->DIR[port] |= (1UL << pin);
+    } else {
+        pGPIO->DIR[port] &= ~(1UL << pin);
+    }
+}
+
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * pGPIO, uint32_t port, uint8_t pin) {
+    return (pGPIO->PIN[port] >> pin) & 1;
+}
+
+void Chip_GPIO_SetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool setting) {
+    if (setting) {
+        pGPIO->PIN[port] |= (1UL << pin);
+    } else {
+        pGPIO->PIN[port] &= ~(1UL << pin);
+    }
+}
+
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin) {
+    pGPIO->PIN[port] ^= (1UL << pin);
+}
+
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->ISEL &= ~pins;
+}
+
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IENR |= pins;
+}
+
+void Chip_PININT_DisableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IENR &= ~pins;
+}
+
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IENF |= pins;
+}
+
+void Chip_PININT_DisableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    pPININT->IENF &= ~pins;
+}
+
+uint32_t Chip_PININT_GetRiseStates(LPC_PIN_INT_T * pPININT) {
+    fake_rise_reads++;
+    return pPININT->RISE;
+}
+
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins) {
+    /* En modo flanco escribir IST borra tambien los flancos detectados */
+    pPININT->IST &= ~pins;
+    pPININT->RISE &= ~pins;
+    pPININT->FALL &= ~pins;
+}
+
+void NVIC_EnableIRQ(IRQn_Type IRQn) {
+    fake_nvic.enabled[IRQn] = true;
+}
+
+void NVIC_DisableIRQ(IRQn_Type IRQn) {
+    fake_nvic.enabled[IRQn] = false;
+}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn) {
+    fake_nvic.pending[IRQn] = false;
+}
+
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority) {
+    fake_nvic.priority[IRQn] = priority;
+}
@@ -0,0 +1,135 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file chip.h
+ ** @brief Sustituto de la biblioteca lpc_open para ejecutar las pruebas del HAL lpc43xx en el host
+ **
+ ** Emula los registros del bloque PININT y del NVIC con variables en memoria, para que las pruebas puedan
+ ** verificar la configuracion realizada por el HAL y simular las interrupciones de los terminales.
+ **/
+
+#ifndef CHIP_H_
+#define CHIP_H_
+
+/* === Headers files inclusions ==================================================================================== */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* === Header for C++ compatibility ================================================================================ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* === Public macros definitions =================================================================================== */
+
+#define SCU_MODE_PULLUP    (0x0 << 3)
+#define SCU_MODE_INACT     (0x2 << 3)
+#define SCU_MODE_INBUFF_EN (0x1 << 6)
+#define SCU_MODE_ZIF_DIS   (0x1 << 7)
+
+#define LPC_GPIO_PORT    (&fake_gpio_port)
+#define LPC_GPIO_PIN_INT (&fake_pin_int)
+
+/* === Public data type declarations =============================================================================== */
+
+//! Numeros de interrupcion utilizados por el HAL
+typedef enum {
+    PIN_INT0_IRQn = 32,
+    PIN_INT7_IRQn = 39,
+    FAKE_IRQn_COUNT = 64,
+} IRQn_Type;
+
+//! Registros del bloque de interrupciones de terminales
+typedef struct {
+    uint32_t ISEL;
+    uint32_t IENR;
+    uint32_t SIENR;
+    uint32_t CIENR;
+    uint32_t IENF;
+    uint32_t SIENF;
+    uint32_t CIENF;
+    uint32_t RISE;
+    uint32_t FALL;
+    uint32_t IST;
+} LPC_PIN_INT_T;
+
+//! Registros de los puertos de entrada salida
+typedef struct {
+    uint32_t DIR[8];
+    uint32_t PIN[8];
+} LPC_GPIO_T;
+
+//! Estado emulado del controlador de interrupciones
+typedef struct {
+    bool enabled[FAKE_IRQn_COUNT];
+    bool pending[FAKE_IRQn_COUNT];
+    uint32_t priority[FAKE_IRQn_COUNT];
+} fake_nvic_t;
+
+/* === Public variable declarations ================================================================================ */
+
+extern LPC_PIN_INT_T fake_pin_int;
+extern LPC_GPIO_T fake_gpio_port;
+extern fake_nvic_t fake_nvic;
+
+//! Terminal asignado a cada canal de interrupcion, codificado como (puerto << 5) | bit
+extern uint8_t fake_pintsel[8];
+
+//! Cantidad de lecturas del registro de flancos ascendentes
+extern uint32_t fake_rise_reads;
+
+/* === Public function declarations ================================================================================ */
+
+//! Devuelve todos los registros emulados a su valor de reset
+void FakeChipReset(void);
+
+//! Simula un flanco en el terminal asignado a un canal, tal como lo registraria el hardware
+void FakePinIntTrigger(uint8_t channel, bool rising);
+
+void Chip_SCU_PinMux(uint8_t port, uint8_t pin, uint16_t mode, uint8_t func);
+void Chip_SCU_GPIOIntPinSel(uint8_t PortSel, uint8_t PortNum, uint8_t PinNum);
+
+void Chip_GPIO_SetPinDIR(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool output);
+bool Chip_GPIO_ReadPortBit(LPC_GPIO_T * pGPIO, uint32_t port, uint8_t pin);
+void Chip_GPIO_SetPinState(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin, bool setting);
+void Chip_GPIO_SetPinToggle(LPC_GPIO_T * pGPIO, uint8_t port, uint8_t pin);
+
+void Chip_PININT_SetPinModeEdge(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_EnableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_DisableIntHigh(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_EnableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins);
+void Chip_PININT_DisableIntLow(LPC_PIN_INT_T * pPININT, uint32_t pins);
+uint32_t Chip_PININT_GetRiseStates(LPC_PIN_INT_T * pPININT);
+void Chip_PININT_ClearIntStatus(LPC_PIN_INT_T * pPININT, uint32_t pins);
+
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+
+/* === End of conditional blocks =================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP_H_ */
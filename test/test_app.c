@@ -0,0 +1,258 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_app.c
+ ** @brief Pruebas de las tareas del reloj despertador que no dependen de la placa
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "app.h"
+#include "chip.h"
+#include "clock.h"
+#include "digital.h"
+#include "event_queue.h"
+#include "screen.h"
+#include "telemetry.h"
+#include "ui.h"
+
+TEST_INCLUDE_PATH("muju/module/profile/inc")
+TEST_INCLUDE_PATH("muju/module/profile/arch/x86/inc")
+TEST_SOURCE_FILE("muju/module/profile/src/profile.c")
+TEST_SOURCE_FILE("muju/module/profile/arch/x86/src/profile_arch.c")
+TEST_SOURCE_FILE("src/bcd.c")
+TEST_SOURCE_FILE("test/support/chip.c")
+
+/* === Private macros definitions ================================================================================== */
+
+#define CLOCK_TICKS_PER_SECOND 5  // Frecuencia del reloj simulado en Hz
+#define KEYS_GPIO              0  // Puerto de los terminales de las teclas simuladas
+#define OUTPUT_SIZE            64 // Cantidad de bytes del registro de eventos que se capturan
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static void FakeDigitsTurnOff(void);
+static void FakeSegmentsUpdate(uint8_t segments);
+static void FakeDigitTurnOn(uint8_t digit);
+static void FakeFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
+static void FakeAlarmIndicator(bool active);
+static void FakeSecondElapsed(void);
+static uint32_t FakeClock(void);
+
+//! Marca que la tarea detuvo el multiplexado de la pantalla
+static void FakeDisableRefresh(void);
+
+//! Marca que la tarea reanudo el multiplexado y cuenta las imagenes publicadas
+static void FakeEnableRefresh(void);
+static uint16_t FakeWriter(const void * data, uint16_t size);
+
+//! Cuenta los eventos pendientes iguales al indicado y vacia la cola
+static uint8_t CountEvents(event_t expected);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct screen_driver_s screen_driver = {
+    .DigitsTurnOff = FakeDigitsTurnOff,
+    .SegmentsUpdate = FakeSegmentsUpdate,
+    .DigitTurnOn = FakeDigitTurnOn,
+};
+
+static const struct ui_driver_s ui_driver = {
+    .FlashDigits = FakeFlashDigits,
+    .AlarmIndicator = FakeAlarmIndicator,
+};
+
+static struct app_s app;
+static uint8_t seconds_elapsed;     // Veces que la tarea de la interfaz llamo a la funcion de cada segundo
+static uint8_t output[OUTPUT_SIZE]; // Bytes del registro de eventos entregados a la funcion de envio
+static uint16_t written;            // Cantidad de bytes entregados
+static bool refresh_locked;         // Indica si la tarea detuvo el multiplexado de la pantalla
+static uint8_t publications;        // Veces que la tarea reanudo el multiplexado despues de publicar una imagen
+static uint8_t segments;            // Ultimos segmentos enviados a la pantalla
+static uint8_t shown[UI_DIGITS];    // Segmentos encendidos en cada digito durante el ultimo barrido
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void FakeDigitsTurnOff(void) {
+}
+
+static void FakeSegmentsUpdate(uint8_t value) {
+    segments = value;
+}
+
+static void FakeDigitTurnOn(uint8_t digit) {
+    shown[digit] = segments;
+}
+
+static void FakeFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    (void)from;
+    (void)to;
+    (void)divisor;
+}
+
+static void FakeAlarmIndicator(bool active) {
+    (void)active;
+}
+
+static void FakeSecondElapsed(void) {
+    seconds_elapsed++;
+}
+
+static uint32_t FakeClock(void) {
+    return 0;
+}
+
+static void FakeDisableRefresh(void) {
+    refresh_locked = true;
+}
+
+static void FakeEnableRefresh(void) {
+    refresh_locked = false;
+    publications++;
+}
+
+static uint16_t FakeWriter(const void * data, uint16_t size) {
+    const uint8_t * bytes = data;
+
+    for (uint16_t index = 0; index < size && written < OUTPUT_SIZE; index++) {
+        output[written++] = bytes[index];
+    }
+    return size;
+}
+
+static uint8_t CountEvents(event_t expected) {
+    uint8_t count = 0;
+    event_t event;
+
+    while (EventQueueGet(app.events, &event)) {
+        count += (event == expected);
+    }
+    return count;
+}
+
+/* === Public function implementation ============================================================================== */
+
+void setUp(void) {
+    FakeChipReset();
+    app = (struct app_s){
+        .blink_period = 2,
+        .SecondElapsed = FakeSecondElapsed,
+        .DisableRefresh = FakeDisableRefresh,
+        .EnableRefresh = FakeEnableRefresh,
+    };
+    // Las teclas se liberan antes de crear las entradas para que la primera lectura no detecte un flanco
+    for (uint8_t key = 0; key < APP_KEYS; key++) {
+        Chip_GPIO_SetPinState(LPC_GPIO_PORT, KEYS_GPIO, key, true);
+        app.keys[key] = DigitalInputCreate(KEYS_GPIO, key, true);
+    }
+    app.screen = ScreenCreate(UI_DIGITS, UI_DIGITS, &screen_driver);
+    app.clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    app.events = EventQueueCreate();
+    app.ui = UiCreate(app.clock, &ui_driver);
+    app.telemetry = TelemetryCreate(FakeClock);
+    seconds_elapsed = 0;
+    written = 0;
+    refresh_locked = false;
+    publications = 0;
+}
+
+// Cada tecla liberada envia a la interfaz el evento que corresponde a su posicion
+void test_released_key_posts_its_event(void) {
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, KEYS_GPIO, EVENT_KEY_ACCEPT, false);
+    AppKeysScanTask(&app);
+    TEST_ASSERT_TRUE(EventQueueIsEmpty(app.events));
+
+    Chip_GPIO_SetPinState(LPC_GPIO_PORT, KEYS_GPIO, EVENT_KEY_ACCEPT, true);
+    AppKeysScanTask(&app);
+    TEST_ASSERT_EQUAL_UINT8(1, CountEvents(EVENT_KEY_ACCEPT));
+}
+
+// La tarea del reloj envia un unico evento por cada segundo y deja la hora actual en la estructura compartida
+void test_clock_task_posts_one_event_per_second(void) {
+    const clock_time_t new_time = {.bcd = {6, 5, 4, 3, 2, 1}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(app.clock, &new_time));
+    AppClockTask(&app);
+    CountEvents(EVENT_CLOCK_SECOND);
+
+    for (int index = 0; index < CLOCK_TICKS_PER_SECOND; index++) {
+        AppClockTask(&app);
+    }
+    TEST_ASSERT_EQUAL_UINT8(1, CountEvents(EVENT_CLOCK_SECOND));
+    TEST_ASSERT_EQUAL_UINT8(7, app.current_time.bcd[0]);
+}
+
+// Con cada evento de segundo la tarea de la interfaz llama a la funcion del programa antes de procesarlo
+void test_ui_task_calls_the_second_hook(void) {
+    EventQueuePost(app.events, EVENT_CLOCK_SECOND);
+    EventQueuePost(app.events, EVENT_CLOCK_SECOND);
+    AppUiTask(&app);
+    TEST_ASSERT_EQUAL_UINT8(2, seconds_elapsed);
+
+    app.SecondElapsed = NULL;
+    EventQueuePost(app.events, EVENT_CLOCK_SECOND);
+    AppUiTask(&app);
+    TEST_ASSERT_EQUAL_UINT8(2, seconds_elapsed);
+}
+
+// La tarea de la interfaz registra la tecla procesada y el cambio de modo que provoca
+void test_ui_task_logs_key_and_mode_change(void) {
+    const uint8_t expected[] = {
+        TELEMETRY_START, 0, TELEMETRY_VERSION, TELEMETRY_KEY, 0, EVENT_KEY_SET_TIME, TELEMETRY_MODE, 0,
+        MODE_SET_TIME_MINUTES,
+    };
+
+    EventQueuePost(app.events, EVENT_KEY_SET_TIME);
+    AppUiTask(&app);
+    TEST_ASSERT_EQUAL(MODE_SET_TIME_MINUTES, UiGetMode(app.ui));
+
+    TelemetryDrain(app.telemetry, FakeWriter);
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected), written);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, output, sizeof(expected));
+}
+
+// La tarea de composicion publica la imagen completa con el multiplexado detenido y alterna el punto de los segundos
+void test_compose_task_publishes_with_refresh_locked(void) {
+    bool dot[2];
+
+    for (uint8_t composition = 0; composition < 2; composition++) {
+        AppDisplayComposeTask(&app);
+        TEST_ASSERT_FALSE(refresh_locked);
+        TEST_ASSERT_EQUAL_UINT8(composition + 1, publications);
+
+        for (uint8_t digit = 0; digit < UI_DIGITS; digit++) {
+            ScreenRefresh(app.screen);
+        }
+        dot[composition] = (shown[1] & SEGMENT_P) != 0;
+    }
+    TEST_ASSERT_NOT_EQUAL(dot[0], dot[1]);
+
+    app.DisableRefresh = NULL;
+    app.EnableRefresh = NULL;
+    AppDisplayComposeTask(&app);
+    TEST_ASSERT_EQUAL_UINT8(2, publications);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,156 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_bcd.c
+ ** @brief Pruebas de la aritmetica de campos BCD empaquetados
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "bcd.h"
+#include <stdbool.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#define MINUTES_PER_DAY (BCD_HOURS * BCD_MINUTES)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Suma o resta minutos a una hora del dia con dos campos BCD, acarreando entre los minutos y las horas.
+ * @param minute Minuto del dia de partida.
+ * @param step Cantidad de minutos a sumar o restar.
+ * @param subtract Indica si se restan los minutos.
+ * @return Minuto del dia resultante.
+ */
+static uint16_t StepTime(uint16_t minute, uint16_t step, bool subtract);
+
+/* === Private variable definitions ================================================================================ */
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t StepTime(uint16_t minute, uint16_t step, bool subtract) {
+    uint8_t hours = BcdFromBinary(minute / BCD_MINUTES);
+    uint8_t minutes = BcdFromBinary(minute % BCD_MINUTES);
+
+    if (subtract) {
+        BcdSubtractWrap(&hours, BcdSubtractWrap(&minutes, step, BCD_MINUTES), BCD_HOURS);
+    } else {
+        BcdAddWrap(&hours, BcdAddWrap(&minutes, step, BCD_MINUTES), BCD_HOURS);
+    }
+    return BcdToBinary(hours) * BCD_MINUTES + BcdToBinary(minutes);
+}
+
+/* === Public function implementation ============================================================================== */
+
+// Todos los valores de dos digitos se convierten entre binario y BCD sin perder informacion.
+void test_conversion_covers_all_two_digit_values(void) {
+    for (uint8_t value = 0; value < 100; value++) {
+        uint8_t field = BcdFromBinary(value);
+
+        TEST_ASSERT_EQUAL_HEX8(BCD_PACK(value / 10, value % 10), field);
+        TEST_ASSERT_EQUAL_UINT8(value / 10, BCD_TENS(field));
+        TEST_ASSERT_EQUAL_UINT8(value % 10, BCD_UNITS(field));
+        TEST_ASSERT_EQUAL_UINT8(value, BcdToBinary(field));
+    }
+}
+
+// Un paso de a uno da la vuelta en los extremos de los minutos y las horas e informa el acarreo.
+void test_single_steps_wrap_at_the_limits(void) {
+    uint8_t minutes = 0x59;
+    uint8_t hours = 0x23;
+
+    TEST_ASSERT_EQUAL_UINT16(1, BcdAddWrap(&minutes, 1, BCD_MINUTES));
+    TEST_ASSERT_EQUAL_HEX8(0x00, minutes);
+    TEST_ASSERT_EQUAL_UINT16(1, BcdSubtractWrap(&minutes, 1, BCD_MINUTES));
+    TEST_ASSERT_EQUAL_HEX8(0x59, minutes);
+    TEST_ASSERT_EQUAL_UINT16(0, BcdSubtractWrap(&minutes, 1, BCD_MINUTES));
+    TEST_ASSERT_EQUAL_HEX8(0x58, minutes);
+
+    TEST_ASSERT_EQUAL_UINT16(1, BcdAddWrap(&hours, 1, BCD_HOURS));
+    TEST_ASSERT_EQUAL_HEX8(0x00, hours);
+    TEST_ASSERT_EQUAL_UINT16(0, BcdAddWrap(&hours, 9, BCD_HOURS));
+    TEST_ASSERT_EQUAL_HEX8(0x09, hours);
+    TEST_ASSERT_EQUAL_UINT16(0, BcdAddWrap(&hours, 1, BCD_HOURS));
+    TEST_ASSERT_EQUAL_HEX8(0x10, hours);
+}
+
+// Sumar cualquier cantidad de minutos de un dia a cualquier minuto del dia da el mismo resultado que el modulo.
+void test_wrapping_add_covers_every_minute_and_step(void) {
+    for (uint16_t minute = 0; minute < MINUTES_PER_DAY; minute++) {
+        for (uint16_t step = 0; step < MINUTES_PER_DAY; step++) {
+            TEST_ASSERT_EQUAL_UINT16((minute + step) % MINUTES_PER_DAY, StepTime(minute, step, false));
+        }
+    }
+}
+
+// Restar cualquier cantidad de minutos de un dia a cualquier minuto del dia da el mismo resultado que el modulo.
+void test_wrapping_subtract_covers_every_minute_and_step(void) {
+    for (uint16_t minute = 0; minute < MINUTES_PER_DAY; minute++) {
+        for (uint16_t step = 0; step < MINUTES_PER_DAY; step++) {
+            uint16_t expected = (minute + MINUTES_PER_DAY - step) % MINUTES_PER_DAY;
+
+            TEST_ASSERT_EQUAL_UINT16(expected, StepTime(minute, step, true));
+        }
+    }
+}
+
+// Los pasos mayores que el campo cuentan todas las vueltas, hasta el paso mas grande posible.
+void test_large_steps_count_every_wrap(void) {
+    uint8_t minutes = 0x59;
+    uint8_t single = 0x00;
+
+    TEST_ASSERT_EQUAL_UINT16((59 + 65535) / 60, BcdAddWrap(&minutes, 65535, BCD_MINUTES));
+    TEST_ASSERT_EQUAL_HEX8(BcdFromBinary((59 + 65535) % 60), minutes);
+
+    minutes = 0x00;
+    TEST_ASSERT_EQUAL_UINT16(65535 / 60 + 1, BcdSubtractWrap(&minutes, 65535, BCD_MINUTES));
+    TEST_ASSERT_EQUAL_HEX8(BcdFromBinary(60 - 65535 % 60), minutes);
+
+    TEST_ASSERT_EQUAL_UINT16(65535, BcdAddWrap(&single, 65535, 1));
+    TEST_ASSERT_EQUAL_HEX8(0x00, single);
+}
+
+// Los pasos con saturacion se detienen en el ultimo valor del campo y en cero, para todos los valores y pasos.
+void test_saturating_steps_stop_at_the_limits(void) {
+    static const uint8_t limits[] = {BCD_MINUTES, BCD_HOURS};
+
+    for (uint8_t index = 0; index < sizeof(limits); index++) {
+        uint8_t limit = limits[index];
+
+        for (uint8_t value = 0; value < limit; value++) {
+            for (uint16_t step = 0; step < 100; step++) {
+                uint8_t up = BcdFromBinary(value);
+                uint8_t down = BcdFromBinary(value);
+
+                BcdAddSaturate(&up, step, limit);
+                BcdSubtractSaturate(&down, step);
+                TEST_ASSERT_EQUAL_UINT8((value + step < limit) ? value + step : limit - 1, BcdToBinary(up));
+                TEST_ASSERT_EQUAL_UINT8((value > step) ? value - step : 0, BcdToBinary(down));
+            }
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
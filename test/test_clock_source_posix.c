@@ -0,0 +1,95 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+
+/** @file test_clock_source_posix.c
+ ** @brief Pruebas de la fuente de la hora del dia sobre el reloj de tiempo real de la PC
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "clock_source.h"
+
+TEST_SOURCE_FILE("src/posix/clock_source_posix.c")
+
+/* === Private macros definitions ================================================================================== */
+
+#define TEST_TIME (12 * 3600 + 34 * 60 + 56) // Las 12:34:56 en segundos desde la medianoche
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static clock_source_t source;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function definitions ================================================================================= */
+
+void setUp(void) {
+    source = ClockSourcePosix();
+}
+
+// La fuente tiene las dos funciones de acceso y comienza con una hora valida
+void test_source_starts_with_a_valid_time(void) {
+    uint32_t seconds = CLOCK_SOURCE_SECONDS_PER_DAY;
+
+    TEST_ASSERT_NOT_NULL(source);
+    TEST_ASSERT_NOT_NULL(source->Read);
+    TEST_ASSERT_NOT_NULL(source->Write);
+    TEST_ASSERT_TRUE(source->Read(&seconds));
+    TEST_ASSERT_LESS_THAN_UINT32(CLOCK_SOURCE_SECONDS_PER_DAY, seconds);
+}
+
+// Al leer la hora despues de ajustarla se obtiene la misma hora, o un segundo mas si el reloj de la PC avanzo
+void test_write_then_read_returns_the_written_time(void) {
+    uint32_t seconds = 0;
+
+    TEST_ASSERT_TRUE(source->Write(TEST_TIME));
+    TEST_ASSERT_TRUE(source->Read(&seconds));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TEST_TIME, seconds);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_TIME + 1, seconds);
+}
+
+// Despues del ultimo segundo del dia la hora vuelve a la medianoche
+void test_read_wraps_at_midnight(void) {
+    uint32_t seconds = 0;
+
+    TEST_ASSERT_TRUE(source->Write(CLOCK_SOURCE_SECONDS_PER_DAY - 1));
+    TEST_ASSERT_TRUE(source->Read(&seconds));
+    TEST_ASSERT_TRUE((seconds == CLOCK_SOURCE_SECONDS_PER_DAY - 1) || (seconds == 0));
+}
+
+// Una hora fuera del dia se rechaza sin modificar la hora ajustada previamente
+void test_write_rejects_a_time_outside_the_day(void) {
+    uint32_t seconds = 0;
+
+    TEST_ASSERT_TRUE(source->Write(TEST_TIME));
+    TEST_ASSERT_FALSE(source->Write(CLOCK_SOURCE_SECONDS_PER_DAY));
+    TEST_ASSERT_TRUE(source->Read(&seconds));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(TEST_TIME, seconds);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_TIME + 1, seconds);
+}
+
+/* === End of documentation ======================================================================================== */
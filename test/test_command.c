@@ -0,0 +1,213 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_command.c
+ ** @brief Pruebas del protocolo de comandos, verificadas de punta a punta sobre la emulacion posix del puerto serie
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "command.h"
+#include "clock.h"
+#include "frame.h"
+#include "hal_sci.h"
+#include "soc_sci.h"
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include "host_time.h"
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/posix/inc")
+TEST_SOURCE_FILE("muju/module/hal/src/hal_sci.c")
+TEST_SOURCE_FILE("muju/module/hal/soc/posix/src/soc_sci.c")
+TEST_SOURCE_FILE("test/support/host_time.c")
+TEST_SOURCE_FILE("src/bcd.c")
+
+/* === Private macros definitions ================================================================================== */
+#define WAIT_LIMIT  1000 // Tiempo maximo de espera de una respuesta, en milisegundos
+#define OUTPUT_SIZE 128  // Tamaño del buffer de transmision
+#define INPUT_SIZE  64   // Tamaño del buffer de recepcion
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint16_t PortWrite(const void * data, uint16_t size);
+static void GetCounters(command_counters_t * counters);
+
+/**
+ * @brief Envia un pedido desde el anfitrion y atiende el puerto hasta recibir la respuesta o agotar la espera.
+ * @param request Datos del pedido, sin armar la trama.
+ * @param size Cantidad de bytes del pedido.
+ * @param chunk Cantidad maxima de bytes que se entregan al interprete en cada llamada.
+ * @return Cantidad de bytes de la respuesta, cero si no llego ninguna respuesta valida.
+ */
+static uint16_t Transact(const uint8_t * request, uint16_t size, uint16_t chunk);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct hal_sci_line_s line = {.baud_rate = 115200, .data_bits = 8, .parity = HAL_SCI_NO_PARITY};
+
+static const struct command_driver_s driver = {
+    .Write = PortWrite,
+    .GetCounters = GetCounters,
+};
+
+static uint8_t output[OUTPUT_SIZE];
+static uint8_t input[INPUT_SIZE];
+static int host;                         // Lado esclavo del pseudo terminal que usa el programa del anfitrion
+static frame_decoder_t host_decoder;     // Decodificador de las respuestas en el anfitrion
+static uint8_t response[FRAME_PAYLOAD_MAX]; // Datos de la ultima respuesta recibida
+
+static clock_t clock;
+static command_t command;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint16_t PortWrite(const void * data, uint16_t size) {
+    return SciWrite(HAL_SCI_USART3, data, size);
+}
+
+static void GetCounters(command_counters_t * counters) {
+    counters->missed_ticks = 3;
+    counters->overruns = 0x0102;
+    counters->telemetry_lost = 0x01020304;
+    counters->serial_lost = SciGetLost(HAL_SCI_USART3);
+}
+
+static uint16_t Transact(const uint8_t * request, uint16_t size, uint16_t chunk) {
+    uint8_t frame[FRAME_ENCODED_MAX];
+    uint8_t received[INPUT_SIZE];
+    uint16_t length = FrameEncode(request, size, frame);
+    uint32_t start = HostTimeNow() / 1000000;
+
+    TEST_ASSERT_EQUAL_INT(length, write(host, frame, length));
+    while (HostTimeNow() / 1000000 - start < WAIT_LIMIT) {
+        uint16_t count = SciRead(HAL_SCI_USART3, received, chunk);
+        CommandReceive(command, received, count);
+
+        uint8_t byte;
+        while (read(host, &byte, 1) == 1) {
+            if (FrameDecoderPush(host_decoder, byte) == FRAME_READY) {
+                const uint8_t * payload = FrameDecoderGetPayload(host_decoder, &length);
+                memcpy(response, payload, length);
+                return length;
+            }
+        }
+    }
+    return 0;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_USART3, &line, NULL));
+    SciSetPacing(HAL_SCI_USART3, false);
+    TEST_ASSERT_TRUE(SciSetBuffers(HAL_SCI_USART3, output, sizeof(output), input, sizeof(input)));
+    host = open(SciGetDevice(HAL_SCI_USART3), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    TEST_ASSERT_TRUE(host >= 0);
+
+    host_decoder = FrameDecoderCreate();
+    clock = ClockCreate(10);
+    command = CommandCreate(clock, &driver);
+}
+
+void tearDown(void) {
+    close(host);
+}
+
+// No se puede crear un interprete sin reloj o sin funcion para responder.
+void test_invalid_parameters_are_rejected(void) {
+    static const struct command_driver_s silent = {.Write = NULL};
+
+    TEST_ASSERT_NOT_NULL(command);
+    TEST_ASSERT_NULL(CommandCreate(NULL, &driver));
+    TEST_ASSERT_NULL(CommandCreate(clock, NULL));
+    TEST_ASSERT_NULL(CommandCreate(clock, &silent));
+}
+
+// La hora ajustada por el anfitrion se lee con el comando de consulta.
+void test_set_and_get_time(void) {
+    static const uint8_t set_time[] = {PROTOCOL_SET_TIME, 13, 45, 30};
+    static const uint8_t get_time[] = {PROTOCOL_GET_TIME};
+    static const uint8_t expected[] = {PROTOCOL_GET_TIME | PROTOCOL_RESPONSE, PROTOCOL_OK, 1, 13, 45, 30};
+
+    TEST_ASSERT_EQUAL_UINT16(2, Transact(set_time, sizeof(set_time), INPUT_SIZE));
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_SET_TIME | PROTOCOL_RESPONSE, response[0]);
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_OK, response[1]);
+
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected), Transact(get_time, sizeof(get_time), INPUT_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, response, sizeof(expected));
+}
+
+// Una unica trama configura la hora y la alarma habilitada, aunque llegue de a un byte por vez.
+void test_provision_in_one_frame_byte_by_byte(void) {
+    static const uint8_t provision[] = {PROTOCOL_PROVISION, 6, 0, 0, 6, 30, 1};
+    static const uint8_t get_alarm[] = {PROTOCOL_GET_ALARM};
+    static const uint8_t expected[] = {PROTOCOL_GET_ALARM | PROTOCOL_RESPONSE, PROTOCOL_OK, 6, 30, 1};
+
+    TEST_ASSERT_EQUAL_UINT16(2, Transact(provision, sizeof(provision), 1));
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_OK, response[1]);
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected), Transact(get_alarm, sizeof(get_alarm), 1));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, response, sizeof(expected));
+}
+
+// Los pedidos incorrectos se responden con un error y no modifican el reloj.
+void test_invalid_requests_are_reported(void) {
+    static const uint8_t unknown[] = {0x7E};
+    static const uint8_t short_request[] = {PROTOCOL_SET_TIME, 10, 0};
+    static const uint8_t bad_provision[] = {PROTOCOL_PROVISION, 6, 0, 0, 24, 0, 1};
+    static const uint8_t enable_unset[] = {PROTOCOL_SET_ALARM, 7, 0, 1};
+    clock_time_t current_time;
+
+    Transact(unknown, sizeof(unknown), INPUT_SIZE);
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_UNKNOWN, response[1]);
+    Transact(short_request, sizeof(short_request), INPUT_SIZE);
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_INVALID, response[1]);
+    Transact(bad_provision, sizeof(bad_provision), INPUT_SIZE);
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_INVALID, response[1]);
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
+
+    // Sin una hora valida el reloj no permite habilitar la alarma
+    Transact(enable_unset, sizeof(enable_unset), INPUT_SIZE);
+    TEST_ASSERT_EQUAL_HEX8(PROTOCOL_REJECTED, response[1]);
+}
+
+// Una trama alterada no se responde y se cuenta como error en el estado junto con los contadores del sistema.
+void test_status_reports_frame_errors_and_counters(void) {
+    static const uint8_t corrupted[] = {0x03, PROTOCOL_SET_TIME, 0x55, 0x55, FRAME_DELIMITER};
+    static const uint8_t get_status[] = {PROTOCOL_GET_STATUS};
+    static const uint8_t expected[] = {
+        PROTOCOL_GET_STATUS | PROTOCOL_RESPONSE, PROTOCOL_OK, 0, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x01, 0x02, 0x01,
+        0x02, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00,
+    };
+
+    TEST_ASSERT_EQUAL_INT(sizeof(corrupted), write(host, corrupted, sizeof(corrupted)));
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected), Transact(get_status, sizeof(get_status), INPUT_SIZE));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, response, sizeof(expected));
+}
+
+/* === End of documentation ======================================================================================== */
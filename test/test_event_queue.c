@@ -0,0 +1,105 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_event_queue.c
+ ** @brief Pruebas de la cola de eventos entre las interrupciones y el lazo principal
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "event_queue.h"
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+static event_queue_t queue;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    queue = EventQueueCreate();
+}
+
+// Al crear la cola esta vacia y no se puede retirar ningun evento.
+void test_new_queue_is_empty(void) {
+    event_t event;
+
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_TRUE(EventQueueIsEmpty(queue));
+    TEST_ASSERT_FALSE(EventQueueGet(queue, &event));
+}
+
+// Los eventos se retiran en el mismo orden en que se agregaron.
+void test_events_are_retrieved_in_order(void) {
+    event_t event;
+
+    TEST_ASSERT_TRUE(EventQueuePost(queue, 3));
+    TEST_ASSERT_TRUE(EventQueuePost(queue, 7));
+    TEST_ASSERT_FALSE(EventQueueIsEmpty(queue));
+
+    TEST_ASSERT_TRUE(EventQueueGet(queue, &event));
+    TEST_ASSERT_EQUAL_UINT8(3, event);
+    TEST_ASSERT_TRUE(EventQueueGet(queue, &event));
+    TEST_ASSERT_EQUAL_UINT8(7, event);
+    TEST_ASSERT_TRUE(EventQueueIsEmpty(queue));
+}
+
+// Con la cola llena se descarta el evento nuevo y se cuenta como perdido.
+void test_full_queue_discards_new_events(void) {
+    event_t event;
+
+    for (int index = 0; index < EVENT_QUEUE_SIZE; index++) {
+        TEST_ASSERT_TRUE(EventQueuePost(queue, index));
+    }
+    TEST_ASSERT_FALSE(EventQueuePost(queue, 99));
+    TEST_ASSERT_EQUAL_UINT16(1, EventQueueGetLost(queue));
+
+    TEST_ASSERT_TRUE(EventQueueGet(queue, &event));
+    TEST_ASSERT_EQUAL_UINT8(0, event);
+}
+
+// Los indices dan la vuelta sin perder ni repetir eventos.
+void test_indexes_wrap_around(void) {
+    event_t event;
+
+    for (int index = 0; index < 300; index++) {
+        TEST_ASSERT_TRUE(EventQueuePost(queue, index));
+        TEST_ASSERT_TRUE(EventQueueGet(queue, &event));
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)index, event);
+    }
+    TEST_ASSERT_TRUE(EventQueueIsEmpty(queue));
+    TEST_ASSERT_EQUAL_UINT16(0, EventQueueGetLost(queue));
+}
+
+// Una cola invalida se comporta como vacia y rechaza eventos.
+void test_null_queue_is_rejected(void) {
+    event_t event;
+
+    TEST_ASSERT_FALSE(EventQueuePost(NULL, 1));
+    TEST_ASSERT_FALSE(EventQueueGet(NULL, &event));
+    TEST_ASSERT_TRUE(EventQueueIsEmpty(NULL));
+}
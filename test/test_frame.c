@@ -0,0 +1,140 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_frame.c
+ ** @brief Pruebas de las tramas con relleno COBS y CRC-16
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "frame.h"
+#include <string.h>
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Entrega una trama codificada al decodificador y devuelve el estado despues del ultimo byte.
+ */
+static frame_status_t PushFrame(const uint8_t * data, uint16_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+static frame_decoder_t decoder;
+static uint8_t frame[FRAME_ENCODED_MAX];
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static frame_status_t PushFrame(const uint8_t * data, uint16_t size) {
+    frame_status_t status = FRAME_INCOMPLETE;
+
+    for (uint16_t index = 0; index < size; index++) {
+        status = FrameDecoderPush(decoder, data[index]);
+        if (index + 1 < size) {
+            TEST_ASSERT_EQUAL(FRAME_INCOMPLETE, status);
+        }
+    }
+    return status;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    decoder = FrameDecoderCreate();
+}
+
+// El CRC es el CRC-16 CCITT con valor inicial 0xFFFF.
+void test_crc_matches_reference_value(void) {
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, FrameCrc((const uint8_t *)"123456789", 9));
+}
+
+// La trama codificada no contiene separadores salvo el final y el decodificador recupera los datos originales.
+void test_frame_with_zeros_round_trips(void) {
+    static const uint8_t payload[] = {0x00, 0x11, 0x00, 0x00, 0x22, 0x33, 0x00};
+    const uint8_t * decoded;
+    uint16_t size = FrameEncode(payload, sizeof(payload), frame);
+
+    TEST_ASSERT_EQUAL_UINT16(sizeof(payload) + FRAME_CRC_SIZE + 2, size);
+    TEST_ASSERT_EQUAL_HEX8(FRAME_DELIMITER, frame[size - 1]);
+    for (uint16_t index = 0; index < size - 1; index++) {
+        TEST_ASSERT_TRUE(frame[index] != FRAME_DELIMITER);
+    }
+
+    TEST_ASSERT_EQUAL(FRAME_READY, PushFrame(frame, size));
+    decoded = FrameDecoderGetPayload(decoder, &size);
+    TEST_ASSERT_NOT_NULL(decoded);
+    TEST_ASSERT_EQUAL_UINT16(sizeof(payload), size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(payload, decoded, sizeof(payload));
+}
+
+// Una trama de la longitud maxima se decodifica y una mas larga no se puede armar.
+void test_longest_frame_round_trips(void) {
+    uint8_t payload[FRAME_PAYLOAD_MAX + 1];
+    uint16_t size;
+
+    for (uint16_t index = 0; index < sizeof(payload); index++) {
+        payload[index] = index + 1;
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, FrameEncode(payload, sizeof(payload), frame));
+    size = FrameEncode(payload, FRAME_PAYLOAD_MAX, frame);
+    TEST_ASSERT_TRUE(size <= FRAME_ENCODED_MAX);
+    TEST_ASSERT_EQUAL(FRAME_READY, PushFrame(frame, size));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(payload, FrameDecoderGetPayload(decoder, &size), FRAME_PAYLOAD_MAX);
+    TEST_ASSERT_EQUAL_UINT16(FRAME_PAYLOAD_MAX, size);
+}
+
+// Un byte alterado se detecta por el CRC y la trama siguiente se recibe correctamente.
+void test_corrupted_frame_is_rejected(void) {
+    static const uint8_t payload[] = {0x01, 0x02, 0x03};
+    uint16_t size = FrameEncode(payload, sizeof(payload), frame);
+
+    frame[2] ^= 0x40;
+    TEST_ASSERT_EQUAL(FRAME_ERROR, PushFrame(frame, size));
+    TEST_ASSERT_NULL(FrameDecoderGetPayload(decoder, &size));
+
+    size = FrameEncode(payload, sizeof(payload), frame);
+    TEST_ASSERT_EQUAL(FRAME_READY, PushFrame(frame, size));
+}
+
+// Un receptor que comienza a mitad de una trama la descarta y se sincroniza con el separador.
+void test_decoder_synchronizes_on_delimiter(void) {
+    static const uint8_t payload[] = {0x05, 0x00, 0x06};
+    uint16_t size = FrameEncode(payload, sizeof(payload), frame);
+
+    TEST_ASSERT_EQUAL(FRAME_ERROR, PushFrame(&frame[3], size - 3));
+    TEST_ASSERT_EQUAL(FRAME_INCOMPLETE, FrameDecoderPush(decoder, FRAME_DELIMITER));
+    TEST_ASSERT_EQUAL(FRAME_READY, PushFrame(frame, size));
+}
+
+// Una trama que excede el buffer del decodificador se descarta.
+void test_oversized_frame_is_rejected(void) {
+    uint8_t block[FRAME_PAYLOAD_MAX + FRAME_CRC_SIZE + 2];
+
+    memset(block, 0x55, sizeof(block));
+    block[0] = sizeof(block) - 1;
+    block[sizeof(block) - 1] = FRAME_DELIMITER;
+    TEST_ASSERT_EQUAL(FRAME_ERROR, PushFrame(block, sizeof(block)));
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,190 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_hal_sci.c
+ ** @brief Pruebas de los puertos serie con buffers circulares del HAL, verificadas sobre la emulacion posix
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "hal_sci.h"
+#include "soc_sci.h"
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/posix/inc")
+TEST_SOURCE_FILE("muju/module/hal/src/hal_sci.c")
+TEST_SOURCE_FILE("muju/module/hal/soc/posix/src/soc_sci.c")
+
+/* === Private macros definitions ================================================================================== */
+#define WAIT_LIMIT  1000 // Tiempo maximo de espera de los datos, en milisegundos
+#define OUTPUT_SIZE 128  // Tamaño del buffer de transmision
+#define INPUT_SIZE  32   // Tamaño del buffer de recepcion
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Devuelve el tiempo monotonico del sistema en milisegundos
+ */
+static uint32_t Milliseconds(void);
+
+/**
+ * @brief Lee del pseudo terminal la cantidad de bytes indicada o los que lleguen antes del tiempo limite
+ */
+static uint16_t ReadHost(uint8_t * data, uint16_t size);
+
+/**
+ * @brief Lee del buffer de recepcion la cantidad de bytes indicada o los que lleguen antes del tiempo limite
+ */
+static uint16_t ReadPort(uint8_t * data, uint16_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct hal_sci_line_s fast_line = {.baud_rate = 115200, .data_bits = 8, .parity = HAL_SCI_NO_PARITY};
+
+//! Linea lenta, cada caracter de diez bits demora poco mas de un milisegundo
+static const struct hal_sci_line_s slow_line = {.baud_rate = 9600, .data_bits = 8, .parity = HAL_SCI_NO_PARITY};
+
+static uint8_t output[OUTPUT_SIZE];
+static uint8_t input[INPUT_SIZE];
+static uint8_t pattern[256]; // Datos de prueba, cada byte distinto de sus vecinos
+static int host;             // Descriptor del lado esclavo del pseudo terminal que usa el programa del anfitrion
+
+/* === Public function declarations ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t Milliseconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static uint16_t ReadHost(uint8_t * data, uint16_t size) {
+    uint16_t received = 0;
+    uint32_t start = Milliseconds();
+
+    while ((received < size) && (Milliseconds() - start < WAIT_LIMIT)) {
+        ssize_t count = read(host, &data[received], size - received);
+        if (count > 0) {
+            received += count;
+        }
+    }
+    return received;
+}
+
+static uint16_t ReadPort(uint8_t * data, uint16_t size) {
+    uint16_t received = 0;
+    uint32_t start = Milliseconds();
+
+    while ((received < size) && (Milliseconds() - start < WAIT_LIMIT)) {
+        received += SciRead(HAL_SCI_UART1, &data[received], size - received);
+    }
+    return received;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    for (unsigned index = 0; index < sizeof(pattern); index++) {
+        pattern[index] = index * 7;
+    }
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_UART1, &fast_line, NULL));
+    SciSetPacing(HAL_SCI_UART1, false);
+    TEST_ASSERT_TRUE(SciSetBuffers(HAL_SCI_UART1, output, sizeof(output), input, sizeof(input)));
+    host = open(SciGetDevice(HAL_SCI_UART1), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    TEST_ASSERT_TRUE(host >= 0);
+}
+
+void tearDown(void) {
+    uint8_t discard[64];
+
+    // Descarta los datos que hayan quedado para la prueba siguiente
+    while (ReadHost(discard, sizeof(discard)) == sizeof(discard)) {
+    }
+    close(host);
+}
+
+// Los buffers deben tener un tamaño potencia de dos y un puerto sin buffers no transfiere datos.
+void test_invalid_buffers_are_rejected(void) {
+    uint8_t data[4];
+
+    TEST_ASSERT_FALSE(SciSetBuffers(HAL_SCI_UART1, output, 100, input, sizeof(input)));
+    TEST_ASSERT_FALSE(SciSetBuffers(HAL_SCI_UART1, output, sizeof(output), NULL, sizeof(input)));
+    TEST_ASSERT_FALSE(SciSetBuffers(NULL, output, sizeof(output), input, sizeof(input)));
+    TEST_ASSERT_EQUAL_UINT16(0, SciWrite(HAL_SCI_USART3, "abcd", 4));
+    TEST_ASSERT_EQUAL_UINT16(0, SciRead(HAL_SCI_USART3, data, sizeof(data)));
+}
+
+// Una escritura mayor que la fifo del hardware se acepta completa y llega al anfitrion sin cambios.
+void test_write_larger_than_fifo_reaches_host(void) {
+    uint8_t received[100];
+
+    TEST_ASSERT_EQUAL_UINT16(100, SciWrite(HAL_SCI_UART1, pattern, 100));
+    TEST_ASSERT_EQUAL_UINT16(100, ReadHost(received, sizeof(received)));
+    TEST_ASSERT_EQUAL_MEMORY(pattern, received, 100);
+}
+
+// Sin espacio libre la escritura no espera, acepta solo lo que entra en el buffer.
+void test_write_is_limited_by_free_space(void) {
+    uint8_t received[OUTPUT_SIZE];
+
+    SciSetPacing(HAL_SCI_UART1, true);
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_UART1, &slow_line, NULL));
+    TEST_ASSERT_EQUAL_UINT16(OUTPUT_SIZE, SciWrite(HAL_SCI_UART1, pattern, 200));
+    TEST_ASSERT_TRUE(SciWrite(HAL_SCI_UART1, pattern, 200) <= 16);
+    SciSetPacing(HAL_SCI_UART1, false);
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_UART1, &fast_line, NULL));
+
+    TEST_ASSERT_EQUAL_UINT16(OUTPUT_SIZE, ReadHost(received, sizeof(received)));
+    TEST_ASSERT_EQUAL_MEMORY(pattern, received, OUTPUT_SIZE);
+}
+
+// Los datos enviados por el anfitrion se obtienen en orden desde el buffer de recepcion.
+void test_read_returns_received_data(void) {
+    uint8_t received[INPUT_SIZE];
+
+    TEST_ASSERT_EQUAL_INT(20, write(host, pattern, 20));
+    TEST_ASSERT_EQUAL_UINT16(20, ReadPort(received, 20));
+    TEST_ASSERT_EQUAL_MEMORY(pattern, received, 20);
+    TEST_ASSERT_EQUAL_UINT16(0, SciRead(HAL_SCI_UART1, received, sizeof(received)));
+}
+
+// Con el buffer de recepcion lleno los datos nuevos se descartan y se cuentan como perdidos.
+void test_full_input_buffer_counts_lost_data(void) {
+    uint8_t received[INPUT_SIZE];
+    uint32_t start = Milliseconds();
+    uint32_t lost = SciGetLost(HAL_SCI_UART1);
+
+    TEST_ASSERT_EQUAL_INT(100, write(host, pattern, 100));
+    while ((SciGetLost(HAL_SCI_UART1) - lost < 100 - INPUT_SIZE) && (Milliseconds() - start < WAIT_LIMIT)) {
+    }
+    TEST_ASSERT_EQUAL_UINT32(100 - INPUT_SIZE, SciGetLost(HAL_SCI_UART1) - lost);
+    TEST_ASSERT_EQUAL_UINT16(INPUT_SIZE, SciRead(HAL_SCI_UART1, received, sizeof(received)));
+    TEST_ASSERT_EQUAL_MEMORY(pattern, received, INPUT_SIZE);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,152 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_hal_tick.c
+ ** @brief Pruebas del servicio de suscriptores del temporizador del sistema
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "hal_tick.h"
+#include <string.h>
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_SOURCE_FILE("muju/module/hal/src/hal_tick.c")
+
+/* === Private macros definitions ================================================================================== */
+#define TICK_PERIOD 1000 // Periodo del temporizador simulado en microsegundos
+#define LOG_SIZE    64   // Cantidad maxima de llamadas registradas
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Gestor de eventos que registra en el historial la letra recibida como objeto
+ */
+static void LogEvent(void * object);
+
+/**
+ * @brief Registra los suscriptores de prueba y arranca el servicio, solo la primera vez que se llama
+ */
+static void StartService(void);
+
+/**
+ * @brief Simula la cantidad indicada de eventos del temporizador del sistema
+ */
+static void SimulateTicks(uint32_t count);
+
+/* === Private variable definitions ================================================================================ */
+
+//! Suscriptor de todos los eventos con prioridad intermedia
+static const struct hal_tick_subscriber_s every_tick = {
+    .handler = LogEvent, .object = "A", .divider = 1, .offset = 0, .priority = 2};
+
+//! Suscriptor de uno de cada dos eventos, desfasado un evento, con la prioridad mas alta
+static const struct hal_tick_subscriber_s odd_ticks = {
+    .handler = LogEvent, .object = "B", .divider = 2, .offset = 1, .priority = 0};
+
+//! Suscriptor de uno de cada cuatro eventos con prioridad alta
+static const struct hal_tick_subscriber_s fourth_tick = {
+    .handler = LogEvent, .object = "C", .divider = 4, .offset = 0, .priority = 1};
+
+static hal_tick_event_t tick_handler;
+static void * tick_object;
+static uint32_t tick_period;
+
+static char event_log[LOG_SIZE];
+
+/* === Public function declarations ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static void LogEvent(void * object) {
+    size_t length = strlen(event_log);
+
+    if (length < LOG_SIZE - 1) {
+        event_log[length] = *(const char *)object;
+    }
+}
+
+static void StartService(void) {
+    static bool started = false;
+
+    if (!started) {
+        started = true;
+        TEST_ASSERT_TRUE(TickSubscribe(&every_tick));
+        TEST_ASSERT_TRUE(TickSubscribe(&odd_ticks));
+        TEST_ASSERT_TRUE(TickSubscribe(&fourth_tick));
+        TEST_ASSERT_TRUE(TickServiceStart(TICK_PERIOD));
+    }
+}
+
+static void SimulateTicks(uint32_t count) {
+    for (uint32_t index = 0; index < count; index++) {
+        tick_handler(tick_object);
+        LogEvent("|");
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+//! Sustituto del temporizador del sistema del HAL que guarda el gestor instalado por el servicio
+void TickStart(hal_tick_event_t handler, void * object, uint32_t period) {
+    tick_handler = handler;
+    tick_object = object;
+    tick_period = period;
+}
+
+void setUp(void) {
+    memset(event_log, 0, sizeof(event_log));
+    StartService();
+}
+
+// Al arrancar el servicio se instala un unico gestor en el temporizador con el periodo indicado.
+void test_service_installs_one_tick_handler(void) {
+    TEST_ASSERT_NOT_NULL(tick_handler);
+    TEST_ASSERT_EQUAL_UINT32(TICK_PERIOD, tick_period);
+}
+
+// Cada suscriptor se llama segun su divisor y desfasaje, en orden de prioridad dentro del mismo evento.
+void test_subscribers_called_by_divider_and_priority(void) {
+    SimulateTicks(8);
+    TEST_ASSERT_EQUAL_STRING("CA|BA|A|BA|CA|BA|A|BA|", event_log);
+}
+
+// El programa se repite con el minimo comun multiplo de los divisores.
+void test_schedule_repeats_after_hyperperiod(void) {
+    SimulateTicks(4);
+    memset(event_log, 0, sizeof(event_log));
+    SimulateTicks(4);
+    TEST_ASSERT_EQUAL_STRING("CA|BA|A|BA|", event_log);
+}
+
+// Despues de arrancar el servicio no se aceptan nuevos suscriptores ni un segundo arranque.
+void test_subscribe_after_start_is_rejected(void) {
+    TEST_ASSERT_FALSE(TickSubscribe(&every_tick));
+    TEST_ASSERT_FALSE(TickServiceStart(TICK_PERIOD));
+}
+
+// Un suscriptor sin gestor no puede registrarse.
+void test_subscriber_without_handler_is_rejected(void) {
+    static const struct hal_tick_subscriber_s invalid = {.handler = NULL, .divider = 1};
+
+    TEST_ASSERT_FALSE(TickSubscribe(NULL));
+    TEST_ASSERT_FALSE(TickSubscribe(&invalid));
+}
@@ -26,6 +26,8 @@ SPDX-License-Identifier: MIT
 #include "unity.h"
 #include "clock.h"
 
+TEST_SOURCE_FILE("src/bcd.c") // El reloj utiliza la aritmetica BCD
+
 /* === Private macros definitions ================================================================================ */
 #define CLOCK_TICKS_PER_SECOND 5 // Frecuencia del reloj simulado en Hz
 #define TEST_ASSERT_TIME(hours_tens, hours_units, minutes_tens, minutes_units, seconds_tens, seconds_units,            \
@@ -52,8 +54,19 @@ SPDX-License-Identifier: MIT
  * llamando a ClockNewTick para cada tick del reloj.
  */
 static void SimulateSeconds(clock_t clock, uint32_t seconds);
+
+/**
+ * @brief Funciones de una fuente de la hora simulada que devuelve fake_seconds mientras fake_valid es verdadero.
+ */
+static bool FakeSourceRead(uint32_t * seconds);
+static bool FakeSourceWrite(uint32_t seconds);
 /* === Private variable definitions ================================================================================ */
 
+static bool fake_valid;       // La fuente simulada tiene una hora valida
+static uint32_t fake_seconds; // Hora de la fuente simulada, en segundos desde la medianoche
+
+static const struct clock_source_s fake_source = {.Read = FakeSourceRead, .Write = FakeSourceWrite};
+
 /* === Public variable definitions ================================================================================= */
 
 /* === Private function definitions ================================================================================ */
@@ -63,6 +76,17 @@ static void SimulateSeconds(clock_t clock, uint32_t seconds) {
         ClockNewTick(clock); // Simula un tic del reloj
     }
 }
+
+static bool FakeSourceRead(uint32_t * seconds) {
+    *seconds = fake_seconds;
+    return fake_valid;
+}
+
+static bool FakeSourceWrite(uint32_t seconds) {
+    fake_seconds = seconds;
+    fake_valid = true;
+    return true;
+}
 /* === Header for C++ compatibility ================================================================================
  */
 
@@ -281,6 +305,27 @@ void test_snoozed_alarm_triggers_after_delay(void) {
     TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
 }
 
+// Posponer la alarma acarrea los minutos a las horas y da la vuelta a la medianoche.
+void test_snoozed_alarm_wraps_past_midnight(void) {
+    static const clock_time_t start_time = {.time = {.seconds = {9, 5}, .minutes = {9, 2}, .hours = {3, 2}}};
+    static const clock_time_t target_time = {.time = {.seconds = {0, 0}, .minutes = {0, 3}, .hours = {3, 2}}};
+
+    // Inicializamos el reloj a 23:29:59 y la alarma suena a las 23:30:00
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &start_time));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &target_time));
+    ClockEnableAlarm(clock);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+
+    // Pospuesta 45 minutos vuelve a sonar a las 00:15:00
+    TEST_ASSERT_TRUE(ClockSnoozeAlarm(clock, 45));
+    SimulateSeconds(clock, 45 * 60 - 1);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TIME(0, 0, 1, 5, 0, 0, wrapped_time);
+}
+
 // Hacer sonar la alarma y cancelarla hasta el otro dia..
 void test_alarm_can_be_cancelled_until_next_day(void) {
     // Configurar la alarma para sonar a las 00:01:00
@@ -317,6 +362,36 @@ void test_alarm_can_be_cancelled_until_next_day(void) {
     TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
 }
 
+// Cancelar la alarma durante el mismo segundo en que coincide la hora no debe hacerla sonar de nuevo.
+void test_cancelled_alarm_does_not_trigger_again_in_same_second(void) {
+    static const clock_time_t target_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {0, 0}}};
+
+    // Inicializamos el reloj a 00:00:59
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &(clock_time_t){.time = {.seconds = {9, 5}, .minutes = {0, 0}}}));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &target_time));
+    ClockEnableAlarm(clock);
+
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+    TEST_ASSERT_TRUE(ClockCancelAlarmUntilNextDay(clock));
+
+    // El resto de los ticks del segundo 00:01:00
+    ClockNewTick(clock);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+}
+
+// Programar la alarma para la hora actual no la hace sonar hasta que el reloj vuelva a alcanzarla.
+void test_alarm_set_to_current_time_does_not_trigger(void) {
+    static const clock_time_t target_time = {.time = {.seconds = {0, 0}, .minutes = {1, 0}, .hours = {0, 0}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &target_time));
+    TEST_ASSERT_TRUE(ClockSetAlarmTime(clock, &target_time));
+    ClockEnableAlarm(clock);
+
+    ClockNewTick(clock);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+}
+
 //  Probar get_time y con NULL como argumento
 void test_get_time_with_null_arguments(void) {
     // Test con reloj NULL
@@ -387,4 +462,113 @@ void test_clock_with_different_frequency(void) {
     TEST_ASSERT_EQUAL_UINT8(0, result.time.hours[1]);
 }
 
+// Un reloj con una fuente que conservo la hora comienza con esa hora valida.
+void test_clock_restores_time_from_source(void) {
+    fake_valid = true;
+    fake_seconds = 12 * 3600 + 34 * 60 + 56;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+    TEST_ASSERT_TIME(1, 2, 3, 4, 5, 6, current_time);
+}
+
+// Al ajustar la hora del reloj tambien se ajusta la fuente.
+void test_setting_time_adjusts_source(void) {
+    static const clock_time_t new_time = {.time = {.seconds = {5, 0}, .minutes = {0, 3}, .hours = {7, 0}}};
+    clock_time_t current_time;
+
+    fake_valid = false;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &new_time));
+    TEST_ASSERT_TRUE(fake_valid);
+    TEST_ASSERT_EQUAL_UINT32(7 * 3600 + 30 * 60 + 5, fake_seconds);
+}
+
+// Con una fuente los segundos avanzan cuando cambia la fuente y no cuando se completan los ticks.
+void test_clock_follows_source_seconds(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}};
+
+    fake_valid = true;
+    fake_seconds = 8 * 3600 - 1;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+    ClockSetAlarmTime(clock, &alarm_time);
+    ClockEnableAlarm(clock);
+
+    // La fuente atrasa respecto de los ticks, el reloj la espera
+    SimulateSeconds(clock, 2);
+    TEST_ASSERT_TIME(0, 7, 5, 9, 5, 9, waiting_time);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+
+    fake_seconds++;
+    ClockNewTick(clock);
+    TEST_ASSERT_TIME(0, 8, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+// Si la fuente deja de responder el reloj sigue avanzando con los ticks.
+void test_clock_counts_ticks_when_source_fails(void) {
+    fake_valid = true;
+    fake_seconds = 23 * 3600 + 59 * 60 + 59;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+
+    fake_valid = false;
+    SimulateSeconds(clock, 2);
+    TEST_ASSERT_TIME(0, 0, 0, 0, 0, 1, current_time);
+    TEST_ASSERT_EQUAL_UINT32(2, ClockGetSourceFaults(clock));
+}
+
+// Si la fuente responde pero deja de cambiar el reloj avanza con los ticks despues de dos segundos y cuenta las fallas.
+void test_clock_counts_ticks_when_source_freezes(void) {
+    fake_valid = true;
+    fake_seconds = 10 * 3600;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+
+    SimulateSeconds(clock, 2);
+    TEST_ASSERT_TIME(1, 0, 0, 0, 0, 0, waiting_time);
+    TEST_ASSERT_EQUAL_UINT32(0, ClockGetSourceFaults(clock));
+
+    ClockNewTick(clock);
+    TEST_ASSERT_TIME(1, 0, 0, 0, 0, 1, first_time);
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TIME(1, 0, 0, 0, 0, 2, second_time);
+    TEST_ASSERT_EQUAL_UINT32(2, ClockGetSourceFaults(clock));
+
+    // Cuando la fuente vuelve a cambiar el reloj la sigue de nuevo
+    fake_seconds = 10 * 3600 + 5;
+    ClockNewTick(clock);
+    TEST_ASSERT_TIME(1, 0, 0, 0, 0, 5, current_time);
+    TEST_ASSERT_EQUAL_UINT32(2, ClockGetSourceFaults(clock));
+}
+
+// Si la fuente salta varios segundos hacia adelante la alarma suena aunque su hora quede entre los segundos salteados.
+void test_source_jump_does_not_skip_alarm(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}};
+
+    fake_valid = true;
+    fake_seconds = 8 * 3600 - 2;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+    ClockSetAlarmTime(clock, &alarm_time);
+    ClockEnableAlarm(clock);
+
+    fake_seconds = 8 * 3600 + 3;
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TIME(0, 8, 0, 0, 0, 3, current_time);
+    TEST_ASSERT_TRUE(ClockIsAlarmTriggered(clock));
+}
+
+// Un ajuste de la fuente hacia atras no dispara la alarma por los segundos que retrocede.
+void test_source_moving_back_does_not_trigger_alarm(void) {
+    static const clock_time_t alarm_time = {.time = {.seconds = {0, 0}, .minutes = {0, 0}, .hours = {8, 0}}};
+
+    fake_valid = true;
+    fake_seconds = 9 * 3600;
+    clock = ClockCreateWithSource(CLOCK_TICKS_PER_SECOND, &fake_source);
+    ClockSetAlarmTime(clock, &alarm_time);
+    ClockEnableAlarm(clock);
+
+    fake_seconds = 7 * 3600;
+    SimulateSeconds(clock, 1);
+    TEST_ASSERT_TIME(0, 7, 0, 0, 0, 0, current_time);
+    TEST_ASSERT_FALSE(ClockIsAlarmTriggered(clock));
+}
+
 /* === End of conditional blocks =================================================================================== */
@@ -0,0 +1,171 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_scheduler.c
+ ** @brief Pruebas del planificador cooperativo disparado por tiempo
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "scheduler.h"
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint32_t FakeClock(void);
+static void FakeTask(void * object);
+
+/* === Private variable definitions ================================================================================ */
+
+static scheduler_t scheduler;
+static uint32_t now;         // Valor actual del contador de tiempo simulado
+static uint32_t duration[2]; // Tiempo que consume cada tarea simulada en cada ejecucion
+static uint8_t order[8];     // Orden en que se ejecutaron las tareas
+static uint8_t executed;     // Cantidad de ejecuciones registradas en order
+
+static uint8_t ids[2] = {0, 1};
+
+static const struct scheduler_task_s tasks[] = {
+    {.name = "rapida", .handler = FakeTask, .object = &ids[0], .period = 1, .offset = 0, .budget = 10},
+    {.name = "lenta", .handler = FakeTask, .object = &ids[1], .period = 4, .offset = 2, .budget = 50},
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t FakeClock(void) {
+    return now;
+}
+
+static void FakeTask(void * object) {
+    uint8_t id = *(uint8_t *)object;
+
+    now += duration[id];
+    if (executed < sizeof(order)) {
+        order[executed] = id;
+    }
+    executed++;
+}
+
+static void DispatchTicks(int count) {
+    for (int index = 0; index < count; index++) {
+        SchedulerTick(scheduler);
+        TEST_ASSERT_TRUE(SchedulerDispatch(scheduler));
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    now = 0;
+    duration[0] = 5;
+    duration[1] = 20;
+    executed = 0;
+    scheduler = SchedulerCreate(tasks, 2, FakeClock);
+}
+
+// Sin ticks registrados el despachador no ejecuta ninguna tarea.
+void test_no_tasks_run_without_ticks(void) {
+    TEST_ASSERT_NOT_NULL(scheduler);
+    TEST_ASSERT_FALSE(SchedulerHasPending(scheduler));
+    TEST_ASSERT_FALSE(SchedulerDispatch(scheduler));
+    TEST_ASSERT_EQUAL_UINT8(0, executed);
+}
+
+// No se puede crear un planificador con una tarea de periodo cero o sin funcion.
+void test_invalid_task_table_is_rejected(void) {
+    static const struct scheduler_task_s invalid[] = {
+        {.name = "nula", .handler = FakeTask, .object = &ids[0], .period = 0},
+    };
+
+    TEST_ASSERT_NULL(SchedulerCreate(invalid, 1, FakeClock));
+    TEST_ASSERT_NULL(SchedulerCreate(tasks, 2, NULL));
+    TEST_ASSERT_NULL(SchedulerCreate(tasks, 0, FakeClock));
+}
+
+// Cada tarea se activa segun su periodo y su desfasaje, en el orden de la tabla.
+void test_tasks_run_with_period_and_offset(void) {
+    scheduler_stats_t stats;
+
+    DispatchTicks(7);
+
+    SchedulerGetStats(scheduler, 0, &stats);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.runs);
+    SchedulerGetStats(scheduler, 1, &stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.runs);
+
+    // Ticks 0 y 1 solo la rapida, en el tick 2 la rapida seguida de la lenta
+    TEST_ASSERT_EQUAL_UINT8(0, order[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, order[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, order[2]);
+    TEST_ASSERT_EQUAL_UINT8(1, order[3]);
+}
+
+// Se registra la duracion de la ultima ejecucion y el peor tiempo medido.
+void test_execution_times_are_measured(void) {
+    scheduler_stats_t stats;
+
+    DispatchTicks(1);
+    duration[0] = 8;
+    DispatchTicks(1);
+    duration[0] = 3;
+    DispatchTicks(1);
+
+    TEST_ASSERT_TRUE(SchedulerGetStats(scheduler, 0, &stats));
+    TEST_ASSERT_EQUAL_UINT32(3, stats.last);
+    TEST_ASSERT_EQUAL_UINT32(8, stats.worst);
+    TEST_ASSERT_EQUAL_UINT16(0, stats.overruns);
+    TEST_ASSERT_TRUE(SchedulerIsSchedulable(scheduler));
+}
+
+// Una ejecucion que excede el presupuesto se cuenta y el planificador deja de ser planificable.
+void test_budget_overrun_is_flagged(void) {
+    scheduler_stats_t stats;
+
+    duration[0] = 11;
+    DispatchTicks(1);
+
+    SchedulerGetStats(scheduler, 0, &stats);
+    TEST_ASSERT_EQUAL_UINT16(1, stats.overruns);
+    TEST_ASSERT_FALSE(SchedulerIsSchedulable(scheduler));
+}
+
+// Si se acumulan ticks sin atender se cuentan como perdidos y las tareas atrasadas se ejecutan una sola vez.
+void test_late_dispatch_counts_missed_ticks(void) {
+    scheduler_stats_t stats;
+
+    SchedulerTick(scheduler);
+    SchedulerTick(scheduler);
+    SchedulerTick(scheduler);
+    TEST_ASSERT_TRUE(SchedulerHasPending(scheduler));
+    TEST_ASSERT_TRUE(SchedulerDispatch(scheduler));
+    TEST_ASSERT_FALSE(SchedulerHasPending(scheduler));
+
+    TEST_ASSERT_EQUAL_UINT16(2, SchedulerGetMissedTicks(scheduler));
+    SchedulerGetStats(scheduler, 0, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.runs);
+    TEST_ASSERT_EQUAL_UINT16(2, stats.skipped);
+    TEST_ASSERT_FALSE(SchedulerIsSchedulable(scheduler));
+}
+
+/* === End of documentation ======================================================================================== */
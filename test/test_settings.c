@@ -0,0 +1,217 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_settings.c
+ ** @brief Pruebas del almacenamiento no volatil de la configuracion sobre la memoria emulada del HAL posix
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "settings.h"
+#include "soc_eeprom.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/posix/inc")
+TEST_SOURCE_FILE("muju/module/hal/soc/posix/src/soc_eeprom.c")
+
+/* === Private macros definitions ================================================================================== */
+
+#define EEPROM_FILE  "test_settings.eeprom"     // Archivo con el contenido de la memoria emulada
+#define REGION_START (2 * HAL_EEPROM_PAGE_SIZE) // Comienzo de la region en la tercera pagina
+#define REGION_SLOTS 12                         // Una pagina y media, para dar muchas vueltas al diario
+#define REGION_SIZE  (REGION_SLOTS * SETTINGS_RECORD_SIZE)
+#define RECORD_WORDS (SETTINGS_RECORD_SIZE / HAL_EEPROM_WORD_SIZE)
+#define POWER_CUTS   5000                       // Cortes de alimentacion aleatorios que se prueban
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+/* === Private variable definitions ================================================================================ */
+
+static settings_store_t store;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+//! Genera una configuracion distinta para cada valor, con una hora de alarma valida
+static settings_t MakeSettings(uint32_t value) {
+    uint8_t hours = value % 24;
+    uint8_t minutes = value / 24 % 60;
+    settings_t settings = {
+        .alarm.time = {.seconds = {0, 0}, .minutes = {minutes % 10, minutes / 10}, .hours = {hours % 10, hours / 10}},
+        .alarm_enabled = (value % 3) != 0,
+        .brightness = value % 101,
+        .calibration = (int16_t)(value * 7 - 500),
+    };
+    return settings;
+}
+
+static void AssertSettings(const settings_t * expected, const settings_t * actual) {
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected->alarm.bcd, actual->alarm.bcd, 6);
+    TEST_ASSERT_EQUAL(expected->alarm_enabled, actual->alarm_enabled);
+    TEST_ASSERT_EQUAL_UINT8(expected->brightness, actual->brightness);
+    TEST_ASSERT_EQUAL_INT16(expected->calibration, actual->calibration);
+}
+
+static bool SameSettings(const settings_t * first, const settings_t * second) {
+    return (memcmp(first->alarm.bcd, second->alarm.bcd, 6) == 0) && (first->alarm_enabled == second->alarm_enabled) &&
+           (first->brightness == second->brightness) && (first->calibration == second->calibration);
+}
+
+//! Emula un reinicio del equipo: la memoria vuelve a tener alimentacion y el almacen se recupera desde cero
+static void Restart(void) {
+    free(store);
+    TEST_ASSERT_TRUE(EepromInit());
+    store = SettingsStoreCreate(REGION_START, REGION_SIZE);
+    TEST_ASSERT_NOT_NULL(store);
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    unlink(EEPROM_FILE);
+    EepromSetFile(EEPROM_FILE);
+    store = NULL;
+    Restart();
+}
+
+void tearDown(void) {
+    free(store);
+    unlink(EEPROM_FILE);
+}
+
+// Una memoria nueva no tiene ninguna configuracion guardada.
+void test_empty_memory_has_no_settings(void) {
+    settings_t settings;
+
+    TEST_ASSERT_FALSE(SettingsLoad(store, &settings));
+    TEST_ASSERT_NULL(SettingsStoreCreate(REGION_START + 1, REGION_SIZE));
+    TEST_ASSERT_NULL(SettingsStoreCreate(REGION_START, SETTINGS_RECORD_SIZE));
+    TEST_ASSERT_NULL(SettingsStoreCreate(REGION_START, EepromGetSize()));
+}
+
+// La configuracion guardada se recupera despues de reiniciar.
+void test_saved_settings_survive_restart(void) {
+    settings_t expected = MakeSettings(1234);
+    settings_t settings;
+
+    TEST_ASSERT_TRUE(SettingsSave(store, &expected));
+    Restart();
+    TEST_ASSERT_TRUE(SettingsLoad(store, &settings));
+    AssertSettings(&expected, &settings);
+}
+
+// Una configuracion con una hora de alarma invalida no se guarda.
+void test_invalid_alarm_is_rejected(void) {
+    settings_t settings = MakeSettings(5);
+    settings_t loaded;
+
+    settings.alarm.time.hours[1] = 2;
+    settings.alarm.time.hours[0] = 4;
+    TEST_ASSERT_FALSE(SettingsSave(store, &settings));
+    TEST_ASSERT_FALSE(SettingsLoad(store, &loaded));
+}
+
+// Guardar la misma configuracion que la ultima no escribe la memoria.
+void test_unchanged_settings_are_not_written(void) {
+    settings_t settings = MakeSettings(42);
+
+    TEST_ASSERT_TRUE(SettingsSave(store, &settings));
+    EepromSchedulePowerFailure(0);
+    TEST_ASSERT_TRUE(SettingsSave(store, &settings));
+    settings.brightness++;
+    TEST_ASSERT_FALSE(SettingsSave(store, &settings));
+}
+
+// Despues de muchas vueltas al diario se recupera el ultimo registro y todas las posiciones fueron usadas.
+void test_journal_wraps_and_levels_wear(void) {
+    uint8_t record[SETTINGS_RECORD_SIZE];
+    settings_t expected;
+    settings_t settings;
+
+    for (uint32_t value = 0; value < 5 * REGION_SLOTS + 7; value++) {
+        expected = MakeSettings(value);
+        TEST_ASSERT_TRUE(SettingsSave(store, &expected));
+    }
+    Restart();
+    TEST_ASSERT_TRUE(SettingsLoad(store, &settings));
+    AssertSettings(&expected, &settings);
+
+    for (uint32_t slot = 0; slot < REGION_SLOTS; slot++) {
+        TEST_ASSERT_TRUE(EepromRead(REGION_START + slot * SETTINGS_RECORD_SIZE, record, sizeof(record)));
+        TEST_ASSERT_EQUAL_UINT32(slot, (record[0] | (record[1] << 8) | (record[2] << 16)) % REGION_SLOTS);
+    }
+}
+
+// Un corte de alimentacion en cualquier palabra de una escritura conserva la configuracion anterior o la nueva.
+void test_power_failure_in_every_word_keeps_a_valid_record(void) {
+    settings_t previous = MakeSettings(100);
+    settings_t next = MakeSettings(200);
+    settings_t settings;
+
+    for (uint32_t word = 0; word < RECORD_WORDS; word++) {
+        TEST_ASSERT_TRUE(SettingsSave(store, &previous));
+        EepromSchedulePowerFailure(word);
+        TEST_ASSERT_FALSE(SettingsSave(store, &next));
+        Restart();
+        TEST_ASSERT_TRUE(SettingsLoad(store, &settings));
+        TEST_ASSERT_TRUE(SameSettings(&settings, &previous) || SameSettings(&settings, &next));
+    }
+}
+
+// Con miles de cortes aleatorios siempre se recupera la ultima configuracion confirmada o la que se estaba guardando.
+void test_random_power_failures_never_lose_confirmed_settings(void) {
+    uint32_t value = 0;
+    settings_t confirmed;
+    settings_t attempted;
+    settings_t settings;
+    bool saved = false;
+
+    srand(1);
+    for (int cut = 0; cut < POWER_CUTS; cut++) {
+        EepromSchedulePowerFailure(rand() % (3 * REGION_SLOTS * RECORD_WORDS));
+        do {
+            attempted = MakeSettings(++value);
+            if (SettingsSave(store, &attempted)) {
+                confirmed = attempted;
+                saved = true;
+            } else {
+                break;
+            }
+        } while (true);
+
+        // La escritura interrumpida puede haber quedado completa si el corte fue en la ultima palabra
+        Restart();
+        if (SettingsLoad(store, &settings)) {
+            TEST_ASSERT_TRUE((saved && SameSettings(&settings, &confirmed)) || SameSettings(&settings, &attempted));
+            confirmed = settings;
+            saved = true;
+        } else {
+            TEST_ASSERT_FALSE(saved);
+        }
+    }
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,214 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_soc_gpio.c
+ ** @brief Pruebas del despacho de eventos de terminales del HAL lpc43xx sobre un bloque PININT simulado
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "chip.h"
+#include "soc_gpio.h"
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/lpc43xx/inc")
+TEST_SOURCE_FILE("muju/module/hal/soc/lpc43xx/src/soc_gpio.c")
+
+/* === Private macros definitions ================================================================================== */
+#define GPIO_TEST_TERMINALS 9 // Uno mas que la cantidad de canales de interrupcion
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro de las llamadas recibidas por el gestor de eventos de prueba
+typedef struct {
+    uint32_t calls;
+    hal_gpio_bit_t gpio;
+    bool rising;
+    void * object;
+} event_log_t;
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Gestor de eventos que registra los parametros de la ultima llamada
+ */
+static void EventHandler(hal_gpio_bit_t gpio, bool rising, void * object);
+
+/**
+ * @brief Llama a la rutina de servicio correspondiente a un canal de interrupcion
+ */
+static void ServeChannel(uint8_t channel);
+
+/* === Private variable definitions ================================================================================ */
+static event_log_t event_log;
+static hal_gpio_bit_t terminals[GPIO_TEST_TERMINALS];
+
+/* === Public function declarations ================================================================================ */
+void GPIO0_IRQHandler(void);
+void GPIO1_IRQHandler(void);
+void GPIO2_IRQHandler(void);
+void GPIO3_IRQHandler(void);
+void GPIO4_IRQHandler(void);
+void GPIO5_IRQHandler(void);
+void GPIO6_IRQHandler(void);
+void GPIO7_IRQHandler(void);
+
+/* === Private function definitions ================================================================================ */
+
+static void EventHandler(hal_gpio_bit_t gpio, bool rising, void * object) {
+    event_log.calls++;
+    event_log.gpio = gpio;
+    event_log.rising = rising;
+    event_log.object = object;
+}
+
+static void ServeChannel(uint8_t channel) {
+    static void (*const handlers[])(void) = {
+        GPIO0_IRQHandler, GPIO1_IRQHandler, GPIO2_IRQHandler, GPIO3_IRQHandler,
+        GPIO4_IRQHandler, GPIO5_IRQHandler, GPIO6_IRQHandler, GPIO7_IRQHandler,
+    };
+    handlers[channel]();
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    hal_gpio_bit_t list[GPIO_TEST_TERMINALS] = {
+        HAL_GPIO0_0, HAL_GPIO0_1, HAL_GPIO0_2, HAL_GPIO0_3, HAL_GPIO0_4,
+        HAL_GPIO1_8, HAL_GPIO1_9, HAL_GPIO2_0, HAL_GPIO2_1,
+    };
+    for (int index = 0; index < GPIO_TEST_TERMINALS; index++) {
+        terminals[index] = list[index];
+    }
+    FakeChipReset();
+    event_log = (event_log_t){0};
+}
+
+void tearDown(void) {
+    // Libera los canales asignados para que cada prueba empiece con todos disponibles
+    for (int index = 0; index < GPIO_TEST_TERMINALS; index++) {
+        GpioSetEventHandler(terminals[index], NULL, NULL, false, false);
+    }
+}
+
+// Los ocho canales de interrupcion pueden asignarse, cada uno a un terminal distinto.
+void test_all_eight_channels_can_be_assigned(void) {
+    for (int channel = 0; channel < 8; channel++) {
+        GpioSetEventHandler(terminals[channel], EventHandler, NULL, true, false);
+    }
+    for (int channel = 0; channel < 8; channel++) {
+        TEST_ASSERT_TRUE(fake_nvic.enabled[PIN_INT0_IRQn + channel]);
+    }
+    TEST_ASSERT_EQUAL_HEX32(0xFF, fake_pin_int.IENR);
+    TEST_ASSERT_EQUAL_UINT8((0 << 5) | 0, fake_pintsel[0]);
+    TEST_ASSERT_EQUAL_UINT8((1 << 5) | 9, fake_pintsel[6]);
+    TEST_ASSERT_EQUAL_UINT8((2 << 5) | 0, fake_pintsel[7]);
+}
+
+// Un terminal sin canales libres no modifica la configuracion de los canales ya asignados.
+void test_no_free_channel_leaves_other_terminals_unchanged(void) {
+    for (int channel = 0; channel < 8; channel++) {
+        GpioSetEventHandler(terminals[channel], EventHandler, NULL, true, false);
+    }
+    uint8_t pintsel[8];
+    for (int channel = 0; channel < 8; channel++) {
+        pintsel[channel] = fake_pintsel[channel];
+    }
+
+    GpioSetEventHandler(terminals[8], EventHandler, NULL, false, true);
+    TEST_ASSERT_EQUAL_HEX32(0xFF, fake_pin_int.IENR);
+    TEST_ASSERT_EQUAL_HEX32(0x00, fake_pin_int.IENF);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(pintsel, fake_pintsel, 8);
+}
+
+// Al volver a registrar un terminal se reutiliza el mismo canal y se actualizan los flancos.
+void test_register_twice_reuses_channel(void) {
+    GpioSetEventHandler(terminals[0], EventHandler, NULL, true, false);
+    GpioSetEventHandler(terminals[1], EventHandler, NULL, true, false);
+    GpioSetEventHandler(terminals[0], EventHandler, NULL, false, true);
+
+    TEST_ASSERT_EQUAL_HEX32(0x02, fake_pin_int.IENR);
+    TEST_ASSERT_EQUAL_HEX32(0x01, fake_pin_int.IENF);
+    TEST_ASSERT_FALSE(fake_nvic.enabled[PIN_INT0_IRQn + 2]);
+}
+
+// Al liberar un terminal se deshabilita su interrupcion y el canal queda disponible para otro terminal.
+void test_release_disables_interrupt_and_frees_channel(void) {
+    for (int channel = 0; channel < 8; channel++) {
+        GpioSetEventHandler(terminals[channel], EventHandler, NULL, true, true);
+    }
+    GpioSetEventHandler(terminals[3], NULL, NULL, false, false);
+
+    TEST_ASSERT_FALSE(fake_nvic.enabled[PIN_INT0_IRQn + 3]);
+    TEST_ASSERT_EQUAL_HEX32(0xF7, fake_pin_int.IENR);
+    TEST_ASSERT_EQUAL_HEX32(0xF7, fake_pin_int.IENF);
+
+    GpioSetEventHandler(terminals[8], EventHandler, NULL, true, false);
+    TEST_ASSERT_TRUE(fake_nvic.enabled[PIN_INT0_IRQn + 3]);
+    TEST_ASSERT_EQUAL_UINT8((2 << 5) | 1, fake_pintsel[3]);
+}
+
+// El gestor recibe el terminal y el objeto registrados para el canal que genero la interrupcion.
+void test_dispatch_calls_registered_handler(void) {
+    int object_a, object_b;
+
+    GpioSetEventHandler(terminals[0], EventHandler, &object_a, true, false);
+    GpioSetEventHandler(terminals[1], EventHandler, &object_b, true, false);
+    FakePinIntTrigger(1, true);
+    ServeChannel(1);
+
+    TEST_ASSERT_EQUAL_UINT32(1, event_log.calls);
+    TEST_ASSERT_EQUAL_PTR(terminals[1], event_log.gpio);
+    TEST_ASSERT_EQUAL_PTR(&object_b, event_log.object);
+    TEST_ASSERT_TRUE(event_log.rising);
+    TEST_ASSERT_EQUAL_HEX32(0x00, fake_pin_int.IST);
+}
+
+// Con un solo flanco habilitado el despacho no necesita leer el registro de flancos del hardware.
+void test_dispatch_single_edge_does_not_read_rise_states(void) {
+    GpioSetEventHandler(terminals[0], EventHandler, NULL, false, true);
+    FakePinIntTrigger(0, false);
+    ServeChannel(0);
+
+    TEST_ASSERT_EQUAL_UINT32(1, event_log.calls);
+    TEST_ASSERT_FALSE(event_log.rising);
+    TEST_ASSERT_EQUAL_UINT32(0, fake_rise_reads);
+}
+
+// Con ambos flancos habilitados el despacho informa el flanco que genero la interrupcion.
+void test_dispatch_both_edges_reports_edge(void) {
+    GpioSetEventHandler(terminals[0], EventHandler, NULL, true, true);
+
+    FakePinIntTrigger(0, true);
+    ServeChannel(0);
+    TEST_ASSERT_TRUE(event_log.rising);
+
+    FakePinIntTrigger(0, false);
+    ServeChannel(0);
+    TEST_ASSERT_FALSE(event_log.rising);
+    TEST_ASSERT_EQUAL_UINT32(2, event_log.calls);
+}
+
+// Una interrupcion en un canal liberado no llama a ningun gestor.
+void test_dispatch_released_channel_does_nothing(void) {
+    GpioSetEventHandler(terminals[0], EventHandler, NULL, true, false);
+    GpioSetEventHandler(terminals[0], NULL, NULL, false, false);
+    ServeChannel(0);
+
+    TEST_ASSERT_EQUAL_UINT32(0, event_log.calls);
+}
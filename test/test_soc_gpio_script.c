@@ -0,0 +1,236 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_soc_gpio_script.c
+ ** @brief Pruebas de los guiones de entradas que manejan las terminales emuladas del HAL posix
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "soc_gpio.h"
+#include "soc_tick.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/posix/inc")
+TEST_SOURCE_FILE("muju/module/hal/soc/posix/src/soc_gpio.c")
+
+/* === Private macros definitions ================================================================================== */
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro de los flancos recibidos por el gestor de prueba
+typedef struct {
+    uint32_t rising;
+    uint32_t falling;
+} event_log_t;
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Gestor de eventos que cuenta los flancos de subida y de bajada
+ */
+static void EventHandler(hal_gpio_bit_t gpio, bool rising, void * object);
+
+/**
+ * @brief Escribe un guion en un archivo temporal, lo carga y deja en nivel bajo las terminales que usan las pruebas
+ */
+static void LoadScript(const char * text);
+
+/* === Private variable definitions ================================================================================ */
+
+static char path[] = "/tmp/test_soc_gpio_scriptXXXXXX";
+static uint64_t emulated_time; // Tiempo que devuelve el temporizador simulado, en microsegundos
+static event_log_t event_log;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void EventHandler(hal_gpio_bit_t gpio, bool rising, void * object) {
+    event_log_t * log = object;
+
+    (void)gpio;
+    if (rising) {
+        log->rising++;
+    } else {
+        log->falling++;
+    }
+}
+
+static void LoadScript(const char * text) {
+    const hal_gpio_bit_t terminals[] = {HAL_GPIO0_1, HAL_GPIO1_0, HAL_GPIO1_1, HAL_GPIO1_2, HAL_GPIO2_3, HAL_GPIO3_0};
+    FILE * file;
+    int handle;
+
+    strcpy(path, "/tmp/test_soc_gpio_scriptXXXXXX");
+    handle = mkstemp(path);
+    TEST_ASSERT_TRUE(handle >= 0);
+    file = fdopen(handle, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    fputs(text, file);
+    fclose(file);
+
+    TEST_ASSERT_TRUE(GpioScriptLoad(path));
+    // Con el guion cargado la emulacion no dibuja el estado, asi se puede reiniciar sin escribir en la salida
+    for (unsigned int index = 0; index < sizeof(terminals) / sizeof(terminals[0]); index++) {
+        GpioBitClear(terminals[index]);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+
+uint64_t TickGetTime(void) {
+    return emulated_time;
+}
+
+void setUp(void) {
+    emulated_time = 0;
+    event_log = (event_log_t){0};
+    path[0] = '\0';
+}
+
+void tearDown(void) {
+    if (path[0] != '\0') {
+        unlink(path);
+    }
+}
+
+// Los tiempos en segundos, milisegundos y microsegundos fijan el momento en que se aplica cada evento.
+void test_script_time_units(void) {
+    LoadScript("t=1s high GPIO1_0\n"
+               "t=1500ms low GPIO1_0\n"
+               "t=1500001us high GPIO1_0\n");
+
+    GpioScriptAdvanceTo(999999);
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO1_0));
+    GpioScriptAdvanceTo(1000000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO1_0));
+    GpioScriptAdvanceTo(1499999);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO1_0));
+    GpioScriptAdvanceTo(1500000);
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO1_0));
+
+    // Sin un tiempo explicito el guion avanza con el tiempo del temporizador del sistema
+    emulated_time = 1500001;
+    GpioScriptAdvance();
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO1_0));
+}
+
+// Las acciones de las teclas y de los niveles cambian la entrada y generan los flancos configurados.
+void test_script_actions(void) {
+    LoadScript("# Las teclas se presionan poniendo la entrada en nivel bajo\n"
+               "t=1ms release KEY2\n"
+               "t=2ms press KEY2\n"
+               "t=3ms toggle KEY2\n"
+               "t=4ms low GPIO0_1\n"
+               "t=5ms high GPIO0_1\n");
+    GpioSetEventHandler(HAL_GPIO0_1, EventHandler, &event_log, true, true);
+
+    GpioScriptAdvanceTo(1000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO0_1));
+    GpioScriptAdvanceTo(2000);
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO0_1));
+    GpioScriptAdvanceTo(3000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO0_1));
+    GpioScriptAdvanceTo(4000);
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO0_1));
+    GpioScriptAdvanceTo(5000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO0_1));
+
+    TEST_ASSERT_EQUAL_UINT32(3, event_log.rising);
+    TEST_ASSERT_EQUAL_UINT32(2, event_log.falling);
+    GpioSetEventHandler(HAL_GPIO0_1, NULL, NULL, false, false);
+}
+
+// Los nombres registrados referencian terminales en el guion y al registrarlos de nuevo cambian de terminal.
+void test_script_aliases(void) {
+    TEST_ASSERT_TRUE(GpioScriptSetAlias("F1", HAL_GPIO2_3));
+    TEST_ASSERT_TRUE(GpioScriptSetAlias("F2", HAL_GPIO2_3));
+    TEST_ASSERT_TRUE(GpioScriptSetAlias("F2", HAL_GPIO3_0));
+    TEST_ASSERT_FALSE(GpioScriptSetAlias("NOMBRE_DEMASIADO_LARGO", HAL_GPIO3_0));
+    TEST_ASSERT_FALSE(GpioScriptSetAlias("F3", NULL));
+
+    LoadScript("t=1ms high F1\n"
+               "t=2ms high F2\n");
+    GpioScriptAdvanceTo(1000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO2_3));
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO3_0));
+    GpioScriptAdvanceTo(2000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO3_0));
+}
+
+// Las lineas invalidas se descartan y el guion continua con la siguiente linea valida.
+void test_script_skips_invalid_lines(void) {
+    LoadScript("\n"
+               "   \n"
+               "  # comentario con sangria\n"
+               "linea sin tiempo\n"
+               "t=1min high GPIO1_1\n"
+               "t=1ms jump GPIO1_1\n"
+               "t=1ms high\n"
+               "t=1ms high TECLA\n"
+               "t=1ms high GPIO4_0\n"
+               "t=1ms high GPIO1_8\n"
+               "t=1ms high KEY9\n"
+               "t=2ms high GPIO1_2\n");
+
+    GpioScriptAdvanceTo(1000);
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO1_1));
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO1_2));
+    GpioScriptAdvanceTo(2000);
+    TEST_ASSERT_FALSE(GpioGetState(HAL_GPIO1_1));
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO1_2));
+}
+
+// Un guion que no se puede abrir no reemplaza al guion cargado.
+void test_script_load_fails_without_file(void) {
+    LoadScript("t=1ms high GPIO1_0\n");
+    TEST_ASSERT_FALSE(GpioScriptLoad("/nonexistent/script.txt"));
+    GpioScriptAdvanceTo(1000);
+    TEST_ASSERT_TRUE(GpioGetState(HAL_GPIO1_0));
+}
+
+// La accion de salida termina el programa con exito al llegar su tiempo, sin necesitar una terminal.
+void test_script_exit_ends_program(void) {
+    pid_t child;
+    int status;
+
+    LoadScript("t=1ms exit\n");
+    fflush(NULL);
+    child = fork();
+    TEST_ASSERT_TRUE(child >= 0);
+    if (child == 0) {
+        GpioScriptAdvanceTo(999);
+        GpioScriptAdvanceTo(1000);
+        _exit(EXIT_FAILURE);
+    }
+
+    TEST_ASSERT_EQUAL_INT(child, waitpid(child, &status, 0));
+    TEST_ASSERT_TRUE(WIFEXITED(status));
+    TEST_ASSERT_EQUAL_INT(EXIT_SUCCESS, WEXITSTATUS(status));
+}
+
+/* === End of documentation ======================================================================================== */
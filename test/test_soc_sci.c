@@ -0,0 +1,238 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_soc_sci.c
+ ** @brief Pruebas de los puertos serie del HAL posix emulados sobre pseudo terminales
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "soc_sci.h"
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/posix/inc")
+TEST_SOURCE_FILE("muju/module/hal/soc/posix/src/soc_sci.c")
+
+/* === Private macros definitions ================================================================================== */
+#define WAIT_LIMIT 1000 // Tiempo maximo de espera de un evento, en milisegundos
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro de los eventos recibidos por el gestor de prueba
+typedef struct {
+    volatile uint32_t calls;
+    volatile uint32_t data_ready;
+    volatile uint32_t fifo_empty;
+    hal_sci_t volatile sci;
+    void * volatile object;
+} event_log_t;
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Gestor de eventos que cuenta las banderas recibidas en cada llamada
+ */
+static void EventHandler(hal_sci_t sci, sci_status_t status, void * object);
+
+/**
+ * @brief Espera hasta que el contador indicado alcance un valor o se agote el tiempo limite
+ */
+static bool WaitFor(volatile uint32_t * counter, uint32_t value);
+
+/**
+ * @brief Devuelve el tiempo monotonico del sistema en milisegundos
+ */
+static uint32_t Milliseconds(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static const struct hal_sci_line_s fast_line = {.baud_rate = 115200, .data_bits = 8, .parity = HAL_SCI_NO_PARITY};
+
+//! Linea lenta, cada caracter de diez bits demora poco mas de un milisegundo
+static const struct hal_sci_line_s slow_line = {.baud_rate = 9600, .data_bits = 8, .parity = HAL_SCI_NO_PARITY};
+
+static event_log_t event_log;
+static int host; // Descriptor del lado esclavo del pseudo terminal que usa el programa del anfitrion
+
+/* === Public function declarations ================================================================================ */
+
+/* === Private function definitions ================================================================================ */
+
+static void EventHandler(hal_sci_t sci, sci_status_t status, void * object) {
+    event_log.sci = sci;
+    event_log.object = object;
+    if (status->data_ready) {
+        event_log.data_ready++;
+    }
+    if (status->fifo_empty) {
+        event_log.fifo_empty++;
+    }
+    event_log.calls++;
+}
+
+static uint32_t Milliseconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static bool WaitFor(volatile uint32_t * counter, uint32_t value) {
+    const struct timespec pause = {.tv_sec = 0, .tv_nsec = 100000};
+    uint32_t start = Milliseconds();
+
+    while ((*counter < value) && (Milliseconds() - start < WAIT_LIMIT)) {
+        nanosleep(&pause, NULL);
+    }
+    return *counter >= value;
+}
+
+static uint16_t ReadHost(uint8_t * data, uint16_t size) {
+    uint16_t received = 0;
+    uint32_t start = Milliseconds();
+
+    while ((received < size) && (Milliseconds() - start < WAIT_LIMIT)) {
+        ssize_t count = read(host, &data[received], size - received);
+        if (count > 0) {
+            received += count;
+        }
+    }
+    return received;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    uint8_t discard[HAL_SCI_FIFO_SIZE];
+
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_USART2, &fast_line, NULL));
+    SciSetPacing(HAL_SCI_USART2, false);
+    host = open(SciGetDevice(HAL_SCI_USART2), O_RDWR | O_NOCTTY | O_NONBLOCK);
+    TEST_ASSERT_TRUE(host >= 0);
+
+    // Descarta los datos que hayan quedado de una prueba anterior
+    while (SciReceiveData(HAL_SCI_USART2, discard, sizeof(discard)) > 0) {
+    }
+    event_log = (event_log_t){0};
+    SciSetEventHandler(HAL_SCI_USART2, EventHandler, &event_log);
+    TEST_ASSERT_TRUE(WaitFor(&event_log.fifo_empty, 1));
+}
+
+void tearDown(void) {
+    SciSetEventHandler(HAL_SCI_USART2, NULL, NULL);
+    close(host);
+}
+
+// Un puerto sin configurar no tiene dispositivo y uno configurado ofrece un pseudo terminal al anfitrion.
+void test_configured_port_offers_a_pseudo_terminal(void) {
+    TEST_ASSERT_NULL(SciGetDevice(HAL_SCI_USART3));
+    TEST_ASSERT_NOT_NULL(SciGetDevice(HAL_SCI_USART2));
+    TEST_ASSERT_EQUAL_INT(0, strncmp(SciGetDevice(HAL_SCI_USART2), "/dev/", 5));
+    TEST_ASSERT_FALSE(SciSetConfig(NULL, &fast_line, NULL));
+}
+
+// Habilitar los eventos con la fifo de salida vacia genera un evento, igual que en el hardware.
+void test_enabling_events_raises_fifo_empty(void) {
+    TEST_ASSERT_EQUAL_UINT32(1, event_log.fifo_empty);
+    TEST_ASSERT_EQUAL_PTR(HAL_SCI_USART2, event_log.sci);
+    TEST_ASSERT_EQUAL_PTR(&event_log, event_log.object);
+}
+
+// Los datos enviados llegan al anfitrion y al vaciarse la fifo se genera un evento.
+void test_sent_data_reaches_host(void) {
+    uint8_t received[5];
+
+    TEST_ASSERT_EQUAL_UINT16(5, SciSendData(HAL_SCI_USART2, "Hola\n", 5));
+    TEST_ASSERT_EQUAL_UINT16(5, ReadHost(received, sizeof(received)));
+    TEST_ASSERT_EQUAL_MEMORY("Hola\n", received, 5);
+    TEST_ASSERT_TRUE(WaitFor(&event_log.fifo_empty, 2));
+}
+
+// La fifo de salida acepta como maximo su profundidad y no acepta datos hasta vaciarse.
+void test_output_fifo_accepts_data_only_when_empty(void) {
+    uint8_t data[2 * HAL_SCI_FIFO_SIZE] = {0};
+    uint8_t received[HAL_SCI_FIFO_SIZE];
+
+    SciSetPacing(HAL_SCI_USART2, true);
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_USART2, &slow_line, NULL));
+    TEST_ASSERT_EQUAL_UINT16(HAL_SCI_FIFO_SIZE, SciSendData(HAL_SCI_USART2, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_UINT16(0, SciSendData(HAL_SCI_USART2, data, sizeof(data)));
+    TEST_ASSERT_EQUAL_UINT16(HAL_SCI_FIFO_SIZE, ReadHost(received, sizeof(received)));
+    TEST_ASSERT_TRUE(WaitFor(&event_log.fifo_empty, 2));
+    SciSetConfig(HAL_SCI_USART2, &fast_line, NULL);
+}
+
+// Con el ritmo habilitado cada caracter demora el tiempo que ocupa en la linea.
+void test_pacing_follows_baud_rate(void) {
+    uint8_t data[HAL_SCI_FIFO_SIZE] = {0};
+    uint32_t start;
+
+    SciSetPacing(HAL_SCI_USART2, true);
+    TEST_ASSERT_TRUE(SciSetConfig(HAL_SCI_USART2, &slow_line, NULL));
+    start = Milliseconds();
+    SciSendData(HAL_SCI_USART2, data, sizeof(data));
+    TEST_ASSERT_TRUE(WaitFor(&event_log.fifo_empty, 2));
+
+    // Dieciseis caracteres de diez bits a 9600 baudios ocupan 16,7 ms, el ultimo termina despues del evento
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(15, Milliseconds() - start);
+    SciSetConfig(HAL_SCI_USART2, &fast_line, NULL);
+}
+
+// Los datos del anfitrion generan un evento y se leen de la fifo de entrada.
+void test_received_data_raises_event(void) {
+    uint8_t received[8];
+
+    TEST_ASSERT_EQUAL_INT(4, write(host, "abcd", 4));
+    TEST_ASSERT_TRUE(WaitFor(&event_log.data_ready, 1));
+    TEST_ASSERT_EQUAL_UINT16(4, SciReceiveData(HAL_SCI_USART2, received, sizeof(received)));
+    TEST_ASSERT_EQUAL_MEMORY("abcd", received, 4);
+}
+
+// La fifo de entrada guarda como maximo su profundidad y el resto espera en el pseudo terminal sin perderse.
+void test_input_fifo_holds_its_depth_without_losing_data(void) {
+    uint8_t data[2 * HAL_SCI_FIFO_SIZE + 4];
+    uint8_t received[sizeof(data)];
+    uint16_t total = 0;
+    uint32_t start;
+
+    for (unsigned index = 0; index < sizeof(data); index++) {
+        data[index] = 'A' + index;
+    }
+    TEST_ASSERT_EQUAL_INT(sizeof(data), write(host, data, sizeof(data)));
+    TEST_ASSERT_TRUE(WaitFor(&event_log.data_ready, 1));
+    nanosleep(&(struct timespec){.tv_sec = 0, .tv_nsec = 10000000}, NULL);
+
+    TEST_ASSERT_EQUAL_UINT16(HAL_SCI_FIFO_SIZE, SciReceiveData(HAL_SCI_USART2, received, sizeof(received)));
+
+    // Al liberar espacio en la fifo el resto de los datos sigue llegando desde el pseudo terminal
+    total = HAL_SCI_FIFO_SIZE;
+    start = Milliseconds();
+    while ((total < sizeof(data)) && (Milliseconds() - start < WAIT_LIMIT)) {
+        total += SciReceiveData(HAL_SCI_USART2, &received[total], sizeof(received) - total);
+    }
+    TEST_ASSERT_EQUAL_UINT16(sizeof(data), total);
+    TEST_ASSERT_EQUAL_MEMORY(data, received, sizeof(data));
+}
+
+/* === End of documentation ======================================================================================== */
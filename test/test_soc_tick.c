@@ -0,0 +1,218 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_soc_tick.c
+ ** @brief Pruebas de la velocidad y del tiempo emulado del temporizador del sistema del HAL posix
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _POSIX_C_SOURCE 200809L
+
+#include "unity.h"
+#include "soc_gpio.h"
+#include "soc_tick.h"
+#include <time.h>
+
+TEST_INCLUDE_PATH("muju/module/hal/inc")
+TEST_INCLUDE_PATH("muju/module/hal/soc/posix/inc")
+TEST_SOURCE_FILE("muju/module/hal/soc/posix/src/soc_tick.c")
+
+/* === Private macros definitions ================================================================================== */
+#define TICK_PERIOD 1000 // Periodo del temporizador, en microsegundos
+#define WAIT_LIMIT  2000 // Tiempo maximo de espera de los eventos, en milisegundos
+
+/* === Private data type declarations ============================================================================== */
+
+//! Registro de los eventos recibidos por el gestor del temporizador
+typedef struct {
+    volatile uint32_t events;     // Eventos recibidos desde que se inicio el temporizador
+    volatile uint32_t mismatches; // Eventos en los que el tiempo emulado no avanzo exactamente un periodo
+    uint64_t last_time;           // Tiempo emulado en el evento anterior, en microsegundos
+    volatile uint32_t stall;      // Milisegundos que demora el gestor en el proximo evento
+} tick_log_t;
+
+/* === Private function declarations =============================================================================== */
+/**
+ * @brief Gestor de los eventos del temporizador que verifica el avance del tiempo emulado
+ */
+static void TickHandler(void * object);
+
+/**
+ * @brief Espera a que el temporizador genere una cantidad de eventos y devuelve el tiempo que demoro, en milisegundos
+ */
+static uint32_t WaitEvents(uint32_t count);
+
+/**
+ * @brief Devuelve el tiempo monotonico del sistema en milisegundos
+ */
+static uint32_t Milliseconds(void);
+
+/* === Private variable definitions ================================================================================ */
+
+static tick_log_t tick_log;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static void TickHandler(void * object) {
+    tick_log_t * log = object;
+    uint64_t time = TickGetTime();
+
+    if ((log->events > 0) && (time - log->last_time != TICK_PERIOD)) {
+        log->mismatches++;
+    }
+    log->last_time = time;
+    log->events++;
+
+    if (log->stall > 0) {
+        const struct timespec pause = {.tv_sec = 0, .tv_nsec = log->stall * 1000000L};
+
+        nanosleep(&pause, NULL);
+        log->stall = 0;
+    }
+}
+
+static uint32_t Milliseconds(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+static uint32_t WaitEvents(uint32_t count) {
+    const struct timespec pause = {.tv_sec = 0, .tv_nsec = 100000};
+    uint32_t start = Milliseconds();
+    uint32_t target = tick_log.events + count;
+
+    while ((tick_log.events < target) && (Milliseconds() - start < WAIT_LIMIT)) {
+        nanosleep(&pause, NULL);
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(target, tick_log.events);
+    return Milliseconds() - start;
+}
+
+/* === Public function implementation ============================================================================== */
+
+// El temporizador aplica los guiones de entradas antes de cada evento, las pruebas no cargan ninguno
+void GpioScriptAdvance(void) {
+}
+
+void setUp(void) {
+    static bool started = false;
+
+    TickSetSpeed(1);
+    if (!started) {
+        started = true;
+        TickStart(TickHandler, &tick_log, TICK_PERIOD);
+    }
+}
+
+void tearDown(void) {
+    // Con la velocidad 0 el hilo del temporizador ocuparia el procesador durante las pruebas siguientes
+    TickSetSpeed(1);
+}
+
+// El tiempo emulado avanza exactamente un periodo con cada evento, con cualquier velocidad.
+void test_time_advances_one_period_per_event(void) {
+    WaitEvents(20);
+    TickSetSpeed(0);
+    WaitEvents(1000);
+    TickSetSpeed(5);
+    WaitEvents(20);
+
+    TEST_ASSERT_EQUAL_UINT32(0, tick_log.mismatches);
+    TEST_ASSERT_EQUAL_UINT64(tick_log.last_time, TickGetTime());
+}
+
+// En tiempo real los eventos no se adelantan a sus plazos, y al aumentar la velocidad llegan antes.
+void test_speed_scales_event_rate(void) {
+    uint32_t real_time, faster;
+
+    WaitEvents(1);
+    real_time = WaitEvents(50);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(49, real_time);
+
+    TickSetSpeed(10);
+    WaitEvents(1);
+    faster = WaitEvents(50);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(4, faster);
+    TEST_ASSERT_LESS_THAN_UINT32(real_time, faster);
+}
+
+// Con la velocidad 0 cada evento se genera apenas termina el anterior, mucho mas rapido que en tiempo real.
+void test_speed_zero_runs_as_fast_as_possible(void) {
+    TickSetSpeed(0);
+    TEST_ASSERT_LESS_THAN_UINT32(500, WaitEvents(1000));
+}
+
+// Las estadisticas miden el retraso de los eventos generados con un plazo.
+void test_statistics_measure_lateness(void) {
+    struct tick_statistics_s statistics;
+
+    WaitEvents(1);
+    TickResetStatistics();
+    WaitEvents(20);
+    TickGetStatistics(&statistics);
+
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(19, statistics.events);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(statistics.lateness_avg, statistics.lateness_min);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(statistics.lateness_max, statistics.lateness_avg);
+}
+
+// Al borrar las estadisticas quedan en cero, y los eventos generados con la velocidad 0 no se cuentan.
+void test_reset_clears_statistics(void) {
+    struct tick_statistics_s statistics;
+
+    WaitEvents(20);
+    TickSetSpeed(0);
+    // El evento que esperaba su plazo al cambiar la velocidad todavia se cuenta
+    WaitEvents(2);
+    TickResetStatistics();
+    WaitEvents(1000);
+    TickGetStatistics(&statistics);
+
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.events);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.overruns);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.skipped);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.lateness_min);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.lateness_avg);
+    TEST_ASSERT_EQUAL_UINT32(0, statistics.lateness_max);
+}
+
+// Un evento que pierde varios plazos cuenta un desborde y los plazos perdidos se saltean en lugar de recuperarse.
+void test_overrun_skips_missed_deadlines(void) {
+    struct tick_statistics_s statistics;
+    uint32_t elapsed;
+
+    WaitEvents(1);
+    TickResetStatistics();
+    tick_log.stall = 20;
+    elapsed = WaitEvents(21);
+    TickGetStatistics(&statistics);
+
+    // Despues de la demora los veinte eventos siguientes mantienen el ritmo en lugar de generarse todos juntos
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(38, elapsed);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, statistics.overruns);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(19, statistics.skipped);
+    TEST_ASSERT_EQUAL_UINT32(0, tick_log.mismatches);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,156 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_telemetry.c
+ ** @brief Pruebas del registro binario de eventos del reloj
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "telemetry.h"
+
+/* === Private macros definitions ================================================================================== */
+
+//! Cantidad de bytes que puede capturar la funcion de envio simulada
+#define OUTPUT_SIZE 2048
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+
+static uint32_t FakeClock(void);
+static uint16_t FakeWriter(const void * data, uint16_t size);
+
+/* === Private variable definitions ================================================================================ */
+
+static telemetry_t telemetry;
+static uint32_t now;                // Tiempo simulado en milisegundos
+static uint8_t output[OUTPUT_SIZE]; // Bytes enviados por la funcion simulada
+static uint16_t written;            // Cantidad de bytes enviados
+static uint16_t capacity;           // Bytes que la funcion simulada acepta en cada llamada
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static uint32_t FakeClock(void) {
+    return now;
+}
+
+static uint16_t FakeWriter(const void * data, uint16_t size) {
+    const uint8_t * bytes = data;
+
+    if (size > capacity) {
+        size = capacity;
+    }
+    for (uint16_t index = 0; index < size && written < OUTPUT_SIZE; index++) {
+        output[written++] = bytes[index];
+    }
+    return size;
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    now = 1000;
+    written = 0;
+    capacity = UINT16_MAX;
+    telemetry = TelemetryCreate(FakeClock);
+}
+
+// Al crear el registro se agrega el registro de comienzo con la version del formato.
+void test_new_telemetry_starts_with_version(void) {
+    TEST_ASSERT_NOT_NULL(telemetry);
+    TEST_ASSERT_NULL(TelemetryCreate(NULL));
+
+    TEST_ASSERT_EQUAL_UINT16(3, TelemetryDrain(telemetry, FakeWriter));
+    TEST_ASSERT_EQUAL_UINT8(TELEMETRY_START, output[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, output[1]);
+    TEST_ASSERT_EQUAL_UINT8(TELEMETRY_VERSION, output[2]);
+    TEST_ASSERT_EQUAL_UINT16(0, TelemetryDrain(telemetry, FakeWriter));
+}
+
+// El tiempo desde el registro anterior y el valor se codifican en base 128, primero los bits menos significativos.
+void test_record_is_varint_encoded(void) {
+    static const uint8_t expected[] = {TELEMETRY_MODE, 0xAC, 0x02, 0x80, 0x80, 0x04};
+
+    now += 300;
+    TEST_ASSERT_TRUE(TelemetryLog(telemetry, TELEMETRY_MODE, 1UL << 16));
+    TelemetryDrain(telemetry, FakeWriter);
+    TEST_ASSERT_EQUAL_UINT16(3 + sizeof(expected), written);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, &output[3], sizeof(expected));
+
+    TEST_ASSERT_FALSE(TelemetryLog(telemetry, TELEMETRY_TYPES, 0));
+    TEST_ASSERT_FALSE(TelemetryLog(NULL, TELEMETRY_KEY, 0));
+}
+
+// Los bytes que la funcion de envio no acepta quedan pendientes para el siguiente envio.
+void test_partial_writes_keep_pending_bytes(void) {
+    TelemetryLog(telemetry, TELEMETRY_KEY, 4);
+
+    capacity = 2;
+    TEST_ASSERT_EQUAL_UINT16(2, TelemetryDrain(telemetry, FakeWriter));
+    TEST_ASSERT_EQUAL_UINT16(2, TelemetryDrain(telemetry, FakeWriter));
+    capacity = UINT16_MAX;
+    TEST_ASSERT_EQUAL_UINT16(2, TelemetryDrain(telemetry, FakeWriter));
+    TEST_ASSERT_EQUAL_UINT8(TELEMETRY_KEY, output[3]);
+    TEST_ASSERT_EQUAL_UINT8(4, output[5]);
+}
+
+// Los registros se envian completos y en orden aunque den varias vueltas al buffer circular.
+void test_records_wrap_around_the_buffer(void) {
+    TelemetryDrain(telemetry, FakeWriter);
+    for (uint16_t index = 0; index < 400; index++) {
+        TEST_ASSERT_TRUE(TelemetryLog(telemetry, TELEMETRY_KEY, index % 100));
+        TelemetryDrain(telemetry, FakeWriter);
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(3 + 400 * 3, written);
+    for (uint16_t index = 0; index < 400; index++) {
+        TEST_ASSERT_EQUAL_UINT8(TELEMETRY_KEY, output[3 + 3 * index]);
+        TEST_ASSERT_EQUAL_UINT8(index % 100, output[5 + 3 * index]);
+    }
+}
+
+// Con el buffer lleno los registros se descartan y su cantidad se informa antes del siguiente registro agregado.
+void test_full_buffer_reports_lost_records(void) {
+    uint16_t stored = 0;
+
+    while (TelemetryLog(telemetry, TELEMETRY_KEY, 1)) {
+        stored++;
+    }
+    TEST_ASSERT_FALSE(TelemetryLog(telemetry, TELEMETRY_KEY, 1));
+    TEST_ASSERT_EQUAL_UINT32(2, TelemetryGetLost(telemetry));
+
+    TelemetryDrain(telemetry, FakeWriter);
+    written = 0;
+    now += 5;
+    TEST_ASSERT_TRUE(TelemetryLog(telemetry, TELEMETRY_ALARM, 420));
+    TelemetryDrain(telemetry, FakeWriter);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(100, stored);
+    TEST_ASSERT_EQUAL_UINT16(3 + 4, written);
+    TEST_ASSERT_EQUAL_UINT8(TELEMETRY_LOST, output[0]);
+    TEST_ASSERT_EQUAL_UINT8(5, output[1]);
+    TEST_ASSERT_EQUAL_UINT8(2, output[2]);
+    TEST_ASSERT_EQUAL_UINT8(TELEMETRY_ALARM, output[3]);
+    TEST_ASSERT_EQUAL_UINT8(0, output[4]);
+}
+
+/* === End of documentation ======================================================================================== */
@@ -0,0 +1,265 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file test_ui.c
+ ** @brief Pruebas de la maquina de estados de la interfaz de usuario
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#include "unity.h"
+#include "ui.h"
+#include "clock.h"
+
+TEST_SOURCE_FILE("src/bcd.c") // El reloj utiliza la aritmetica BCD
+
+/* === Private macros definitions ================================================================================== */
+#define CLOCK_TICKS_PER_SECOND 5 // Frecuencia del reloj simulado en Hz
+
+#define TEST_ASSERT_DIGITS(d0, d1, d2, d3)                                                                             \
+    do {                                                                                                               \
+        const uint8_t expected[UI_DIGITS] = {d0, d1, d2, d3};                                                          \
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, UiGetDigits(ui), UI_DIGITS);                                           \
+    } while (0)
+
+/* === Private data type declarations ============================================================================== */
+
+/* === Private function declarations =============================================================================== */
+static void FakeFlashDigits(uint8_t from, uint8_t to, uint16_t divisor);
+static void FakeAlarmIndicator(bool active);
+
+//! Envia una secuencia de eventos a la interfaz
+static void SendEvents(const ui_event_t * events, uint8_t count);
+
+//! Simula el avance del reloj en segundos, enviando un evento por cada segundo
+static void SimulateSeconds(uint32_t seconds);
+
+/* === Private variable definitions ================================================================================ */
+static const struct ui_driver_s driver = {
+    .FlashDigits = FakeFlashDigits,
+    .AlarmIndicator = FakeAlarmIndicator,
+};
+
+static clock_t clock;
+static ui_t ui;
+
+static uint8_t flash_from;
+static uint8_t flash_to;
+static uint16_t flash_divisor;
+static bool alarm_indicator;
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+static void FakeFlashDigits(uint8_t from, uint8_t to, uint16_t divisor) {
+    flash_from = from;
+    flash_to = to;
+    flash_divisor = divisor;
+}
+
+static void FakeAlarmIndicator(bool active) {
+    alarm_indicator = active;
+}
+
+static void SendEvents(const ui_event_t * events, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        UiProcessEvent(ui, events[i]);
+    }
+}
+
+static void SimulateSeconds(uint32_t seconds) {
+    for (uint32_t i = 0; i < seconds; i++) {
+        for (uint32_t tick = 0; tick < CLOCK_TICKS_PER_SECOND; tick++) {
+            ClockNewTick(clock);
+        }
+        UiProcessEvent(ui, EVENT_CLOCK_SECOND);
+    }
+}
+
+/* === Public function implementation ============================================================================== */
+void setUp(void) {
+    flash_from = 0xFF;
+    flash_to = 0xFF;
+    flash_divisor = 0xFFFF;
+    alarm_indicator = false;
+
+    clock = ClockCreate(CLOCK_TICKS_PER_SECOND);
+    ui = UiCreate(clock, &driver);
+}
+
+// Al crear la interfaz comienza sin configurar y con todos los digitos parpadeando.
+void test_new_ui_starts_unset_and_flashing(void) {
+    TEST_ASSERT_NOT_NULL(ui);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    TEST_ASSERT_EQUAL_UINT8(0, flash_from);
+    TEST_ASSERT_EQUAL_UINT8(UI_DIGITS - 1, flash_to);
+    TEST_ASSERT_EQUAL_UINT16(100, flash_divisor);
+    TEST_ASSERT_NULL(UiCreate(clock, NULL));
+    TEST_ASSERT_NULL(UiCreate(NULL, &driver));
+}
+
+// Si el reloj ya tiene una hora valida la interfaz comienza en el modo HOME sin parpadear.
+void test_new_ui_with_valid_clock_starts_home(void) {
+    static const clock_time_t new_time = {.time = {.minutes = {5, 4}, .hours = {2, 1}}};
+
+    TEST_ASSERT_TRUE(ClockSetTime(clock, &new_time));
+    ui = UiCreate(clock, &driver);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_EQUAL_UINT16(0, flash_divisor);
+}
+
+// Si la hora se ajusta sin usar las teclas la interfaz pasa al modo HOME con el siguiente segundo.
+void test_time_set_externally_leaves_unset_mode(void) {
+    static const clock_time_t new_time = {.time = {.minutes = {0, 3}, .hours = {8, 0}}};
+
+    UiProcessEvent(ui, EVENT_CLOCK_SECOND);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    ClockSetTime(clock, &new_time);
+    UiProcessEvent(ui, EVENT_CLOCK_SECOND);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_EQUAL_UINT16(0, flash_divisor);
+}
+
+// Ajustar minutos y horas con las teclas configura la hora del reloj y pasa al modo HOME.
+void test_set_time_with_keys(void) {
+    static const ui_event_t events[] = {
+        EVENT_KEY_SET_TIME,  EVENT_KEY_INCREMENT, EVENT_KEY_INCREMENT, EVENT_KEY_ACCEPT,
+        EVENT_KEY_DECREMENT, EVENT_KEY_DECREMENT, EVENT_KEY_ACCEPT,
+    };
+    clock_time_t current_time;
+
+    SendEvents(events, 4);
+    TEST_ASSERT_EQUAL(MODE_SET_TIME_HOURS, UiGetMode(ui));
+    TEST_ASSERT_EQUAL_UINT8(0, flash_from);
+    TEST_ASSERT_EQUAL_UINT8(1, flash_to);
+
+    SendEvents(&events[4], 3);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_EQUAL_UINT16(0, flash_divisor);
+    TEST_ASSERT_DIGITS(2, 2, 0, 2);
+    TEST_ASSERT_TRUE(ClockGetTime(clock, &current_time));
+    TEST_ASSERT_EQUAL_UINT8(2, current_time.bcd[5]);
+    TEST_ASSERT_EQUAL_UINT8(2, current_time.bcd[4]);
+    TEST_ASSERT_EQUAL_UINT8(0, current_time.bcd[3]);
+    TEST_ASSERT_EQUAL_UINT8(2, current_time.bcd[2]);
+}
+
+// Los minutos y las horas dan la vuelta en ambos extremos.
+void test_edit_values_wrap_around(void) {
+    static const ui_event_t events[] = {EVENT_KEY_SET_TIME, EVENT_KEY_DECREMENT, EVENT_KEY_ACCEPT,
+                                        EVENT_KEY_DECREMENT};
+
+    SendEvents(events, sizeof(events) / sizeof(events[0]));
+    TEST_ASSERT_DIGITS(2, 3, 5, 9);
+
+    UiProcessEvent(ui, EVENT_KEY_INCREMENT);
+    TEST_ASSERT_DIGITS(0, 0, 5, 9);
+}
+
+// Cancelar una edicion vuelve al modo de reposo anterior sin modificar el reloj.
+void test_cancel_returns_to_previous_mode(void) {
+    clock_time_t current_time;
+
+    UiProcessEvent(ui, EVENT_KEY_SET_TIME);
+    UiProcessEvent(ui, EVENT_KEY_ACCEPT);
+    UiProcessEvent(ui, EVENT_KEY_CANCEL);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    TEST_ASSERT_EQUAL_UINT16(100, flash_divisor);
+    TEST_ASSERT_FALSE(ClockGetTime(clock, &current_time));
+
+    SendEvents((const ui_event_t[]){EVENT_KEY_SET_TIME, EVENT_KEY_ACCEPT, EVENT_KEY_ACCEPT}, 3);
+    UiProcessEvent(ui, EVENT_KEY_SET_ALARM);
+    TEST_ASSERT_EQUAL(MODE_SET_ALARM_MINUTES, UiGetMode(ui));
+    UiProcessEvent(ui, EVENT_KEY_CANCEL);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_FALSE(ClockIsAlarmEnabled(clock));
+}
+
+// Los eventos sin transicion en la tabla no cambian el modo ni los digitos.
+void test_events_without_transition_are_ignored(void) {
+    UiProcessEvent(ui, EVENT_KEY_INCREMENT);
+    UiProcessEvent(ui, EVENT_KEY_ACCEPT);
+    UiProcessEvent(ui, EVENT_CLOCK_SECOND);
+    UiProcessEvent(ui, EVENT_COUNT);
+    TEST_ASSERT_EQUAL(MODE_UNSET, UiGetMode(ui));
+    TEST_ASSERT_DIGITS(0, 0, 0, 0);
+}
+
+// Configurar la alarma la habilita y al llegar la hora enciende el indicador hasta que se cancela.
+void test_alarm_triggers_and_cancel_turns_indicator_off(void) {
+    static const ui_event_t set_time[] = {
+        EVENT_KEY_SET_TIME,  EVENT_KEY_DECREMENT, EVENT_KEY_ACCEPT,
+        EVENT_KEY_DECREMENT, EVENT_KEY_ACCEPT, // 23:59
+    };
+    static const ui_event_t set_alarm[] = {EVENT_KEY_SET_ALARM, EVENT_KEY_ACCEPT, EVENT_KEY_ACCEPT}; // 00:00
+
+    SendEvents(set_time, sizeof(set_time) / sizeof(set_time[0]));
+    SendEvents(set_alarm, sizeof(set_alarm) / sizeof(set_alarm[0]));
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_TRUE(ClockIsAlarmEnabled(clock));
+
+    SimulateSeconds(60);
+    TEST_ASSERT_EQUAL(MODE_ALARM_TRIGGERED, UiGetMode(ui));
+    TEST_ASSERT_TRUE(alarm_indicator);
+    TEST_ASSERT_EQUAL_UINT8(1, UiGetDots(ui)[3]);
+    TEST_ASSERT_DIGITS(0, 0, 0, 0);
+
+    UiProcessEvent(ui, EVENT_KEY_CANCEL);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_FALSE(alarm_indicator);
+    TEST_ASSERT_EQUAL_UINT8(0, UiGetDots(ui)[3]);
+}
+
+// Aceptar la alarma la pospone y vuelve a sonar despues de los minutos configurados.
+void test_snooze_alarm_triggers_again(void) {
+    static const ui_event_t events[] = {
+        EVENT_KEY_SET_TIME,  EVENT_KEY_ACCEPT,    EVENT_KEY_ACCEPT, // 00:00
+        EVENT_KEY_SET_ALARM, EVENT_KEY_INCREMENT, EVENT_KEY_ACCEPT, EVENT_KEY_ACCEPT, // 00:01
+    };
+
+    SendEvents(events, sizeof(events) / sizeof(events[0]));
+    SimulateSeconds(60);
+    TEST_ASSERT_EQUAL(MODE_ALARM_TRIGGERED, UiGetMode(ui));
+
+    UiProcessEvent(ui, EVENT_KEY_ACCEPT);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    TEST_ASSERT_FALSE(alarm_indicator);
+
+    SimulateSeconds(UI_SNOOZE_MINUTES * 60 - 1);
+    TEST_ASSERT_EQUAL(MODE_HOME, UiGetMode(ui));
+    SimulateSeconds(1);
+    TEST_ASSERT_EQUAL(MODE_ALARM_TRIGGERED, UiGetMode(ui));
+}
+
+// Ninguna combinacion de modo y evento deja a la interfaz en un modo invalido.
+void test_every_transition_leads_to_a_valid_mode(void) {
+    for (uint8_t first = 0; first < EVENT_COUNT; first++) {
+        for (uint8_t second = 0; second < EVENT_COUNT; second++) {
+            for (uint8_t third = 0; third < EVENT_COUNT; third++) {
+                ui = UiCreate(clock, &driver);
+                UiProcessEvent(ui, first);
+                UiProcessEvent(ui, second);
+                UiProcessEvent(ui, third);
+                TEST_ASSERT_LESS_THAN(MODE_COUNT, UiGetMode(ui));
+            }
+        }
+    }
+}
+
+/* === End of documentation ==================================================================================== */
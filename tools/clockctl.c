@@ -0,0 +1,338 @@
+
+/*********************************************************************************************************************
+Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+SPDX-License-Identifier: MIT
+*********************************************************************************************************************/
+
+/** @file clockctl.c
+ ** @brief Programa del anfitrion que consulta y configura el reloj con el protocolo de comandos por el puerto serie
+ **
+ ** Uso: clockctl -d dispositivo [-b baudios] [-r reintentos] comando [argumentos]
+ **
+ **   time                                  Muestra la hora del reloj
+ **   time HH:MM[:SS] | now                 Ajusta la hora, now usa la hora local del anfitrion
+ **   alarm                                 Muestra la alarma y si esta habilitada
+ **   alarm HH:MM on|off                    Ajusta y habilita o deshabilita la alarma
+ **   provision HH:MM[:SS] | now HH:MM on|off  Ajusta la hora y la alarma con un unico pedido
+ **   status                                Muestra el estado y los contadores del reloj
+ **
+ ** Un pedido sin respuesta se repite, porque el reloj descarta sin responder las tramas recibidas con errores.
+ **/
+
+/* === Headers files inclusions ==================================================================================== */
+#define _DEFAULT_SOURCE
+
+#include "frame.h"
+#include "protocol.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* === Private macros definitions ================================================================================== */
+
+#define RESPONSE_TIMEOUT 500 // Tiempo maximo de espera de una respuesta, en milisegundos
+#define DEFAULT_BAUDS    115200
+#define DEFAULT_RETRIES  3
+
+/* === Private data type declarations ============================================================================== */
+
+//! Velocidad de la linea y su constante de termios
+typedef struct speed_entry_s {
+    long bauds;
+    speed_t speed;
+} speed_entry_t;
+
+/* === Private function declarations =============================================================================== */
+
+/**
+ * @brief Abre el puerto serie en modo crudo con la velocidad indicada.
+ * @return Descriptor del puerto, o -1 si no se pudo abrir o configurar.
+ */
+static int OpenPort(const char * device, long bauds);
+
+/**
+ * @brief Envia un pedido y espera su respuesta, repitiendo el pedido si no llega.
+ * @return Cantidad de bytes de la respuesta, o cero si no hubo una respuesta valida.
+ */
+static uint16_t Transact(int port, const uint8_t * request, uint16_t size, uint8_t * response, int retries);
+
+/**
+ * @brief Convierte una hora con el formato HH:MM o HH:MM:SS, o la palabra now, en horas, minutos y segundos.
+ * @return 0 si la hora es valida, -1 en caso contrario.
+ */
+static int ParseTime(const char * text, uint8_t * values, int with_seconds);
+
+/**
+ * @brief Convierte las palabras on y off en el valor de habilitacion de la alarma.
+ * @return 0 si la palabra es valida, -1 en caso contrario.
+ */
+static int ParseSwitch(const char * text, uint8_t * value);
+
+//! Lee un contador con el byte mas significativo primero
+static uint32_t GetCounter(const uint8_t * data, int size);
+
+static void Usage(const char * program);
+
+/* === Private variable definitions ================================================================================ */
+
+static const speed_entry_t speeds[] = {
+    {9600, B9600}, {19200, B19200}, {38400, B38400}, {57600, B57600}, {115200, B115200},
+};
+
+static const char * const results[] = {
+    [PROTOCOL_OK] = "correcto",
+    [PROTOCOL_UNKNOWN] = "comando desconocido",
+    [PROTOCOL_INVALID] = "argumentos invalidos",
+    [PROTOCOL_REJECTED] = "rechazado por el reloj",
+};
+
+/* === Public variable definitions ================================================================================= */
+
+/* === Private function definitions ================================================================================ */
+
+static int OpenPort(const char * device, long bauds) {
+    struct termios settings;
+    speed_t speed = 0;
+
+    for (size_t index = 0; index < sizeof(speeds) / sizeof(speeds[0]); index++) {
+        if (speeds[index].bauds == bauds) {
+            speed = speeds[index].speed;
+        }
+    }
+    if (speed == 0) {
+        fprintf(stderr, "Velocidad %ld no soportada\n", bauds);
+        return -1;
+    }
+
+    int port = open(device, O_RDWR | O_NOCTTY);
+    if (port < 0) {
+        perror(device);
+        return -1;
+    }
+    if (tcgetattr(port, &settings) == 0) {
+        cfmakeraw(&settings);
+        cfsetispeed(&settings, speed);
+        cfsetospeed(&settings, speed);
+        settings.c_cc[VMIN] = 0;
+        settings.c_cc[VTIME] = 0;
+        tcsetattr(port, TCSANOW, &settings);
+    }
+    tcflush(port, TCIOFLUSH);
+    return port;
+}
+
+static uint16_t Transact(int port, const uint8_t * request, uint16_t size, uint8_t * response, int retries) {
+    uint8_t frame[FRAME_ENCODED_MAX];
+    uint16_t length = FrameEncode(request, size, frame);
+    frame_decoder_t decoder = FrameDecoderCreate();
+    struct pollfd readable = {.fd = port, .events = POLLIN};
+
+    if (decoder == NULL) {
+        return 0;
+    }
+
+    // El separador inicial descarta cualquier byte que el reloj haya recibido antes del pedido
+    for (int attempt = 0; attempt <= retries; attempt++) {
+        if ((write(port, "\0", 1) != 1) || (write(port, frame, length) != length)) {
+            perror("write");
+            break;
+        }
+        while (poll(&readable, 1, RESPONSE_TIMEOUT) > 0) {
+            uint8_t byte;
+
+            if (read(port, &byte, 1) != 1) {
+                continue;
+            }
+            if (FrameDecoderPush(decoder, byte) == FRAME_READY) {
+                uint16_t received;
+                const uint8_t * payload = FrameDecoderGetPayload(decoder, &received);
+
+                // Se ignoran las respuestas atrasadas de un intento anterior a otro pedido
+                if ((received >= PROTOCOL_HEADER_SIZE) && (payload[0] == (request[0] | PROTOCOL_RESPONSE))) {
+                    memcpy(response, payload, received);
+                    free(decoder);
+                    return received;
+                }
+            }
+        }
+    }
+    free(decoder);
+    return 0;
+}
+
+static int ParseTime(const char * text, uint8_t * values, int with_seconds) {
+    unsigned hours, minutes, seconds = 0;
+    char extra;
+
+    if (strcmp(text, "now") == 0) {
+        time_t now = time(NULL);
+        struct tm local;
+
+        localtime_r(&now, &local);
+        values[0] = local.tm_hour;
+        values[1] = local.tm_min;
+        values[2] = local.tm_sec;
+        return 0;
+    }
+
+    int fields = sscanf(text, "%u:%u:%u%c", &hours, &minutes, &seconds, &extra);
+    if ((fields < 2) || (fields > 3) || (!with_seconds && (fields == 3)) || (hours > 23) || (minutes > 59) ||
+        (seconds > 59)) {
+        return -1;
+    }
+    values[0] = hours;
+    values[1] = minutes;
+    values[2] = seconds;
+    return 0;
+}
+
+static int ParseSwitch(const char * text, uint8_t * value) {
+    if (strcmp(text, "on") == 0) {
+        *value = 1;
+    } else if (strcmp(text, "off") == 0) {
+        *value = 0;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+static uint32_t GetCounter(const uint8_t * data, int size) {
+    uint32_t value = 0;
+
+    for (int index = 0; index < size; index++) {
+        value = (value << 8) | data[index];
+    }
+    return value;
+}
+
+static void Usage(const char * program) {
+    fprintf(stderr,
+            "Uso: %s -d dispositivo [-b baudios] [-r reintentos] comando [argumentos]\n"
+            "  time [HH:MM[:SS] | now]\n"
+            "  alarm [HH:MM on|off]\n"
+            "  provision HH:MM[:SS] | now HH:MM on|off\n"
+            "  status\n",
+            program);
+}
+
+/* === Public function implementation ============================================================================== */
+
+int main(int argc, char * argv[]) {
+    const char * device = NULL;
+    long bauds = DEFAULT_BAUDS;
+    int retries = DEFAULT_RETRIES;
+    uint8_t request[FRAME_PAYLOAD_MAX];
+    uint8_t response[FRAME_PAYLOAD_MAX];
+    uint16_t size = 1;
+    int option;
+
+    while ((option = getopt(argc, argv, "d:b:r:")) != -1) {
+        if (option == 'd') {
+            device = optarg;
+        } else if (option == 'b') {
+            bauds = strtol(optarg, NULL, 10);
+        } else if (option == 'r') {
+            retries = atoi(optarg);
+        } else {
+            Usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    char ** arguments = &argv[optind];
+    int count = argc - optind;
+    int valid = (device != NULL) && (count > 0);
+
+    if (valid && (strcmp(arguments[0], "time") == 0) && (count == 1)) {
+        request[0] = PROTOCOL_GET_TIME;
+    } else if (valid && (strcmp(arguments[0], "time") == 0) && (count == 2)) {
+        request[0] = PROTOCOL_SET_TIME;
+        valid = ParseTime(arguments[1], &request[1], 1) == 0;
+        size = 4;
+    } else if (valid && (strcmp(arguments[0], "alarm") == 0) && (count == 1)) {
+        request[0] = PROTOCOL_GET_ALARM;
+    } else if (valid && (strcmp(arguments[0], "alarm") == 0) && (count == 3)) {
+        request[0] = PROTOCOL_SET_ALARM;
+        valid = (ParseTime(arguments[1], &request[1], 0) == 0) && (ParseSwitch(arguments[2], &request[3]) == 0);
+        size = 4;
+    } else if (valid && (strcmp(arguments[0], "provision") == 0) && (count == 4)) {
+        uint8_t alarm[3] = {0};
+
+        request[0] = PROTOCOL_PROVISION;
+        valid = (ParseTime(arguments[1], &request[1], 1) == 0) && (ParseTime(arguments[2], alarm, 0) == 0) &&
+                (ParseSwitch(arguments[3], &request[6]) == 0);
+        request[4] = alarm[0];
+        request[5] = alarm[1];
+        size = 7;
+    } else if (valid && (strcmp(arguments[0], "status") == 0) && (count == 1)) {
+        request[0] = PROTOCOL_GET_STATUS;
+    } else {
+        valid = 0;
+    }
+    if (!valid) {
+        Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    int port = OpenPort(device, bauds);
+    if (port < 0) {
+        return EXIT_FAILURE;
+    }
+    uint16_t received = Transact(port, request, size, response, retries);
+    close(port);
+
+    if (received == 0) {
+        fprintf(stderr, "El reloj no respondio\n");
+        return EXIT_FAILURE;
+    }
+    if (response[1] != PROTOCOL_OK) {
+        fprintf(stderr, "Error: %s\n", (response[1] <= PROTOCOL_REJECTED) ? results[response[1]] : "desconocido");
+        return EXIT_FAILURE;
+    }
+
+    const uint8_t * data = &response[PROTOCOL_HEADER_SIZE];
+    if ((request[0] == PROTOCOL_GET_TIME) && (received >= PROTOCOL_HEADER_SIZE + 4)) {
+        if (data[0]) {
+            printf("%02u:%02u:%02u\n", data[1], data[2], data[3]);
+        } else {
+            printf("sin hora valida\n");
+        }
+    } else if ((request[0] == PROTOCOL_GET_ALARM) && (received >= PROTOCOL_HEADER_SIZE + 3)) {
+        printf("%02u:%02u %s\n", data[0], data[1], data[2] ? "on" : "off");
+    } else if ((request[0] == PROTOCOL_GET_STATUS) && (received >= PROTOCOL_HEADER_SIZE + PROTOCOL_STATUS_SIZE)) {
+        printf("hora valida            %s\n", (data[0] & PROTOCOL_FLAG_TIME_VALID) ? "si" : "no");
+        printf("alarma habilitada      %s\n", (data[0] & PROTOCOL_FLAG_ALARM_ENABLED) ? "si" : "no");
+        printf("alarma sonando         %s\n", (data[0] & PROTOCOL_FLAG_ALARM_TRIGGERED) ? "si" : "no");
+        printf("tramas recibidas       %u\n", (unsigned)GetCounter(&data[1], 2));
+        printf("tramas con errores     %u\n", (unsigned)GetCounter(&data[3], 2));
+        printf("ticks perdidos         %u\n", (unsigned)GetCounter(&data[5], 2));
+        printf("presupuestos excedidos %u\n", (unsigned)GetCounter(&data[7], 2));
+        printf("eventos descartados    %u\n", (unsigned)GetCounter(&data[9], 4));
+        printf("bytes descartados      %u\n", (unsigned)GetCounter(&data[13], 4));
+    } else {
+        printf("%s\n", results[PROTOCOL_OK]);
+    }
+    return EXIT_SUCCESS;
+}
+
+/* === End of documentation ======================================================================================== */
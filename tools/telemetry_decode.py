@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+#####################################################################################################################
+# Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+# documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+# persons to whom the Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+# Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+# WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+# OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+#####################################################################################################################
+"""Decodifica el registro binario de eventos que el reloj transmite por el puerto serie y lo muestra como una linea de
+tiempo legible.
+
+El registro se lee de un archivo capturado, de la entrada estandar o directamente del puerto serie con --port, que
+requiere el paquete pyserial. Los nombres de los modos, teclas y tareas deben coincidir con ui.h y con la tabla de
+tareas de main.c.
+"""
+
+import argparse
+import sys
+
+VERSION = 1
+
+START, LOST, MODE, KEY, ALARM, SNOOZE, CANCEL, MISSED_TICKS, OVERRUN = range(9)
+TYPES = 9
+
+MODES = [
+    "UNSET", "HOME", "SET_TIME_MINUTES", "SET_TIME_HOURS", "SET_ALARM_MINUTES", "SET_ALARM_HOURS", "ALARM_TRIGGERED",
+]
+KEYS = ["SET_TIME", "SET_ALARM", "DECREMENT", "INCREMENT", "ACCEPT", "CANCEL"]
+TASKS = ["compose", "clock", "keys", "ui", "settings", "telemetry", "commands"]
+
+
+def name(names, value):
+    return names[value] if value < len(names) else f"#{value}"
+
+
+def describe(kind, value):
+    """Texto de un registro para la linea de tiempo"""
+    if kind == START:
+        return f"--- comienzo del registro, formato {value} ---"
+    if kind == LOST:
+        return f"se descartaron {value} registros por buffer lleno"
+    if kind == MODE:
+        return f"modo {name(MODES, value)}"
+    if kind == KEY:
+        return f"tecla {name(KEYS, value)}"
+    if kind == ALARM:
+        return f"ALARMA sonando a las {value // 60:02d}:{value % 60:02d}"
+    if kind == SNOOZE:
+        return f"alarma pospuesta {value} minutos"
+    if kind == CANCEL:
+        return "alarma cancelada hasta el dia siguiente"
+    if kind == MISSED_TICKS:
+        return f"ticks perdidos, {value} en total"
+    return f"la tarea {name(TASKS, value)} excedio su presupuesto"
+
+
+class Decoder:
+    """Decodifica el registro de a bloques, un registro puede quedar repartido entre dos bloques"""
+
+    def __init__(self):
+        self.pending = bytearray()
+        self.synchronized = False
+        self.time = 0
+        self.skipped = 0
+
+    @staticmethod
+    def varint(data, offset):
+        """Devuelve el entero que comienza en offset y la posicion siguiente, o None si el entero esta incompleto"""
+        value = 0
+        shift = 0
+        while offset < len(data):
+            byte = data[offset]
+            offset += 1
+            if shift == 28 and byte > 0x0F:
+                raise ValueError("entero de mas de 32 bits")
+            value |= (byte & 0x7F) << shift
+            if byte < 0x80:
+                return value, offset
+            shift += 7
+        return None
+
+    def parse(self, data, offset):
+        """Devuelve el registro que comienza en offset y la posicion siguiente, o None si el registro esta incompleto"""
+        kind = data[offset]
+        if kind >= TYPES:
+            raise ValueError(f"tipo de registro {kind} desconocido")
+        delta = self.varint(data, offset + 1)
+        if delta is None:
+            return None
+        value = self.varint(data, delta[1])
+        if value is None:
+            return None
+        return kind, delta[0], value[0], value[1]
+
+    def feed(self, chunk):
+        """Agrega bytes recibidos y devuelve los registros completos como tuplas de tiempo, tipo y valor"""
+        self.pending += chunk
+        records = []
+        offset = 0
+        while offset < len(self.pending):
+            try:
+                record = self.parse(self.pending, offset)
+            except ValueError:
+                record = False
+            if record is None:
+                break
+            # Sin sincronizar, o despues de un error, se descartan bytes hasta encontrar un registro de comienzo
+            if record is False or (not self.synchronized and (record[0] != START or record[2] != VERSION)):
+                self.synchronized = False
+                self.skipped += 1
+                offset += 1
+                continue
+
+            kind, delta, value, offset = record
+            if kind == START:
+                self.synchronized = True
+                self.time = 0
+            else:
+                self.time += delta
+            records.append((self.time, kind, value))
+        del self.pending[:offset]
+        return records
+
+
+def timestamp(milliseconds):
+    seconds, milliseconds = divmod(milliseconds, 1000)
+    minutes, seconds = divmod(seconds, 60)
+    hours, minutes = divmod(minutes, 60)
+    return f"{hours:4d}:{minutes:02d}:{seconds:02d}.{milliseconds:03d}"
+
+
+def chunks(arguments):
+    """Genera los bloques de bytes leidos del origen indicado"""
+    if arguments.port:
+        try:
+            import serial
+        except ImportError:
+            sys.exit("--port requiere el paquete pyserial")
+        with serial.Serial(arguments.port, arguments.baud, timeout=0.1) as port:
+            while True:
+                yield port.read(256)
+    elif arguments.capture == "-":
+        yield sys.stdin.buffer.read()
+    else:
+        try:
+            with open(arguments.capture, "rb") as file:
+                yield file.read()
+        except OSError as error:
+            sys.exit(f"{arguments.capture}: {error}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", nargs="?", default="-", help="archivo con los bytes capturados, - para la entrada")
+    parser.add_argument("--port", help="puerto serie del que se lee el registro en lugar de un archivo")
+    parser.add_argument("--baud", type=int, default=115200, help="velocidad del puerto serie")
+    parser.add_argument("--summary", action="store_true", help="muestra solo la cantidad de registros de cada tipo")
+    arguments = parser.parse_args()
+
+    decoder = Decoder()
+    counts = [0] * TYPES
+    try:
+        for chunk in chunks(arguments):
+            for time, kind, value in decoder.feed(chunk):
+                counts[kind] += 1
+                if not arguments.summary:
+                    print(f"{timestamp(time)}  {describe(kind, value)}", flush=arguments.port is not None)
+    except KeyboardInterrupt:
+        pass
+
+    if arguments.summary:
+        labels = ["reinicios", "avisos de descarte", "cambios de modo", "teclas", "alarmas", "postergaciones",
+                  "cancelaciones", "avisos de ticks perdidos", "presupuestos excedidos"]
+        for label, count in zip(labels, counts):
+            print(f"{label:<26} {count:>8}")
+    if decoder.skipped:
+        print(f"Se descartaron {decoder.skipped} bytes sin sincronizar", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
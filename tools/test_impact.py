@@ -0,0 +1,301 @@
+#!/usr/bin/env python3
+#####################################################################################################################
+# Copyright (c) 2025, Bayona Franco Gabriel <gabrielbayona19@gmail.com>
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+# documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit
+# persons to whom the Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+# Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+# WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+# OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# SPDX-License-Identifier: MIT
+#####################################################################################################################
+"""Ejecuta solo las pruebas de Ceedling afectadas por los cambios desde la ultima ejecucion, segun la cobertura de las
+funciones registrada para cada prueba.
+
+Cada ejecucion utiliza las tareas gcov de Ceedling, lee con gcov (gcc 9 o posterior) las funciones que ejecuto cada
+prueba y guarda en build/test_impact.json una huella de cada funcion. Se siguen los archivos de src y los que las
+pruebas agregan con TEST_SOURCE_FILE, como los modulos de muju. En la siguiente ejecucion se repiten las pruebas nuevas
+o modificadas y las que ejecutaron alguna funcion cuyo codigo cambio. Un cambio en un archivo fuente fuera de las
+funciones, como una variable o una macro, repite todas las pruebas que utilizan ese archivo. Un cambio en un archivo
+de cabecera de inc, de muju/module o de una carpeta agregada con TEST_INCLUDE_PATH, en test/support o en project.yml
+repite la suite completa, porque la cobertura de funciones no alcanza para saber a quien afecta.
+
+Uso desde la raiz del proyecto:
+
+    tools/test_impact.py              ejecuta las pruebas afectadas
+    tools/test_impact.py --dry-run    muestra la seleccion sin ejecutarla
+    tools/test_impact.py --full       ejecuta la suite completa y registra de nuevo la cobertura
+"""
+
+import argparse
+import hashlib
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import time
+
+VERSION = 2
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+STATE = os.path.join("build", "test_impact.json")
+COVERAGE = os.path.join("build", "gcov", "out")
+
+SOURCES = "src"
+TESTS = "test"
+GLOBAL = ["inc", os.path.join("test", "support"), "project.yml"]
+MODULES = os.path.join("muju", "module")
+
+# Archivos fuente y carpetas de cabeceras que una prueba agrega a las que Ceedling deduce de sus inclusiones
+LINKED = re.compile(r"\bTEST_(SOURCE_FILE|INCLUDE_PATH)\(\s*\"([^\"]+)\"\s*\)")
+
+COMMENTS = re.compile(r"//[^\n]*|/\*.*?\*/|\"(?:\\.|[^\"\\])*\"|'(?:\\.|[^'\\])*'", re.DOTALL)
+DEFINITION = re.compile(r"(\w+)\s*\([^;{}]*\)\s*$")
+
+
+def digest(text):
+    return hashlib.sha1(text.encode("utf-8")).hexdigest()[:16]
+
+
+def read(path):
+    with open(path, encoding="utf-8", errors="replace") as file:
+        return file.read()
+
+
+def strip(text):
+    """Elimina los comentarios y normaliza los espacios, asi un cambio de formato no repite pruebas"""
+    text = COMMENTS.sub(lambda match: match.group(0) if match.group(0)[0] in "\"'" else " ", text)
+    return re.sub(r"\s+", " ", text)
+
+
+def fingerprint(path):
+    """Huella de cada funcion definida en un archivo fuente y del resto del archivo
+
+    Una definicion es una llave de primer nivel precedida por un nombre y una lista de parametros, asi las
+    inicializaciones de tablas y estructuras quedan en el resto del archivo.
+    """
+    text = strip(read(path))
+    functions = {}
+    rest = []
+    depth = 0
+    start = 0
+    begin = 0
+    for index, char in enumerate(text):
+        if char == "{":
+            if depth == 0:
+                begin = index
+            depth += 1
+        elif char == "}" and depth > 0:
+            depth -= 1
+            if depth == 0:
+                head = text[start:begin]
+                declaration = max(head.rfind(";"), head.rfind("}")) + 1
+                match = DEFINITION.search(head[declaration:])
+                if match:
+                    rest.append(head[:declaration])
+                    functions[match.group(1)] = digest(head[declaration:] + text[begin : index + 1])
+                else:
+                    rest.append(text[start : index + 1])
+                start = index + 1
+    rest.append(text[start:])
+    return {"rest": digest("".join(rest)), "functions": functions}
+
+
+def walk(path, extensions):
+    if os.path.isfile(path):
+        return [path]
+    found = []
+    for folder, _, files in os.walk(path):
+        found.extend(os.path.join(folder, name) for name in files if name.endswith(extensions))
+    return sorted(found)
+
+
+def modules():
+    """Carpetas de cabeceras de los modulos de muju, que comparten las pruebas y el resto de los modulos"""
+    found = []
+    for folder, names, _ in os.walk(MODULES):
+        found.extend(os.path.join(folder, name) for name in names if name == "inc")
+    return found
+
+
+def scan():
+    """Huellas actuales de los archivos globales, de las fuentes y de los archivos de prueba"""
+    tests = {}
+    linked = set()
+    folders = set(GLOBAL) | set(modules())
+    for name in walk(TESTS, (".c",)):
+        base = os.path.basename(name)
+        if base.startswith("test_") and not name.startswith(os.path.join(TESTS, "support")):
+            text = read(name)
+            tests[os.path.splitext(base)[0]] = digest(text)
+            for kind, path in LINKED.findall(text):
+                (linked if kind == "SOURCE_FILE" else folders).add(os.path.normpath(path))
+    headers = {}
+    for path in sorted(folders):
+        for name in walk(path, (".h", ".c", ".yml")):
+            headers[name] = digest(read(name))
+    files = set(walk(SOURCES, (".c",))) | {name for name in linked if os.path.isfile(name)}
+    sources = {name: fingerprint(name) for name in sorted(files)}
+    return headers, sources, tests
+
+
+def load():
+    try:
+        state = json.loads(read(STATE))
+    except (OSError, ValueError):
+        return None
+    return state if state.get("version") == VERSION else None
+
+
+def select(state, headers, sources, tests):
+    """Devuelve las pruebas que deben ejecutarse y el motivo de cada una, o None si corresponde la suite completa"""
+    if state is None:
+        return None, "no hay cobertura registrada"
+    for name in sorted(set(headers) | set(state["headers"])):
+        if headers.get(name) != state["headers"].get(name):
+            return None, f"cambio {name}"
+
+    # Funciones modificadas de cada archivo fuente, None cuando cambio el archivo fuera de las funciones
+    changed = {}
+    for name, before in state["sources"].items():
+        after = sources.get(name)
+        if after is None or after["rest"] != before["rest"] or set(after["functions"]) != set(before["functions"]):
+            changed[name] = None
+        else:
+            functions = {key for key, value in after["functions"].items() if before["functions"][key] != value}
+            if functions:
+                changed[name] = functions
+
+    selected = {}
+    for test, content in tests.items():
+        recorded = state["tests"].get(test)
+        if recorded is None:
+            selected[test] = "prueba nueva"
+        elif recorded["file"] != content:
+            selected[test] = "prueba modificada"
+        else:
+            for name, functions in recorded["covered"].items():
+                if name not in changed:
+                    continue
+                if changed[name] is None:
+                    selected[test] = f"cambio {name}"
+                    break
+                touched = sorted(changed[name].intersection(functions))
+                if touched:
+                    selected[test] = f"cambio {', '.join(touched)} en {name}"
+                    break
+    return selected, None
+
+
+def covered(test):
+    """Funciones de los archivos del proyecto que ejecuto una prueba, leidas de la cobertura que dejo Ceedling"""
+    functions = {}
+    for path in walk(os.path.join(COVERAGE, test), (".gcda",)):
+        try:
+            output = subprocess.run(
+                ["gcov", "--json-format", "--stdout", path], capture_output=True, text=True, check=True
+            ).stdout
+        except (OSError, subprocess.CalledProcessError) as error:
+            sys.exit(f"{path}: no se pudo leer la cobertura con gcov: {error}")
+        for line in output.splitlines():
+            if not line.strip():
+                continue
+            for entry in json.loads(line)["files"]:
+                name = entry["file"]
+                if os.path.isabs(name):
+                    name = os.path.relpath(name, ROOT)
+                name = os.path.normpath(name)
+                if name == os.pardir or name.startswith(os.pardir + os.sep):
+                    continue
+                executed = {function["name"] for function in entry["functions"] if function["execution_count"] > 0}
+                if executed:
+                    functions.setdefault(name, set()).update(executed)
+    return {name: sorted(values) for name, values in sorted(functions.items())}
+
+
+def clean(tests):
+    """Borra la cobertura anterior de las pruebas, porque gcov acumula los contadores entre ejecuciones"""
+    for test in tests:
+        for path in walk(os.path.join(COVERAGE, test), (".gcda",)):
+            os.remove(path)
+
+
+def run(ceedling, tasks):
+    start = time.monotonic()
+    result = subprocess.run(shlex.split(ceedling) + tasks, check=False)
+    return result.returncode, time.monotonic() - start
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--full", action="store_true", help="ejecuta la suite completa y registra la cobertura")
+    parser.add_argument("--dry-run", action="store_true", help="muestra las pruebas seleccionadas sin ejecutarlas")
+    parser.add_argument("--ceedling", default="ceedling", help="comando que ejecuta Ceedling")
+    arguments = parser.parse_args()
+
+    os.chdir(ROOT)
+    if shutil.which("gcov") is None:
+        sys.exit("se necesita gcov para registrar la cobertura de cada prueba")
+
+    state = load()
+    headers, sources, tests = scan()
+    if arguments.full:
+        selected, reason = None, "se pidio la suite completa"
+    else:
+        selected, reason = select(state, headers, sources, tests)
+
+    if selected is None:
+        print(f"Suite completa, {len(tests)} pruebas: {reason}")
+        chosen = sorted(tests)
+    else:
+        print(f"Seleccion de {len(selected)} de {len(tests)} pruebas")
+        for test in sorted(selected):
+            print(f"  {test:<24} {selected[test]}")
+        chosen = sorted(selected)
+    if arguments.dry_run:
+        return
+
+    elapsed = 0.0
+    if chosen:
+        clean(chosen)
+        tasks = ["gcov:all"] if selected is None else [f"gcov:{test}" for test in chosen]
+        status, elapsed = run(arguments.ceedling, tasks)
+        if status != 0:
+            # No se actualiza el registro, asi la proxima ejecucion vuelve a seleccionar las pruebas que fallaron
+            sys.exit(status)
+
+    if selected is None or state is None:
+        state = {"version": VERSION, "full_seconds": elapsed, "tests": {}}
+    state["headers"] = headers
+    state["sources"] = sources
+    state["tests"] = {test: state["tests"][test] for test in tests if test in state["tests"]}
+    for test in chosen:
+        state["tests"][test] = {"file": tests[test], "covered": covered(test)}
+    os.makedirs(os.path.dirname(STATE), exist_ok=True)
+    with open(STATE, "w", encoding="utf-8") as file:
+        json.dump(state, file, indent=1, sort_keys=True)
+
+    full = state["full_seconds"]
+    if selected is None:
+        print(f"Suite completa en {elapsed:.1f} s")
+    elif full > 0:
+        saved = max(full - elapsed, 0.0)
+        print(f"Seleccion en {elapsed:.1f} s, suite completa {full:.1f} s", end="")
+        print(f", ahorro {saved:.1f} s ({100 * saved / full:.0f}%)")
+    else:
+        print(f"Seleccion en {elapsed:.1f} s")
+
+
+if __name__ == "__main__":
+    main()